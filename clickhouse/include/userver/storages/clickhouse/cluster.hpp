@@ -26,6 +26,7 @@ class ExecutionResult;
 
 namespace impl {
 struct ClickhouseSettings;
+class InsertBufferBase;
 }
 
 /// @ingroup userver_clients
@@ -60,6 +61,23 @@ class Cluster final {
   ExecutionResult Execute(OptionalCommandControl, const Query& query,
                           const Args&... args) const;
 
+  /// @brief Execute a statement at some host of the cluster
+  /// with args as query parameters and pass the result to `handler` block by
+  /// block as the blocks arrive, without buffering the whole result.
+  /// @note The handler is called while the connection is reading the
+  /// response, so it should be fast; an exception thrown by the handler
+  /// aborts the query. Command control timeout applies to the whole query.
+  template <typename... Args>
+  void ExecuteStreaming(const BlockHandler& handler, const Query& query,
+                        const Args&... args) const;
+
+  /// @brief Execute a statement with specified command control settings
+  /// at some host of the cluster with args as query parameters and pass the
+  /// result to `handler` block by block as the blocks arrive.
+  template <typename... Args>
+  void ExecuteStreaming(OptionalCommandControl, const BlockHandler& handler,
+                        const Query& query, const Args&... args) const;
+
   /// @brief Insert data at some host of the cluster;
   /// `T` is expected to be a struct of vectors of same length.
   /// @param table_name table to insert into
@@ -126,11 +144,16 @@ class Cluster final {
   };
 
  private:
+  friend class impl::InsertBufferBase;
+
   void DoInsert(OptionalCommandControl,
                 const impl::InsertionRequest& request) const;
 
   ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+  void DoExecuteStreaming(OptionalCommandControl, const Query& query,
+                          const BlockHandler& handler) const;
+
   const impl::Pool& GetPool() const;
 
   std::vector<impl::Pool> pools_;
@@ -189,6 +212,20 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc,
   return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+void Cluster::ExecuteStreaming(const BlockHandler& handler, const Query& query,
+                               const Args&... args) const {
+  ExecuteStreaming(OptionalCommandControl{}, handler, query, args...);
+}
+
+template <typename... Args>
+void Cluster::ExecuteStreaming(OptionalCommandControl optional_cc,
+                               const BlockHandler& handler, const Query& query,
+                               const Args&... args) const {
+  const auto formatted_query = query.WithArgs(args...);
+  DoExecuteStreaming(optional_cc, formatted_query, handler);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -3,12 +3,14 @@
 /// @file userver/storages/clickhouse/execution_result.hpp
 /// @brief Result accessor.
 
+#include <functional>
 #include <memory>
 #include <type_traits>
 
 #include <boost/pfr/core.hpp>
 
 #include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
+#include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
 #include <userver/storages/clickhouse/io/impl/validate.hpp>
 
 #include <userver/storages/clickhouse/io/result_mapper.hpp>
@@ -27,6 +29,12 @@ namespace storages::clickhouse {
 /// @snippet storages/tests/execute_chtest.cpp  Sample CppToClickhouse specialization
 ///
 /// @snippet storages/tests/execute_chtest.cpp  Sample ExecutionResult usage
+///
+/// Large results can be read without copying the values with
+/// GetColumnView() and without buffering the whole result with
+/// storages::clickhouse::Cluster::ExecuteStreaming:
+///
+/// @snippet storages/tests/execute_chtest.cpp  Sample ExecuteStreaming usage
 
 // clang-format on
 class ExecutionResult final {
@@ -57,6 +65,13 @@ class ExecutionResult final {
   template <typename Container>
   Container AsContainer() &&;
 
+  /// @brief Returns a non-owning typed view over the column `index` of the
+  /// underlying block, the values are not copied.
+  /// `ColumnType` is a numeric column (the view is a span over the column
+  /// buffer, valid while the result is alive) or io::columns::StringColumn.
+  template <typename ColumnType>
+  typename ColumnType::view_type GetColumnView(size_t index) const;
+
  private:
   impl::BlockWrapperPtr block_;
 };
@@ -100,6 +115,17 @@ Container ExecutionResult::AsContainer() && {
   return result;
 }
 
+template <typename ColumnType>
+typename ColumnType::view_type ExecutionResult::GetColumnView(
+    size_t index) const {
+  UASSERT(block_);
+  return ColumnType::MakeView(io::columns::GetWrappedColumn(*block_, index));
+}
+
+/// Handler of the blocks of a streamed result,
+/// see storages::clickhouse::Cluster::ExecuteStreaming
+using BlockHandler = std::function<void(ExecutionResult&& block)>;
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
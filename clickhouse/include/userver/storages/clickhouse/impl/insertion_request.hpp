@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include <userver/utils/assert.hpp>
@@ -19,6 +21,19 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::clickhouse::impl {
 
+template <typename MappedType>
+struct ColumnsContainers;
+
+template <typename... Columns>
+struct ColumnsContainers<std::tuple<Columns...>> final {
+  using type = std::tuple<typename Columns::container_type...>;
+};
+
+/// Tuple of column containers to store rows of type `Row` column-wise
+template <typename Row>
+using RowColumnsT = typename ColumnsContainers<
+    typename io::CppToClickhouse<Row>::mapped_type>::type;
+
 class InsertionRequest final {
  public:
   InsertionRequest(const std::string& table_name,
@@ -36,6 +51,12 @@ class InsertionRequest final {
       const std::string& table_name,
       const std::vector<std::string_view>& column_names, const Container& data);
 
+  template <typename Row>
+  static InsertionRequest CreateFromColumns(
+      const std::string& table_name,
+      const std::vector<std::string_view>& column_names,
+      const RowColumnsT<Row>& columns);
+
   const std::string& GetTableName() const;
 
   const impl::BlockWrapper& GetBlock() const;
@@ -92,6 +113,14 @@ class InsertionRequest final {
     const Container& data_;
   };
 
+  template <typename Mapper, typename Columns, size_t... Indices>
+  static void AppendColumns(Mapper& mapper, const Columns& columns,
+                            std::index_sequence<Indices...>) {
+    (mapper(std::get<Indices>(columns),
+            std::integral_constant<size_t, Indices>{}),
+     ...);
+  }
+
   const std::string& table_name_;
   const std::vector<std::string_view>& column_names_;
 
@@ -136,6 +165,25 @@ InsertionRequest InsertionRequest::CreateFromRows(
   return request;
 }
 
+template <typename Row>
+InsertionRequest InsertionRequest::CreateFromColumns(
+    const std::string& table_name,
+    const std::vector<std::string_view>& column_names,
+    const RowColumnsT<Row>& columns) {
+  io::impl::CommonValidateMapping<Row>();
+  // TODO : static_assert this when std::span comes
+  io::impl::ValidateColumnsCount<Row>(column_names.size());
+
+  InsertionRequest request{table_name, column_names};
+  using MappedType = typename io::CppToClickhouse<Row>::mapped_type;
+  auto mapper = InsertionRequest::ColumnsMapper<MappedType>{
+      *request.block_, request.column_names_};
+
+  AppendColumns(mapper, columns,
+                std::make_index_sequence<std::tuple_size_v<MappedType>>{});
+  return request;
+}
+
 }  // namespace storages::clickhouse::impl
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,230 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/insert_buffer.hpp
+/// @brief @copybrief storages::clickhouse::InsertBuffer
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+class Cluster;
+
+/// Settings of storages::clickhouse::InsertBuffer
+struct InsertBufferSettings final {
+  /// What to do with new rows when the buffer is full
+  enum class OverflowBehavior {
+    /// Append waits until the buffered rows are flushed
+    kWait,
+    /// Append drops the row
+    kDrop,
+  };
+
+  /// Number of buffered rows that triggers a flush
+  std::size_t max_rows{100'000};
+
+  /// Maximum time between flushes of a non-empty buffer
+  std::chrono::milliseconds max_delay{1000};
+
+  /// Maximum number of buffered rows, including the rows being flushed
+  std::size_t max_pending_rows{1'000'000};
+
+  /// Behavior of Append when `max_pending_rows` is reached
+  OverflowBehavior overflow_behavior{OverflowBehavior::kWait};
+
+  /// Command control for the INSERT queries
+  OptionalCommandControl command_control{};
+};
+
+namespace stats {
+struct InsertBufferStatistics;
+}
+
+namespace impl {
+
+class InsertBufferBase {
+ public:
+  InsertBufferBase(const Cluster& cluster, std::string table_name,
+                   std::vector<std::string> column_names,
+                   InsertBufferSettings settings);
+  virtual ~InsertBufferBase();
+
+  InsertBufferBase(const InsertBufferBase&) = delete;
+  InsertBufferBase& operator=(const InsertBufferBase&) = delete;
+
+  void Flush();
+
+  void WriteStatistics(
+      USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
+
+ protected:
+  void Start();
+  void Stop();
+
+  const std::string& GetTableName() const;
+  const std::vector<std::string_view>& GetColumnNames() const;
+
+  // Returns a non-owning lock if the row must be dropped
+  std::unique_lock<engine::Mutex> LockForAppend();
+  void OnAppended(std::unique_lock<engine::Mutex>& lock);
+
+ private:
+  // Called with the append lock held, the flushing buffer is empty
+  virtual void MoveToFlushing() = 0;
+  virtual InsertionRequest MakeFlushingRequest() const = 0;
+  virtual void ClearFlushing() = 0;
+
+  void RunFlushLoop();
+  void FlushBuffered();
+
+  const Cluster& cluster_;
+  const std::string table_name_;
+  const std::vector<std::string> column_names_;
+  const std::vector<std::string_view> column_names_views_;
+  const InsertBufferSettings settings_;
+
+  engine::Mutex mutex_;
+  engine::ConditionVariable flush_cv_;
+  engine::ConditionVariable space_cv_;
+  std::size_t buffered_rows_{0};
+  std::size_t flushing_rows_{0};
+  bool stopped_{false};
+
+  engine::Mutex flush_mutex_;
+  std::unique_ptr<stats::InsertBufferStatistics> stats_;
+  engine::TaskWithResult<void> flush_task_;
+};
+
+}  // namespace impl
+
+// clang-format off
+
+/// @brief Asynchronous buffered inserter into a ClickHouse table.
+///
+/// Rows appended from any coroutine are stored column-wise and are sent by a
+/// single INSERT when `max_rows` rows are buffered, when `max_delay` passes
+/// since the previous flush, on Flush() call or on destruction. Each row is
+/// copied just once, from the buffer to the native column.
+///
+/// When `max_pending_rows` rows are waiting to be inserted, Append waits for
+/// the flush to complete or drops the row, depending on `overflow_behavior`.
+/// Rows of a failed INSERT are dropped and accounted in the statistics.
+/// Inserts are compressed if `compression: lz4` is set in the
+/// components::ClickHouse config.
+///
+/// `Row` has the same requirements as the `Container::value_type` of
+/// storages::clickhouse::Cluster::InsertRows, see @ref clickhouse_io.
+///
+/// Statistics are written by WriteStatistics, register it in the
+/// utils::statistics::Storage of the service to export flush timings,
+/// inserted and dropped rows.
+///
+/// ## Usage example:
+///
+/// @snippet storages/tests/insert_buffer_chtest.cpp  Sample InsertBuffer usage
+
+// clang-format on
+template <typename Row>
+class InsertBuffer final : private impl::InsertBufferBase {
+ public:
+  /// @param cluster cluster to insert into, must outlive the buffer
+  /// @param table_name table to insert into
+  /// @param column_names names of columns of the table
+  /// @param settings flush and back-pressure settings
+  InsertBuffer(const Cluster& cluster, std::string table_name,
+               std::vector<std::string> column_names,
+               InsertBufferSettings settings = {});
+
+  /// Flushes the remaining rows
+  ~InsertBuffer() override;
+
+  /// @brief Appends a row to the buffer, waits for space if the buffer is full
+  /// and `overflow_behavior` is `kWait`.
+  /// @returns false if the row was dropped
+  bool Append(Row row);
+
+  /// Synchronously inserts the buffered rows
+  using impl::InsertBufferBase::Flush;
+
+  /// Writes flush and rows statistics
+  using impl::InsertBufferBase::WriteStatistics;
+
+ private:
+  using Columns = impl::RowColumnsT<Row>;
+
+  void MoveToFlushing() override;
+  impl::InsertionRequest MakeFlushingRequest() const override;
+  void ClearFlushing() override;
+
+  Columns buffered_;
+  Columns flushing_;
+};
+
+template <typename Row>
+InsertBuffer<Row>::InsertBuffer(const Cluster& cluster, std::string table_name,
+                                std::vector<std::string> column_names,
+                                InsertBufferSettings settings)
+    : impl::InsertBufferBase(cluster, std::move(table_name),
+                             std::move(column_names), std::move(settings)) {
+  io::impl::CommonValidateMapping<Row>();
+  io::impl::ValidateColumnsCount<Row>(GetColumnNames().size());
+
+  Start();
+}
+
+template <typename Row>
+InsertBuffer<Row>::~InsertBuffer() {
+  Stop();
+}
+
+template <typename Row>
+bool InsertBuffer<Row>::Append(Row row) {
+  auto lock = LockForAppend();
+  if (!lock.owns_lock()) return false;
+
+  boost::pfr::for_each_field(row, [this](auto& field, auto index) {
+    std::get<decltype(index)::value>(buffered_).push_back(std::move(field));
+  });
+  OnAppended(lock);
+  return true;
+}
+
+template <typename Row>
+void InsertBuffer<Row>::MoveToFlushing() {
+  // flushing_ is empty here, swapping keeps the capacity of both buffers
+  std::swap(buffered_, flushing_);
+}
+
+template <typename Row>
+impl::InsertionRequest InsertBuffer<Row>::MakeFlushingRequest() const {
+  return impl::InsertionRequest::CreateFromColumns<Row>(
+      GetTableName(), GetColumnNames(), flushing_);
+}
+
+template <typename Row>
+void InsertBuffer<Row>::ClearFlushing() {
+  std::apply([](auto&... columns) { (columns.clear(), ...); }, flushing_);
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -11,3 +11,4 @@
 #include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
 #include <userver/storages/clickhouse/io/columns/base_column.hpp>
 #include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
+#include <userver/utils/span.hpp>
@@ -15,10 +15,14 @@ class Float32Column final : public ClickhouseColumn<Float32Column> {
  public:
   using cpp_type = float;
   using container_type = std::vector<cpp_type>;
+  using view_type = USERVER_NAMESPACE::utils::span<const cpp_type>;
 
   Float32Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  /// Returns a view over the values, pointing into the column buffer
+  static view_type MakeView(const ColumnRef& column);
 };
 
 }  // namespace storages::clickhouse::io::columns
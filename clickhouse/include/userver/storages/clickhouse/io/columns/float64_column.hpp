@@ -15,10 +15,14 @@ class Float64Column final : public ClickhouseColumn<Float64Column> {
  public:
   using cpp_type = double;
   using container_type = std::vector<cpp_type>;
+  using view_type = USERVER_NAMESPACE::utils::span<const cpp_type>;
 
   Float64Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  /// Returns a view over the values, pointing into the column buffer
+  static view_type MakeView(const ColumnRef& column);
 };
 
 }  // namespace storages::clickhouse::io::columns
@@ -15,10 +15,14 @@ class Int32Column final : public ClickhouseColumn<Int32Column> {
  public:
   using cpp_type = std::int32_t;
   using container_type = std::vector<cpp_type>;
+  using view_type = USERVER_NAMESPACE::utils::span<const cpp_type>;
 
   Int32Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  /// Returns a view over the values, pointing into the column buffer
+  static view_type MakeView(const ColumnRef& column);
 };
 
 }  // namespace storages::clickhouse::io::columns
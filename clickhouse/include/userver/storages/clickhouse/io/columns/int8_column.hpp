@@ -15,10 +15,14 @@ class Int8Column final : public ClickhouseColumn<Int8Column> {
  public:
   using cpp_type = std::int8_t;
   using container_type = std::vector<cpp_type>;
+  using view_type = USERVER_NAMESPACE::utils::span<const cpp_type>;
 
   Int8Column(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  /// Returns a view over the values, pointing into the column buffer
+  static view_type MakeView(const ColumnRef& column);
 };
 
 }  // namespace storages::clickhouse::io::columns
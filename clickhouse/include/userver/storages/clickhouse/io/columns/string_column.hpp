@@ -4,7 +4,10 @@
 /// @brief String column support
 /// @ingroup userver_clickhouse_types
 
+#include <cstddef>
+#include <iterator>
 #include <string>
+#include <string_view>
 
 #include <userver/storages/clickhouse/io/columns/column_includes.hpp>
 
@@ -18,9 +21,64 @@ class StringColumn final : public ClickhouseColumn<StringColumn> {
   using cpp_type = std::string;
   using container_type = std::vector<cpp_type>;
 
+  /// @brief Non-owning view over the values of the column, the values point
+  /// into the column buffers and are valid while the view is alive
+  class View final {
+   public:
+    class Iterator final {
+     public:
+      using iterator_category = std::forward_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = std::string_view;
+      using reference = std::string_view;
+      using pointer = void;
+
+      Iterator(const View& view, size_t ind) : view_{&view}, ind_{ind} {}
+
+      std::string_view operator*() const { return (*view_)[ind_]; }
+
+      Iterator& operator++() {
+        ++ind_;
+        return *this;
+      }
+
+      Iterator operator++(int) {
+        auto old = *this;
+        ++ind_;
+        return old;
+      }
+
+      bool operator==(const Iterator& other) const {
+        return ind_ == other.ind_;
+      }
+      bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+     private:
+      const View* view_;
+      size_t ind_;
+    };
+
+    explicit View(ColumnRef column);
+
+    size_t Size() const;
+
+    std::string_view operator[](size_t ind) const;
+
+    Iterator begin() const { return Iterator{*this, 0}; }
+    Iterator end() const { return Iterator{*this, Size()}; }
+
+   private:
+    ColumnRef column_;
+  };
+
+  using view_type = View;
+
   StringColumn(ColumnRef column);
 
   static ColumnRef Serialize(const container_type& from);
+
+  /// Returns a view over the values, pointing into the column buffers
+  static view_type MakeView(const ColumnRef& column);
 };
 
 }  // namespace storages::clickhouse::io::columns
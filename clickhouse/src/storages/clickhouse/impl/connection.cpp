@@ -104,6 +104,32 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc,
   return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreaming(OptionalCommandControl optional_cc,
+                                  const Query& query,
+                                  const BlockHandler& handler) {
+  clickhouse_cpp::Query native_query{query.QueryText()};
+  native_query.OnDataCancelable([]([[maybe_unused]] const auto& block) {
+    // we must return 'true' if we don't want to cancel query
+    return !engine::current_task::ShouldCancel();
+  });
+
+  auto& span = tracing::Span::CurrentSpan();
+  auto scope = span.CreateScopeTime(scopes::kExec);
+
+  native_query.OnData([&handler, &scope](const NativeBlock& data) {
+    scope.Reset(scopes::kExec);
+    // Header and progress blocks carry no rows
+    if (data.GetRowCount() == 0) return;
+
+    // Columns of a received block are never reused by the client,
+    // so the block is shared with the handler without copying the data
+    auto block_ptr = std::make_unique<BlockWrapper>(NativeBlock{data});
+    handler(ExecutionResult{BlockWrapperPtr{block_ptr.release()}});
+  });
+
+  DoExecute(optional_cc, native_query);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc,
                         const InsertionRequest& request) {
   const auto& block = request.GetBlock();
@@ -0,0 +1,166 @@
+#include <userver/storages/clickhouse/insert_buffer.hpp>
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/utils/async.hpp>
+
+#include <storages/clickhouse/stats/pool_statistics.hpp>
+#include <storages/clickhouse/stats/statement_timer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+namespace {
+
+std::vector<std::string_view> MakeViews(
+    const std::vector<std::string>& strings) {
+  return {strings.begin(), strings.end()};
+}
+
+}  // namespace
+
+InsertBufferBase::InsertBufferBase(const Cluster& cluster,
+                                   std::string table_name,
+                                   std::vector<std::string> column_names,
+                                   InsertBufferSettings settings)
+    : cluster_{cluster},
+      table_name_{std::move(table_name)},
+      column_names_{std::move(column_names)},
+      column_names_views_{MakeViews(column_names_)},
+      settings_{std::move(settings)},
+      stats_{std::make_unique<stats::InsertBufferStatistics>()} {
+  if (settings_.max_rows == 0 ||
+      settings_.max_pending_rows < settings_.max_rows) {
+    throw std::invalid_argument{fmt::format(
+        "Invalid InsertBuffer settings for table '{}': max_rows={}, "
+        "max_pending_rows={}",
+        table_name_, settings_.max_rows, settings_.max_pending_rows)};
+  }
+}
+
+InsertBufferBase::~InsertBufferBase() {
+  UASSERT_MSG(!flush_task_.IsValid(), "Stop() was not called");
+}
+
+void InsertBufferBase::Flush() { FlushBuffered(); }
+
+void InsertBufferBase::WriteStatistics(
+    USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
+  writer.ValueWithLabels(*stats_, {{"clickhouse_table", table_name_}});
+}
+
+void InsertBufferBase::Start() {
+  flush_task_ = USERVER_NAMESPACE::utils::CriticalAsync(
+      fmt::format("clickhouse_insert_buffer_{}", table_name_),
+      [this] { RunFlushLoop(); });
+}
+
+void InsertBufferBase::Stop() {
+  {
+    std::lock_guard lock{mutex_};
+    stopped_ = true;
+  }
+  flush_cv_.NotifyAll();
+  space_cv_.NotifyAll();
+
+  // Remaining rows must be inserted even if the current task is cancelled
+  engine::TaskCancellationBlocker blocker;
+  if (flush_task_.IsValid()) flush_task_.Get();
+  // The loop may have been cancelled before draining the buffer
+  FlushBuffered();
+}
+
+const std::string& InsertBufferBase::GetTableName() const {
+  return table_name_;
+}
+
+const std::vector<std::string_view>& InsertBufferBase::GetColumnNames() const {
+  return column_names_views_;
+}
+
+std::unique_lock<engine::Mutex> InsertBufferBase::LockForAppend() {
+  std::unique_lock lock{mutex_};
+  UINVARIANT(!stopped_, "Append to a stopped InsertBuffer");
+
+  const auto has_space = [this] {
+    return buffered_rows_ + flushing_rows_ < settings_.max_pending_rows;
+  };
+  if (has_space()) return lock;
+
+  if (settings_.overflow_behavior ==
+      InsertBufferSettings::OverflowBehavior::kWait) {
+    // Returns false on cancellation
+    const bool is_waited =
+        space_cv_.Wait(lock, [&] { return stopped_ || has_space(); });
+    if (is_waited && !stopped_) return lock;
+  }
+
+  ++stats_->rows_dropped;
+  lock.unlock();
+  return lock;
+}
+
+void InsertBufferBase::OnAppended(std::unique_lock<engine::Mutex>& lock) {
+  UASSERT(lock.owns_lock());
+  ++stats_->rows_appended;
+  const bool is_full = ++buffered_rows_ >= settings_.max_rows;
+  lock.unlock();
+
+  if (is_full) flush_cv_.NotifyOne();
+}
+
+void InsertBufferBase::RunFlushLoop() {
+  while (true) {
+    {
+      std::unique_lock lock{mutex_};
+      const bool is_woken_up = flush_cv_.WaitFor(
+          lock, settings_.max_delay,
+          [this] { return stopped_ || buffered_rows_ >= settings_.max_rows; });
+      if (stopped_ && buffered_rows_ == 0) return;
+      if (!is_woken_up && engine::current_task::ShouldCancel()) return;
+    }
+
+    FlushBuffered();
+  }
+}
+
+void InsertBufferBase::FlushBuffered() {
+  std::lock_guard flush_lock{flush_mutex_};
+
+  std::size_t rows = 0;
+  {
+    std::lock_guard lock{mutex_};
+    if (buffered_rows_ == 0) return;
+
+    rows = std::exchange(buffered_rows_, 0);
+    flushing_rows_ = rows;
+    MoveToFlushing();
+  }
+
+  try {
+    const stats::StatementTimer timer{stats_->flushes};
+    cluster_.DoInsert(settings_.command_control, MakeFlushingRequest());
+    stats_->rows_inserted += rows;
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to insert " << rows << " buffered rows into '"
+                << table_name_ << "', the rows are dropped: " << ex;
+    stats_->rows_dropped += rows;
+  }
+  ClearFlushing();
+
+  {
+    std::lock_guard lock{mutex_};
+    flushing_rows_ = 0;
+  }
+  space_cv_.NotifyAll();
+}
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
@@ -23,6 +23,10 @@ ColumnRef Float32Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Float32Column>::Serialize(from);
 }
 
+Float32Column::view_type Float32Column::MakeView(const ColumnRef& column) {
+  return impl::NumericColumn<Float32Column>::MakeView(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
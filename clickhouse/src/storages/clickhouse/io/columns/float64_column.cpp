@@ -23,6 +23,10 @@ ColumnRef Float64Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Float64Column>::Serialize(from);
 }
 
+Float64Column::view_type Float64Column::MakeView(const ColumnRef& column) {
+  return impl::NumericColumn<Float64Column>::MakeView(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
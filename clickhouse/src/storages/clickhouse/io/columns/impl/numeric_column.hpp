@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 
+#include <userver/utils/span.hpp>
+
 #include <storages/clickhouse/impl/wrap_clickhouse_cpp.hpp>
 #include <storages/clickhouse/io/columns/impl/column_includes.hpp>
 #include <storages/clickhouse/io/columns/impl/column_types_mapping.hpp>
@@ -23,6 +25,17 @@ struct NumericColumn final {
     return std::make_shared<
         clickhouse::impl::clickhouse_cpp::ColumnVector<value_type>>(from);
   }
+
+  static USERVER_NAMESPACE::utils::span<const value_type> MakeView(
+      const clickhouse::impl::clickhouse_cpp::ColumnRef& column) {
+    // The block owns the column, so the data outlives the typed pointer
+    const auto& data =
+        GetTypedColumn<ColumnType,
+                       clickhouse::impl::clickhouse_cpp::ColumnVector<
+                           value_type>>(column)
+            ->GetWritableData();
+    return {data.data(), data.data() + data.size()};
+  }
 };
 
 }  // namespace storages::clickhouse::io::columns::impl
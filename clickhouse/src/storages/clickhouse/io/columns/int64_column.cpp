@@ -22,6 +22,10 @@ ColumnRef Int64Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Int64Column>::Serialize(from);
 }
 
+Int64Column::view_type Int64Column::MakeView(const ColumnRef& column) {
+  return impl::NumericColumn<Int64Column>::MakeView(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
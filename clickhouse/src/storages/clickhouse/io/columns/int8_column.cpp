@@ -22,6 +22,10 @@ ColumnRef Int8Column::Serialize(const container_type& from) {
   return impl::NumericColumn<Int8Column>::Serialize(from);
 }
 
+Int8Column::view_type Int8Column::MakeView(const ColumnRef& column) {
+  return impl::NumericColumn<Int8Column>::MakeView(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
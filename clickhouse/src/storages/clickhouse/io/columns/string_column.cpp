@@ -25,6 +25,18 @@ ColumnRef StringColumn::Serialize(const container_type& from) {
   return std::make_shared<clickhouse::impl::clickhouse_cpp::ColumnString>(from);
 }
 
+StringColumn::view_type StringColumn::MakeView(const ColumnRef& column) {
+  return View{impl::GetTypedColumn<StringColumn, NativeType>(column)};
+}
+
+StringColumn::View::View(ColumnRef column) : column_{std::move(column)} {}
+
+size_t StringColumn::View::Size() const { return GetColumnSize(column_); }
+
+std::string_view StringColumn::View::operator[](size_t ind) const {
+  return impl::NativeGetAt<NativeType>(column_, ind);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
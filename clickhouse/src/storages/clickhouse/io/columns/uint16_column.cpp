@@ -23,6 +23,10 @@ ColumnRef UInt16Column::Serialize(const container_type& from) {
   return impl::NumericColumn<UInt16Column>::Serialize(from);
 }
 
+UInt16Column::view_type UInt16Column::MakeView(const ColumnRef& column) {
+  return impl::NumericColumn<UInt16Column>::MakeView(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
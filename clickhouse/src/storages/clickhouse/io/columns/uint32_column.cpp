@@ -23,6 +23,10 @@ ColumnRef UInt32Column::Serialize(const container_type& from) {
   return impl::NumericColumn<UInt32Column>::Serialize(from);
 }
 
+UInt32Column::view_type UInt32Column::MakeView(const ColumnRef& column) {
+  return impl::NumericColumn<UInt32Column>::MakeView(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
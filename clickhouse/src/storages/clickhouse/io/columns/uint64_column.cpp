@@ -23,6 +23,10 @@ ColumnRef UInt64Column::Serialize(const container_type& from) {
   return impl::NumericColumn<UInt64Column>::Serialize(from);
 }
 
+UInt64Column::view_type UInt64Column::MakeView(const ColumnRef& column) {
+  return impl::NumericColumn<UInt64Column>::MakeView(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -22,6 +22,10 @@ ColumnRef UInt8Column::Serialize(const container_type& from) {
   return impl::NumericColumn<UInt8Column>::Serialize(from);
 }
 
+UInt8Column::view_type UInt8Column::MakeView(const ColumnRef& column) {
+  return impl::NumericColumn<UInt8Column>::MakeView(column);
+}
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -15,6 +15,14 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
   writer["inserts"] = stats.inserts;
 }
 
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const InsertBufferStatistics& stats) {
+  writer["rows"]["appended"] = stats.rows_appended;
+  writer["rows"]["inserted"] = stats.rows_inserted;
+  writer["rows"]["dropped"] = stats.rows_dropped;
+  writer["flushes"] = stats.flushes;
+}
+
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                 const PoolQueryStatistics& stats) {
   writer["total"] = stats.total;
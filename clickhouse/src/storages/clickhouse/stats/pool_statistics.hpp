@@ -36,9 +36,19 @@ struct PoolStatistics final {
   PoolQueryStatistics inserts{};
 };
 
+struct InsertBufferStatistics final {
+  Counter rows_appended{};
+  Counter rows_inserted{};
+  Counter rows_dropped{};
+  PoolQueryStatistics flushes{};
+};
+
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                 const PoolStatistics& stats);
 
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const InsertBufferStatistics& stats);
+
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                 const PoolQueryStatistics& stats);
 
@@ -75,6 +75,54 @@ UTEST(Execute, MappingWorks) {
   EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
 }
 
+UTEST(Execute, StreamingColumnViews) {
+  ClusterWrapper cluster{};
+
+  /// [Sample ExecuteStreaming usage]
+  namespace columns = storages::clickhouse::io::columns;
+
+  uint64_t sum = 0;
+  size_t rows = 0;
+  size_t blocks = 0;
+  size_t strings_size = 0;
+  cluster->ExecuteStreaming(
+      [&](storages::clickhouse::ExecutionResult&& block) {
+        ++blocks;
+        rows += block.GetRowsCount();
+        for (const auto number :
+             block.GetColumnView<columns::UInt64Column>(0)) {
+          sum += number;
+        }
+        for (const auto string :
+             block.GetColumnView<columns::StringColumn>(1)) {
+          strings_size += string.size();
+        }
+      },
+      common_query);
+  /// [Sample ExecuteStreaming usage]
+
+  EXPECT_GE(blocks, 1);
+  EXPECT_EQ(rows, 10000);
+  EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
+  EXPECT_EQ(strings_size, 10000 * 10);
+}
+
+UTEST(Execute, ColumnViews) {
+  ClusterWrapper cluster{};
+  namespace columns = storages::clickhouse::io::columns;
+
+  const auto result = cluster->Execute(common_query);
+  const auto numbers = result.GetColumnView<columns::UInt64Column>(0);
+  const auto strings = result.GetColumnView<columns::StringColumn>(1);
+  ASSERT_EQ(numbers.size(), 10000);
+  ASSERT_EQ(strings.Size(), 10000);
+  EXPECT_EQ(numbers[5001], 5001);
+  EXPECT_EQ(strings[5001].size(), 10);
+
+  UEXPECT_THROW(result.GetColumnView<columns::StringColumn>(0),
+                std::runtime_error);
+}
+
 namespace {
 namespace io = storages::clickhouse::io;
 
@@ -0,0 +1,151 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/insert_buffer.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Event final {
+  uint64_t id;
+  std::string name;
+};
+
+struct EventsCount final {
+  std::vector<uint64_t> count;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<Event> final {
+  using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+template <>
+struct CppToClickhouse<EventsCount> final {
+  using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+namespace {
+
+namespace ch = storages::clickhouse;
+
+uint64_t CountEvents(ch::Cluster& cluster) {
+  return cluster.Execute("SELECT count() FROM tmp_events")
+      .As<EventsCount>()
+      .count.at(0);
+}
+
+template <typename Row>
+std::int64_t GetMetric(const ch::InsertBuffer<Row>& buffer,
+                       const std::string& path) {
+  utils::statistics::Storage storage;
+  const auto holder = storage.RegisterWriter(
+      "clickhouse.insert_buffer", [&buffer](utils::statistics::Writer& writer) {
+        buffer.WriteStatistics(writer);
+      });
+  return utils::statistics::Snapshot{storage, "clickhouse.insert_buffer"}
+      .SingleMetric(path)
+      .AsInt();
+}
+
+}  // namespace
+
+UTEST_MT(InsertBuffer, ConcurrentAppend, 4) {
+  ClusterWrapper cluster{/*use_compression=*/true};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_events "
+      "(id UInt64, name String)");
+
+  constexpr size_t kProducers = 4;
+  constexpr size_t kRowsPerProducer = 2500;
+
+  {
+    /// [Sample InsertBuffer usage]
+    ch::InsertBufferSettings settings;
+    settings.max_rows = 1000;
+    settings.max_delay = std::chrono::milliseconds{50};
+    settings.max_pending_rows = 3000;
+
+    ch::InsertBuffer<Event> buffer{*cluster, "tmp_events", {"id", "name"},
+                                   settings};
+
+    std::vector<engine::TaskWithResult<void>> producers;
+    for (size_t producer = 0; producer < kProducers; ++producer) {
+      producers.push_back(utils::Async("producer", [&buffer, producer] {
+        for (size_t i = 0; i < kRowsPerProducer; ++i) {
+          const uint64_t id = producer * kRowsPerProducer + i;
+          EXPECT_TRUE(buffer.Append({id, std::to_string(id)}));
+        }
+      }));
+    }
+    for (auto& producer : producers) producer.Get();
+    /// [Sample InsertBuffer usage]
+  }
+
+  EXPECT_EQ(CountEvents(*cluster), kProducers * kRowsPerProducer);
+}
+
+UTEST(InsertBuffer, FlushOnDelay) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_events "
+      "(id UInt64, name String)");
+
+  ch::InsertBufferSettings settings;
+  settings.max_delay = std::chrono::milliseconds{10};
+  ch::InsertBuffer<Event> buffer{*cluster, "tmp_events", {"id", "name"},
+                                 settings};
+  ASSERT_TRUE(buffer.Append({1, "first"}));
+  ASSERT_TRUE(buffer.Append({2, "second"}));
+
+  // Temporary table is visible only to the connection that created it,
+  // so don't query the table concurrently with the flush
+  while (GetMetric(buffer, "rows.inserted") != 2) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+  EXPECT_EQ(CountEvents(*cluster), 2);
+}
+
+UTEST(InsertBuffer, DropOnOverflow) {
+  ClusterWrapper cluster{};
+
+  ch::InsertBufferSettings settings;
+  settings.max_rows = 2;
+  settings.max_pending_rows = 2;
+  settings.max_delay = std::chrono::hours{1};
+  settings.overflow_behavior =
+      ch::InsertBufferSettings::OverflowBehavior::kDrop;
+  // The table does not exist, so flushes fail
+  ch::InsertBuffer<Event> buffer{*cluster, "tmp_missing_table", {"id", "name"},
+                                 settings};
+
+  std::int64_t appended = 0;
+  for (uint64_t id = 0; id < 100; ++id) {
+    appended += buffer.Append({id, "event"});
+  }
+  buffer.Flush();
+
+  EXPECT_EQ(GetMetric(buffer, "rows.appended"), appended);
+  EXPECT_EQ(GetMetric(buffer, "rows.inserted"), 0);
+  EXPECT_EQ(GetMetric(buffer, "rows.dropped"), 100);
+  EXPECT_GE(GetMetric(buffer, "flushes.error"), 1);
+}
+
+USERVER_NAMESPACE_END
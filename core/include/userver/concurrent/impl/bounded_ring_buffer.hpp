@@ -0,0 +1,132 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+// Bounded lock-free MPMC FIFO queue by Dmitry Vyukov.
+//
+// Each cell holds a sequence number, that tells whether the cell is ready to
+// be written (sequence == position) or read (sequence == position + 1) at the
+// current lap of the ring. Producers and consumers claim positions by CAS on
+// their own counters, so they contend only with each other.
+//
+// Memory is allocated once in the constructor.
+template <typename T>
+class BoundedRingBuffer final {
+ public:
+  // Capacity is rounded up to a power of two
+  explicit BoundedRingBuffer(std::size_t capacity)
+      : mask_(RoundUpCapacity(capacity) - 1),
+        cells_(std::make_unique<Cell[]>(mask_ + 1)) {
+    for (std::size_t i = 0; i <= mask_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  BoundedRingBuffer(BoundedRingBuffer&&) = delete;
+  BoundedRingBuffer& operator=(BoundedRingBuffer&&) = delete;
+
+  // Must not race with TryPush and TryPop
+  ~BoundedRingBuffer() {
+    const auto end = enqueue_pos_->load(std::memory_order_acquire);
+    for (auto pos = dequeue_pos_->load(std::memory_order_acquire); pos != end;
+         ++pos) {
+      auto& cell = cells_[pos & mask_];
+      UASSERT(cell.sequence.load(std::memory_order_acquire) == pos + 1);
+      GetValue(cell).~T();
+    }
+  }
+
+  std::size_t GetCapacity() const noexcept { return mask_ + 1; }
+
+  // Leaves the `value` unmodified if the buffer is full
+  [[nodiscard]] bool TryPush(T&& value) {
+    auto pos = enqueue_pos_->load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const auto sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+      if (diff == 0) {
+        if (enqueue_pos_->compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // The cell still holds a value from the previous lap
+        return false;
+      } else {
+        pos = enqueue_pos_->load(std::memory_order_relaxed);
+      }
+    }
+
+    ::new (static_cast<void*>(cell->storage)) T(std::move(value));
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  [[nodiscard]] bool TryPop(T& value) {
+    auto pos = dequeue_pos_->load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const auto sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+      if (diff == 0) {
+        if (dequeue_pos_->compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // The cell is not written yet
+        return false;
+      } else {
+        pos = dequeue_pos_->load(std::memory_order_relaxed);
+      }
+    }
+
+    auto& stored = GetValue(*cell);
+    value = std::move(stored);
+    stored.~T();
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  struct Cell final {
+    std::atomic<std::size_t> sequence{0};
+    alignas(T) std::byte storage[sizeof(T)];
+  };
+
+  static T& GetValue(Cell& cell) noexcept {
+    return *std::launder(reinterpret_cast<T*>(cell.storage));
+  }
+
+  static std::size_t RoundUpCapacity(std::size_t capacity) {
+    UINVARIANT(capacity <= (std::size_t{1} << 40),
+               "Too large capacity of a bounded queue");
+    std::size_t result = 2;
+    while (result < capacity) result *= 2;
+    return result;
+  }
+
+  const std::size_t mask_;
+  const std::unique_ptr<Cell[]> cells_;
+  InterferenceShield<std::atomic<std::size_t>> enqueue_pos_{0};
+  InterferenceShield<std::atomic<std::size_t>> dequeue_pos_{0};
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
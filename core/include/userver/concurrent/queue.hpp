@@ -1,16 +1,19 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <limits>
 #include <memory>
 
 #include <moodycamel/concurrentqueue.h>
 
+#include <userver/concurrent/impl/bounded_ring_buffer.hpp>
 #include <userver/concurrent/impl/semaphore_capacity_control.hpp>
 #include <userver/concurrent/queue_helpers.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/semaphore.hpp>
 #include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/atomic.hpp>
@@ -30,6 +33,7 @@ struct SimpleQueuePolicy {
 
   static constexpr bool kIsMultipleProducer{MultipleProducer};
   static constexpr bool kIsMultipleConsumer{MultipleConsumer};
+  static constexpr bool kIsBounded{false};
 };
 
 template <bool MultipleProducer, bool MultipleConsumer>
@@ -41,6 +45,24 @@ struct ContainerQueuePolicy {
 
   static constexpr bool kIsMultipleProducer{MultipleProducer};
   static constexpr bool kIsMultipleConsumer{MultipleConsumer};
+  static constexpr bool kIsBounded{false};
+};
+
+// Stores the elements in a fixed-capacity ring buffer instead of
+// moodycamel::ConcurrentQueue
+template <bool MultipleProducer, bool MultipleConsumer>
+struct BoundedQueuePolicy {
+  template <typename T>
+  static constexpr std::size_t GetElementSize(const T&) {
+    return 1;
+  }
+
+  static constexpr bool kIsMultipleProducer{MultipleProducer};
+  static constexpr bool kIsMultipleConsumer{MultipleConsumer};
+  static constexpr bool kIsBounded{true};
+
+  // Capacity of the queues created without an explicit max size
+  static constexpr std::size_t kDefaultCapacity{1024};
 };
 
 }  // namespace impl
@@ -56,19 +78,27 @@ class GenericQueue final
     explicit EmplaceEnabler() = default;
   };
 
+  static constexpr bool kUsesMoodycamelTokens =
+      QueuePolicy::kIsMultipleProducer && !QueuePolicy::kIsBounded;
+
+  using Storage =
+      std::conditional_t<QueuePolicy::kIsBounded, impl::BoundedRingBuffer<T>,
+                         moodycamel::ConcurrentQueue<T>>;
+
   using ProducerToken =
-      std::conditional_t<QueuePolicy::kIsMultipleProducer,
-                         moodycamel::ProducerToken, impl::NoToken>;
+      std::conditional_t<kUsesMoodycamelTokens, moodycamel::ProducerToken,
+                         impl::NoToken>;
   using ConsumerToken =
-      std::conditional_t<QueuePolicy::kIsMultipleProducer,
-                         moodycamel::ConsumerToken, impl::NoToken>;
+      std::conditional_t<kUsesMoodycamelTokens, moodycamel::ConsumerToken,
+                         impl::NoToken>;
   using MultiProducerToken = impl::MultiToken;
   using MultiConsumerToken =
       std::conditional_t<QueuePolicy::kIsMultipleProducer, impl::MultiToken,
                          impl::NoToken>;
 
   using SingleProducerToken =
-      std::conditional_t<!QueuePolicy::kIsMultipleProducer,
+      std::conditional_t<!QueuePolicy::kIsMultipleProducer &&
+                             !QueuePolicy::kIsBounded,
                          moodycamel::ProducerToken, impl::NoToken>;
 
   friend class Producer<GenericQueue, ProducerToken, EmplaceEnabler>;
@@ -94,9 +124,9 @@ class GenericQueue final
   /// @cond
   // For internal use only
   explicit GenericQueue(std::size_t max_size, EmplaceEnabler /*unused*/)
-      : queue_(),
+      : queue_(MakeStorage(max_size)),
         single_producer_token_(queue_),
-        producer_side_(*this, std::min(max_size, kUnbounded)),
+        producer_side_(*this, ClampMaxSize(max_size)),
         consumer_side_(*this) {}
 
   ~GenericQueue() {
@@ -108,10 +138,13 @@ class GenericQueue final
       consumer_side_.ResumeBlockingOnPop();
     }
 
-    // Clear remaining items in queue
-    T value;
-    ConsumerToken token{queue_};
-    while (consumer_side_.PopNoblock(token, value)) {
+    // Clear remaining items in queue. The bounded storage destroys its
+    // elements in place and does not require T to be default-constructible.
+    if constexpr (!QueuePolicy::kIsBounded) {
+      T value;
+      ConsumerToken token{queue_};
+      while (consumer_side_.PopNoblock(token, value)) {
+      }
     }
   }
 
@@ -122,6 +155,9 @@ class GenericQueue final
   /// @endcond
 
   /// Create a new queue
+  ///
+  /// For the bounded queues `max_size` also sets the capacity of the
+  /// preallocated storage, see concurrent::BoundedMpmcQueue.
   static std::shared_ptr<GenericQueue> Create(
       std::size_t max_size = kUnbounded) {
     return std::make_shared<GenericQueue>(max_size, EmplaceEnabler{});
@@ -183,8 +219,10 @@ class GenericQueue final
 
   /// @brief Sets the limit on the queue size, pushes over this limit will block
   /// @note This is a soft limit and may be slightly overrun under load.
+  /// @note For the bounded queues the limit may not exceed the capacity
+  /// set on creation, larger values are clamped.
   void SetSoftMaxSize(std::size_t max_size) {
-    producer_side_.SetSoftMaxSize(std::min(max_size, kUnbounded));
+    producer_side_.SetSoftMaxSize(ClampMaxSize(max_size));
   }
 
   /// @brief Gets the limit on the queue size
@@ -213,6 +251,23 @@ class GenericQueue final
       std::conditional_t<QueuePolicy::kIsMultipleConsumer, MultiConsumerSide,
                          SingleConsumerSide>;
 
+  static Storage MakeStorage(std::size_t max_size) {
+    if constexpr (QueuePolicy::kIsBounded) {
+      return Storage(max_size >= kUnbounded ? QueuePolicy::kDefaultCapacity
+                                            : max_size);
+    } else {
+      return Storage{};
+    }
+  }
+
+  std::size_t ClampMaxSize(std::size_t max_size) const {
+    if constexpr (QueuePolicy::kIsBounded) {
+      return std::min(max_size, queue_.GetCapacity());
+    } else {
+      return std::min(max_size, kUnbounded);
+    }
+  }
+
   template <typename Token>
   [[nodiscard]] bool Push(Token& token, T&& value, engine::Deadline deadline) {
     return producer_side_.Push(token, std::move(value), deadline);
@@ -291,7 +346,14 @@ class GenericQueue final
  private:
   template <typename Token>
   void DoPush(Token& token, T&& value) {
-    if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
+    if constexpr (QueuePolicy::kIsBounded) {
+      // The queue size is limited by the producer side, so the buffer is only
+      // full while the cell is held by a consumer that claimed an older
+      // position and has not moved the element out yet
+      while (!queue_.TryPush(std::move(value))) {
+        engine::Yield();
+      }
+    } else if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
       static_assert(QueuePolicy::kIsMultipleProducer);
       queue_.enqueue(token, std::move(value));
     } else if constexpr (std::is_same_v<Token, MultiProducerToken>) {
@@ -310,7 +372,9 @@ class GenericQueue final
   [[nodiscard]] bool DoPop(Token& token, T& value) {
     bool success{};
 
-    if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
+    if constexpr (QueuePolicy::kIsBounded) {
+      success = queue_.TryPop(value);
+    } else if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
       static_assert(QueuePolicy::kIsMultipleProducer);
       success = queue_.try_dequeue(token, value);
     } else if constexpr (std::is_same_v<Token, impl::MultiToken>) {
@@ -330,7 +394,7 @@ class GenericQueue final
     return false;
   }
 
-  moodycamel::ConcurrentQueue<T> queue_{1};
+  Storage queue_;
   std::atomic<std::size_t> consumers_count_{0};
   std::atomic<std::size_t> producers_count_{0};
 
@@ -656,6 +720,33 @@ using SpscQueue = GenericQueue<T, impl::SimpleQueuePolicy<false, false>>;
 using StringStreamQueue =
     GenericQueue<std::string, impl::ContainerQueuePolicy<false, false>>;
 
+/// @ingroup userver_concurrency
+///
+/// @brief FIFO multiple producers multiple consumers queue of a fixed
+/// capacity.
+///
+/// The elements are stored in a ring buffer, that is allocated on creation
+/// for `max_size` elements (1024 if it is not specified). The queue does not
+/// allocate memory afterwards, and the max size may not be raised above the
+/// initial capacity.
+///
+/// Compared to concurrent::NonFifoMpmcQueue, the queue has a predictable
+/// memory footprint and keeps the FIFO order between producers. Pushes block
+/// when the queue is full, pops block when it is empty.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedMpmcQueue = GenericQueue<T, impl::BoundedQueuePolicy<true, true>>;
+
+/// @ingroup userver_concurrency
+///
+/// @brief FIFO multiple producers single consumer queue of a fixed capacity.
+///
+/// @see concurrent::BoundedMpmcQueue
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedMpscQueue = GenericQueue<T, impl::BoundedQueuePolicy<true, false>>;
+
 }  // namespace concurrent
 
 USERVER_NAMESPACE_END
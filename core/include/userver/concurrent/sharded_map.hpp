@@ -0,0 +1,587 @@
+#pragma once
+
+/// @file userver/concurrent/sharded_map.hpp
+/// @brief @copybrief concurrent::ShardedMap
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// Default ShardedMap traits.
+/// Member types:
+/// - `Hash` is a functor type that returns hash value for `Key`
+/// - `KeyEqual` is a functor type that provides equality test for two values
+///   of type `Key`
+/// - `MutexType` is a mutex type used to protect the shards on modification
+template <typename Key, typename Value>
+struct DefaultShardedMapTraits {
+  using Hash = std::hash<Key>;
+  using KeyEqual = std::equal_to<Key>;
+  using MutexType = engine::Mutex;
+};
+
+/// Size statistics of a ShardedMap
+struct ShardedMapStatistics final {
+  /// Number of the elements
+  std::size_t size{0};
+  /// Number of the elements in the largest shard
+  std::size_t max_shard_size{0};
+  /// Number of the shards
+  std::size_t shards{0};
+  /// Total number of the hash table buckets of all the shards
+  std::size_t buckets{0};
+  /// Number of the removed elements and hash tables that are not destroyed
+  /// yet, because readers might still use them
+  std::size_t retired{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ShardedMapStatistics& stats);
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Concurrent hash map with lock-free reads and per-shard writes
+///
+/// Keys are distributed between shards by their hash. Each shard is a hash
+/// table with separate chaining, modified under the mutex of the shard.
+/// Readers do not take any locks: they pin the global epoch of the
+/// epoch-based reclamation (see rcu::EpochReclamation) and walk the chain of
+/// the key. Removed elements and replaced hash tables are destroyed by writers
+/// once the readers are gone.
+///
+/// In contrast to rcu::RcuMap, inserting or erasing a key costs O(1)
+/// amortized and only blocks the writers of the same shard. A shard table
+/// grows twice when the shard size exceeds the number of its buckets.
+///
+/// Values are stored in `shared_ptr`s and are not copied. No synchronization
+/// is provided for value access, it must be implemented by Value when
+/// necessary.
+///
+/// ## Example usage:
+///
+/// @snippet concurrent/sharded_map_test.cpp  Sample ShardedMap usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename Key, typename Value,
+          typename Traits = DefaultShardedMapTraits<Key, Value>>
+class ShardedMap final {
+ public:
+  static_assert(!std::is_reference_v<Key>);
+  static_assert(!std::is_reference_v<Value>);
+  static_assert(!std::is_const_v<Key>);
+
+  using Hash = typename Traits::Hash;
+  using KeyEqual = typename Traits::KeyEqual;
+  using MutexType = typename Traits::MutexType;
+  using ValuePtr = std::shared_ptr<Value>;
+  using ConstValuePtr = std::shared_ptr<const Value>;
+  using Snapshot = std::unordered_map<Key, ConstValuePtr, Hash, KeyEqual>;
+
+  struct InsertReturnType {
+    ValuePtr value;
+    bool inserted;
+  };
+
+  static constexpr std::size_t kDefaultShards = 64;
+
+  /// @param shards the number of shards, rounded up to a power of two.
+  /// More shards mean less contention between writers.
+  explicit ShardedMap(std::size_t shards = kDefaultShards);
+
+  ShardedMap(const ShardedMap&) = delete;
+  ShardedMap(ShardedMap&&) = delete;
+  ShardedMap& operator=(const ShardedMap&) = delete;
+  ShardedMap& operator=(ShardedMap&&) = delete;
+
+  ~ShardedMap();
+
+  /// @brief Returns a readonly value pointer by its key or an empty pointer.
+  /// Lock-free.
+  ConstValuePtr Get(const Key& key) const;
+
+  /// @brief Returns a modifiable value pointer by its key or an empty pointer.
+  /// Lock-free.
+  ValuePtr Get(const Key& key);
+
+  /// @brief Returns whether the key is present. Lock-free.
+  bool Contains(const Key& key) const;
+
+  /// @brief Inserts a new element into the container if there is no element
+  /// with the key in the container.
+  /// Returns a pair consisting of a pointer to the inserted element, or the
+  /// already-existing element if no insertion happened, and a bool denoting
+  /// whether the insertion took place.
+  InsertReturnType Insert(const Key& key, ValuePtr value);
+
+  /// @brief Inserts a new element into the container constructed in-place
+  /// with the given args if there is no element with the key in the
+  /// container. The value is not constructed if the key is present.
+  /// @see Insert
+  template <typename... Args>
+  InsertReturnType Emplace(const Key& key, Args&&... args);
+
+  /// @brief If a key equivalent to `key` already exists in the container,
+  /// replaces the associated value. Otherwise, inserts a new pair into the map.
+  void InsertOrAssign(const Key& key, ValuePtr value);
+
+  /// @brief Removes a key from the map
+  /// @returns whether the key was present
+  bool Erase(const Key& key);
+
+  /// @brief Removes a key from the map returning its value
+  /// @returns a value if the key was present, empty pointer otherwise
+  ValuePtr Pop(const Key& key);
+
+  /// Removes all the elements
+  void Clear();
+
+  /// Returns an estimated size of the map at some point in time
+  std::size_t SizeApprox() const;
+
+  /// @brief Returns a readonly copy of the map.
+  /// @details Each shard is copied under its mutex, so the copy of a shard is
+  /// consistent, but the shards are copied at different points in time.
+  Snapshot GetSnapshot() const;
+
+  /// @brief Calls `func(const Key&, const ConstValuePtr&)` for all the
+  /// elements of a snapshot of each shard.
+  /// @see GetSnapshot
+  template <typename Func>
+  void VisitAll(Func func) const;
+
+  /// Returns the size statistics of the map
+  ShardedMapStatistics GetStatistics() const;
+
+  /// @brief Destroys the removed elements that are not used by readers
+  /// anymore.
+  /// @details It is done on modifications of a shard, so the call is only
+  /// useful if the map is not modified for a long time.
+  void Cleanup();
+
+ private:
+  struct Node;
+  struct Table;
+  struct Shard;
+
+  static std::size_t MixHash(std::size_t hash) noexcept;
+
+  std::size_t HashOf(const Key& key) const;
+  Shard& GetShard(std::size_t hash) const;
+
+  Node* Find(const Key& key, std::size_t hash) const;
+  std::atomic<Node*>* FindLink(Table& table, const Key& key,
+                               std::size_t hash) const;
+
+  template <typename ValueFactory>
+  InsertReturnType DoInsert(const Key& key, ValueFactory&& factory);
+
+  void Link(Shard& shard, std::unique_ptr<Node> node);
+  void ReplaceTable(Shard& shard, std::unique_ptr<Table> table);
+  static std::uint64_t GetRetireEpoch();
+  void Retire(Shard& shard, std::unique_ptr<Node> node);
+  void Reclaim(Shard& shard);
+
+  Hash hash_;
+  KeyEqual equal_;
+  std::size_t shard_shift_;
+  mutable utils::FixedArray<Shard> shards_;
+};
+
+template <typename Key, typename Value, typename Traits>
+struct ShardedMap<Key, Value, Traits>::Node final {
+  Node(const Key& key, std::size_t hash, ValuePtr value, Node* next)
+      : key(key), hash(hash), value(std::move(value)), next(next) {}
+
+  const Key key;
+  const std::size_t hash;
+  const ValuePtr value;
+  // Changed under the shard mutex, read by the lock-free readers
+  std::atomic<Node*> next;
+};
+
+template <typename Key, typename Value, typename Traits>
+struct ShardedMap<Key, Value, Traits>::Table final {
+  explicit Table(std::size_t size)
+      : buckets(std::make_unique<std::atomic<Node*>[]>(size)),
+        mask(size - 1) {}
+
+  ~Table() {
+    if (!owns_nodes) return;
+    for (std::size_t i = 0; i < Size(); ++i) {
+      auto* node = buckets[i].load();
+      while (node) {
+        std::unique_ptr<Node> node_holder{node};
+        node = node->next.load();
+      }
+    }
+  }
+
+  void Insert(Node* node) {
+    auto& bucket = GetBucket(node->hash);
+    node->next.store(bucket.load(), std::memory_order_relaxed);
+    bucket.store(node, std::memory_order_release);
+  }
+
+  std::atomic<Node*>& GetBucket(std::size_t hash) const {
+    return buckets[hash & mask];
+  }
+
+  std::size_t Size() const { return mask + 1; }
+
+  const std::unique_ptr<std::atomic<Node*>[]> buckets;
+  const std::size_t mask;
+  // Whether the nodes are destroyed together with the table
+  bool owns_nodes{false};
+};
+
+template <typename Key, typename Value, typename Traits>
+struct ShardedMap<Key, Value, Traits>::Shard final {
+  static constexpr std::size_t kInitialBuckets = 8;
+
+  struct Retired {
+    std::uint64_t epoch;
+    std::unique_ptr<Node> node;
+    std::unique_ptr<Table> table;
+  };
+
+  Shard() : table(new Table(kInitialBuckets)) {}
+
+  ~Shard() {
+    std::unique_ptr<Table> current{table.load()};
+    current->owns_nodes = true;
+  }
+
+  MutexType mutex;
+  std::atomic<Table*> table;
+  std::atomic<std::size_t> size{0};
+  // Protected by mutex
+  std::deque<Retired> retired;
+};
+
+template <typename Key, typename Value, typename Traits>
+ShardedMap<Key, Value, Traits>::ShardedMap(std::size_t shards)
+    : shard_shift_(0), shards_() {
+  std::size_t shard_bits = 0;
+  while ((std::size_t{1} << shard_bits) < shards) ++shard_bits;
+  UINVARIANT(shard_bits < 64, "Too many shards");
+
+  // Shards are selected by the high bits of the mixed hash, buckets - by
+  // the low ones
+  shard_shift_ = 64 - shard_bits;
+  shards_ = utils::FixedArray<Shard>(std::size_t{1} << shard_bits);
+}
+
+template <typename Key, typename Value, typename Traits>
+ShardedMap<Key, Value, Traits>::~ShardedMap() = default;
+
+template <typename Key, typename Value, typename Traits>
+std::size_t ShardedMap<Key, Value, Traits>::MixHash(std::size_t hash) noexcept {
+  // std::hash of integers is an identity function. The MurmurHash3 finalizer
+  // spreads every input bit to the high bits, that select the shard, and to
+  // the low bits, that select the bucket.
+  auto mixed = static_cast<std::uint64_t>(hash);
+  mixed ^= mixed >> 33;
+  mixed *= 0xFF51AFD7ED558CCDULL;
+  mixed ^= mixed >> 33;
+  mixed *= 0xC4CEB9FE1A85EC53ULL;
+  mixed ^= mixed >> 33;
+  return static_cast<std::size_t>(mixed);
+}
+
+template <typename Key, typename Value, typename Traits>
+std::size_t ShardedMap<Key, Value, Traits>::HashOf(const Key& key) const {
+  return MixHash(hash_(key));
+}
+
+template <typename Key, typename Value, typename Traits>
+auto ShardedMap<Key, Value, Traits>::GetShard(std::size_t hash) const
+    -> Shard& {
+  // Shift by 64 is UB, so the single shard case is handled separately
+  return shards_[shard_shift_ == 64 ? 0 : hash >> shard_shift_];
+}
+
+template <typename Key, typename Value, typename Traits>
+auto ShardedMap<Key, Value, Traits>::Find(const Key& key,
+                                          std::size_t hash) const -> Node* {
+  const auto* table = GetShard(hash).table.load(std::memory_order_acquire);
+  auto* node = table->GetBucket(hash).load(std::memory_order_acquire);
+  while (node) {
+    if (node->hash == hash && equal_(node->key, key)) return node;
+    node = node->next.load(std::memory_order_acquire);
+  }
+  return nullptr;
+}
+
+template <typename Key, typename Value, typename Traits>
+auto ShardedMap<Key, Value, Traits>::FindLink(Table& table, const Key& key,
+                                              std::size_t hash) const
+    -> std::atomic<Node*>* {
+  auto* link = &table.GetBucket(hash);
+  for (auto* node = link->load(); node; node = link->load()) {
+    if (node->hash == hash && equal_(node->key, key)) return link;
+    link = &node->next;
+  }
+  return nullptr;
+}
+
+template <typename Key, typename Value, typename Traits>
+auto ShardedMap<Key, Value, Traits>::Get(const Key& key) const
+    -> ConstValuePtr {
+  const auto hash = HashOf(key);
+  const auto lock = rcu::impl::EpochReadLock::Acquire();
+  const auto* node = Find(key, hash);
+  return node ? node->value : nullptr;
+}
+
+template <typename Key, typename Value, typename Traits>
+auto ShardedMap<Key, Value, Traits>::Get(const Key& key) -> ValuePtr {
+  const auto hash = HashOf(key);
+  const auto lock = rcu::impl::EpochReadLock::Acquire();
+  const auto* node = Find(key, hash);
+  return node ? node->value : nullptr;
+}
+
+template <typename Key, typename Value, typename Traits>
+bool ShardedMap<Key, Value, Traits>::Contains(const Key& key) const {
+  const auto hash = HashOf(key);
+  const auto lock = rcu::impl::EpochReadLock::Acquire();
+  return Find(key, hash) != nullptr;
+}
+
+template <typename Key, typename Value, typename Traits>
+auto ShardedMap<Key, Value, Traits>::Insert(const Key& key, ValuePtr value)
+    -> InsertReturnType {
+  return DoInsert(key, [&value] { return std::move(value); });
+}
+
+template <typename Key, typename Value, typename Traits>
+template <typename... Args>
+auto ShardedMap<Key, Value, Traits>::Emplace(const Key& key, Args&&... args)
+    -> InsertReturnType {
+  return DoInsert(key, [&] {
+    return std::make_shared<Value>(std::forward<Args>(args)...);
+  });
+}
+
+template <typename Key, typename Value, typename Traits>
+template <typename ValueFactory>
+auto ShardedMap<Key, Value, Traits>::DoInsert(const Key& key,
+                                              ValueFactory&& factory)
+    -> InsertReturnType {
+  const auto hash = HashOf(key);
+  auto& shard = GetShard(hash);
+
+  std::lock_guard lock(shard.mutex);
+  auto* link = FindLink(*shard.table.load(), key, hash);
+  if (link) return {link->load()->value, false};
+
+  auto value = factory();
+  Link(shard, std::make_unique<Node>(key, hash, value, nullptr));
+  Reclaim(shard);
+  return {std::move(value), true};
+}
+
+template <typename Key, typename Value, typename Traits>
+void ShardedMap<Key, Value, Traits>::InsertOrAssign(const Key& key,
+                                                    ValuePtr value) {
+  const auto hash = HashOf(key);
+  auto& shard = GetShard(hash);
+
+  std::lock_guard lock(shard.mutex);
+  auto* link = FindLink(*shard.table.load(), key, hash);
+  if (!link) {
+    Link(shard, std::make_unique<Node>(key, hash, std::move(value), nullptr));
+  } else {
+    // Nodes are immutable for the readers, replace the whole node
+    std::unique_ptr<Node> old_node{link->load()};
+    link->store(new Node(key, hash, std::move(value), old_node->next.load()),
+                std::memory_order_release);
+    Retire(shard, std::move(old_node));
+  }
+  Reclaim(shard);
+}
+
+template <typename Key, typename Value, typename Traits>
+bool ShardedMap<Key, Value, Traits>::Erase(const Key& key) {
+  return Pop(key) != nullptr;
+}
+
+template <typename Key, typename Value, typename Traits>
+auto ShardedMap<Key, Value, Traits>::Pop(const Key& key) -> ValuePtr {
+  const auto hash = HashOf(key);
+  auto& shard = GetShard(hash);
+
+  std::lock_guard lock(shard.mutex);
+  auto* link = FindLink(*shard.table.load(), key, hash);
+  if (!link) return nullptr;
+
+  // Readers standing at the node may still go further by its next pointer
+  std::unique_ptr<Node> node{link->load()};
+  link->store(node->next.load(), std::memory_order_release);
+  shard.size.fetch_sub(1, std::memory_order_relaxed);
+
+  auto value = node->value;
+  Retire(shard, std::move(node));
+  Reclaim(shard);
+  return value;
+}
+
+template <typename Key, typename Value, typename Traits>
+void ShardedMap<Key, Value, Traits>::Clear() {
+  for (auto& shard : shards_) {
+    std::lock_guard lock(shard.mutex);
+    ReplaceTable(shard, std::make_unique<Table>(Shard::kInitialBuckets));
+    shard.size.store(0, std::memory_order_relaxed);
+    Reclaim(shard);
+  }
+}
+
+template <typename Key, typename Value, typename Traits>
+std::size_t ShardedMap<Key, Value, Traits>::SizeApprox() const {
+  std::size_t size = 0;
+  for (const auto& shard : shards_) {
+    size += shard.size.load(std::memory_order_relaxed);
+  }
+  return size;
+}
+
+template <typename Key, typename Value, typename Traits>
+auto ShardedMap<Key, Value, Traits>::GetSnapshot() const -> Snapshot {
+  Snapshot snapshot;
+  snapshot.reserve(SizeApprox());
+  VisitAll([&snapshot](const Key& key, const ConstValuePtr& value) {
+    snapshot.emplace(key, value);
+  });
+  return snapshot;
+}
+
+template <typename Key, typename Value, typename Traits>
+template <typename Func>
+void ShardedMap<Key, Value, Traits>::VisitAll(Func func) const {
+  for (auto& shard : shards_) {
+    // Nodes are not destroyed while the mutex is locked, so the keys can be
+    // referenced until the end of the iteration
+    std::lock_guard lock(shard.mutex);
+    const auto* table = shard.table.load();
+    for (std::size_t i = 0; i < table->Size(); ++i) {
+      for (auto* node = table->buckets[i].load(); node;
+           node = node->next.load()) {
+        func(node->key, ConstValuePtr{node->value});
+      }
+    }
+  }
+}
+
+template <typename Key, typename Value, typename Traits>
+ShardedMapStatistics ShardedMap<Key, Value, Traits>::GetStatistics() const {
+  ShardedMapStatistics stats;
+  stats.shards = shards_.size();
+  for (auto& shard : shards_) {
+    std::lock_guard lock(shard.mutex);
+    const auto size = shard.size.load(std::memory_order_relaxed);
+    stats.size += size;
+    stats.max_shard_size = std::max(stats.max_shard_size, size);
+    stats.buckets += shard.table.load()->Size();
+    stats.retired += shard.retired.size();
+  }
+  return stats;
+}
+
+template <typename Key, typename Value, typename Traits>
+void ShardedMap<Key, Value, Traits>::Cleanup() {
+  for (auto& shard : shards_) {
+    std::unique_lock lock(shard.mutex, std::try_to_lock);
+    // Someone is already changing the shard and will reclaim it
+    if (!lock.owns_lock()) continue;
+    Reclaim(shard);
+  }
+}
+
+template <typename Key, typename Value, typename Traits>
+void ShardedMap<Key, Value, Traits>::Link(Shard& shard,
+                                          std::unique_ptr<Node> node) {
+  auto* table = shard.table.load();
+  const auto size = shard.size.load(std::memory_order_relaxed) + 1;
+
+  if (size > table->Size()) {
+    // Readers keep walking the old table, so the nodes are copied to the new
+    // one. The copies are destroyed with the new table if copying throws.
+    auto new_table = std::make_unique<Table>(table->Size() * 2);
+    new_table->owns_nodes = true;
+    for (std::size_t i = 0; i < table->Size(); ++i) {
+      for (auto* old = table->buckets[i].load(); old;
+           old = old->next.load()) {
+        new_table->Insert(new Node(old->key, old->hash, old->value, nullptr));
+      }
+    }
+    new_table->Insert(node.release());
+    ReplaceTable(shard, std::move(new_table));
+  } else {
+    table->Insert(node.release());
+  }
+
+  shard.size.store(size, std::memory_order_relaxed);
+}
+
+template <typename Key, typename Value, typename Traits>
+void ShardedMap<Key, Value, Traits>::ReplaceTable(
+    Shard& shard, std::unique_ptr<Table> table) {
+  // The record is allocated beforehand, as nothing may throw after the new
+  // table is published. The old nodes are only reachable through the old
+  // table, so they are retired together with it only after that.
+  auto& retired = shard.retired.emplace_back();
+  table->owns_nodes = false;
+  auto* old_table = shard.table.exchange(table.release());
+  old_table->owns_nodes = true;
+  retired.table.reset(old_table);
+  retired.epoch = GetRetireEpoch();
+}
+
+template <typename Key, typename Value, typename Traits>
+std::uint64_t ShardedMap<Key, Value, Traits>::GetRetireEpoch() {
+  // Readers that pin a later epoch do not see the unlinked node or table.
+  // The unlinking stores are release only, so without the fence the epoch
+  // load could be reordered before them, and a reader pinning that epoch
+  // could still reach the node.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  return rcu::impl::GetGlobalEpoch();
+}
+
+template <typename Key, typename Value, typename Traits>
+void ShardedMap<Key, Value, Traits>::Retire(Shard& shard,
+                                            std::unique_ptr<Node> node) {
+  shard.retired.push_back({GetRetireEpoch(), std::move(node), nullptr});
+}
+
+template <typename Key, typename Value, typename Traits>
+void ShardedMap<Key, Value, Traits>::Reclaim(Shard& shard) {
+  if (shard.retired.empty()) return;
+
+  const auto completed_epoch = rcu::impl::TryAdvanceGlobalEpoch();
+  while (!shard.retired.empty() &&
+         shard.retired.front().epoch <= completed_epoch) {
+    shard.retired.pop_front();
+  }
+}
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
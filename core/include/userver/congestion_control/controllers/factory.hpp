@@ -0,0 +1,25 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <userver/congestion_control/controllers/linear_config.hpp>
+#include <userver/congestion_control/controllers/v2.hpp>
+#include <userver/congestion_control/limiter.hpp>
+#include <userver/dynamic_config/source.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+/// Creates the controller of the `config.algorithm` type
+std::unique_ptr<Controller> MakeController(
+    const std::string& name, v2::Sensor& sensor, Limiter& limiter,
+    Stats& stats, const Controller::Config& config,
+    dynamic_config::Source config_source,
+    std::function<v2::Config(const dynamic_config::Snapshot&)> config_getter);
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+
+#include <userver/congestion_control/controllers/linear_config.hpp>
+#include <userver/congestion_control/controllers/v2.hpp>
+#include <userver/congestion_control/limiter.hpp>
+#include <userver/dynamic_config/source.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+/// @brief Controller that adjusts the limit by the latency gradient
+///
+/// The controller learns the no-load timings of the resource while the load is
+/// not limited and compares the current timings with them. While the timings
+/// stay within `gradient-tolerance` times the no-load ones, the limit grows by
+/// its square root per step. Otherwise the limit is multiplied by the ratio of
+/// the timings, as with the same throughput the timings are proportional to
+/// the load:
+///
+///     gradient = clamp(tolerance * no_load_timings / timings, 0.5, 1)
+///     new_limit = limit * gradient + (gradient == 1 ? sqrt(limit) : 0)
+///
+/// The change is smoothed between steps, so the limit converges to the load
+/// the resource handles without queueing instead of oscillating around it.
+/// Error rate above `errors-threshold-percent` uses the minimal gradient.
+///
+/// The limit is reset once the load is below it by `deactivate-delta`. If the
+/// timings stay high at `min-limit`, the resource got slower rather than
+/// overloaded, and the no-load timings are updated.
+///
+/// Compared to LinearController, it reacts within seconds and holds the limit
+/// near the load with the best goodput instead of a sawtooth around it.
+class GradientController final : public Controller {
+ public:
+  using StaticConfig = Controller::Config;
+
+  GradientController(
+      const std::string& name, v2::Sensor& sensor, Limiter& limiter,
+      Stats& stats, const StaticConfig& config,
+      dynamic_config::Source config_source,
+      std::function<v2::Config(const dynamic_config::Snapshot&)> config_getter);
+
+  Limit Update(const Sensor::Data& current) override;
+
+ private:
+  void UpdateNoLoadTimings(double timings);
+
+  std::optional<double> limit_;
+  double no_load_timings_{0};
+  std::size_t epochs_passed_{0};
+
+  dynamic_config::Source config_source_;
+  std::function<v2::Config(const dynamic_config::Snapshot&)> config_getter_;
+};
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -16,6 +16,7 @@ struct Config {
   std::chrono::milliseconds min_timings{20};
   std::size_t min_limit{10};
   std::size_t min_qps{10};
+  double gradient_tolerance{1.5};
 };
 
 Config Parse(const formats::json::Value& value, formats::parse::To<Config>);
@@ -21,11 +21,18 @@ struct Stats {
 
 void DumpMetric(utils::statistics::Writer& writer, const Stats& stats);
 
+/// The algorithm that computes the limit
+enum class Algorithm {
+  kLinear,    ///< congestion_control::v2::LinearController
+  kGradient,  ///< congestion_control::v2::GradientController
+};
+
 class Controller {
  public:
   struct Config {
     bool fake_mode{false};
     bool enabled{true};
+    Algorithm algorithm{Algorithm::kLinear};
   };
 
   Controller(const std::string& name, v2::Sensor& sensor, Limiter& limiter,
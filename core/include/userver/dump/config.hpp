@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -20,6 +21,15 @@ std::chrono::milliseconds ParseMs(
     std::optional<std::chrono::milliseconds> default_value = {});
 }
 
+/// Compression of the dump data, applied before the encryption
+enum class Compression : std::uint8_t {
+  kNone,
+  kZlib,
+};
+
+Compression Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<Compression>);
+
 extern const std::string_view kDump;
 extern const std::string_view kMaxDumpAge;
 extern const std::string_view kMinDumpInterval;
@@ -45,6 +55,8 @@ struct Config final {
   std::optional<std::chrono::milliseconds> max_dump_age;
   bool max_dump_age_set;
   bool dump_is_encrypted;
+  Compression compression;
+  bool memory_mapped;
 
   bool static_dumps_enabled;
   std::chrono::milliseconds static_min_dump_interval;
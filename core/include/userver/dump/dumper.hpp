@@ -85,6 +85,8 @@ enum class UpdateType {
 /// `min-interval` | `string` (duration) | `WriteDumpAsync` calls performed in a fast succession are ignored | `0s`
 /// `fs-task-processor` | `string` | `TaskProcessor` for blocking disk IO | `fs-task-processor`
 /// `encrypted` | `boolean` | Whether to encrypt the dump | `false`
+/// `compression` | `string` | Compression of the dump data, `none` or `zlib`; changing it makes the previous dumps unreadable | `none`
+/// `memory-mapped` | `boolean` | Whether to read the dump by mapping it into memory, so that dump::FlatArray data is used without deserialization; incompatible with `encrypted` and `compression` | `false`
 ///
 /// ## Sample usage
 /// @snippet core/src/dump/dumper_test.cpp  Sample Dumper usage
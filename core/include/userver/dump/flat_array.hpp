@@ -0,0 +1,144 @@
+#pragma once
+
+/// @file userver/dump/flat_array.hpp
+/// @brief @copybrief dump::FlatArray
+///
+/// @ingroup userver_dump_read_write
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/dump/unsafe.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief A read-only array of trivially copyable values, which is read from
+/// a memory-mapped dump without deserialization
+///
+/// With `memory-mapped: true` in the dump config, `Read` returns a view of the
+/// dump file mapping, so the cache starts without per-element work and the
+/// pages are shared between processes on the same host. Otherwise, or if the
+/// values are misaligned in the file, they are copied. The mapping is aligned
+/// for the array that is the first thing in the dump, e.g. the cache data.
+///
+/// Sort the values to look them up by `std::lower_bound`.
+///
+/// @note The values are stored with the native layout of `T`, bump the
+/// `format-version` of the dump on changes of `T`.
+template <typename T>
+class FlatArray final {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "FlatArray values are stored in the dump as raw memory");
+
+ public:
+  using value_type = T;
+  using const_iterator = const T*;
+  using iterator = const_iterator;
+
+  FlatArray() = default;
+
+  explicit FlatArray(std::vector<T> values);
+
+  /// @cond
+  // For internal use only
+  FlatArray(std::shared_ptr<const T> data, std::size_t size)
+      : data_(std::move(data)), size_(size) {}
+  /// @endcond
+
+  const T* data() const noexcept { return data_.get(); }
+  std::size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  const_iterator begin() const noexcept { return data(); }
+  const_iterator end() const noexcept { return data() + size_; }
+
+  const T& operator[](std::size_t index) const noexcept {
+    return data_.get()[index];
+  }
+
+ private:
+  std::shared_ptr<const T> data_;
+  std::size_t size_{0};
+};
+
+template <typename T>
+FlatArray<T>::FlatArray(std::vector<T> values) {
+  auto storage = std::make_shared<const std::vector<T>>(std::move(values));
+  const T* values_data = storage->data();
+  size_ = storage->size();
+  data_ = std::shared_ptr<const T>(std::move(storage), values_data);
+}
+
+template <typename T>
+bool operator==(const FlatArray<T>& lhs, const FlatArray<T>& rhs) {
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T>
+bool operator!=(const FlatArray<T>& lhs, const FlatArray<T>& rhs) {
+  return !(lhs == rhs);
+}
+
+namespace impl {
+
+/// Returns the next `size` bytes of a memory-mapped dump without copying, or
+/// `nullptr` if `reader` is not memory-mapped
+std::shared_ptr<const char> TryReadMapped(Reader& reader, std::size_t size);
+
+template <typename T>
+FlatArray<T> CopyFlatArray(const char* data, std::size_t size) {
+  std::vector<T> values(size);
+  if (size != 0) std::memcpy(values.data(), data, size * sizeof(T));
+  return FlatArray<T>(std::move(values));
+}
+
+}  // namespace impl
+
+/// @brief FlatArray serialization
+template <typename T>
+void Write(Writer& writer, const FlatArray<T>& value) {
+  // Fixed size keeps the values aligned after the start of the dump
+  impl::WriteTrivial(writer, static_cast<std::uint64_t>(value.size()));
+  WriteStringViewUnsafe(
+      writer, std::string_view{reinterpret_cast<const char*>(value.data()),
+                               value.size() * sizeof(T)});
+}
+
+/// @brief FlatArray deserialization
+template <typename T>
+FlatArray<T> Read(Reader& reader, To<FlatArray<T>>) {
+  const auto size = impl::ReadTrivial<std::uint64_t>(reader);
+  if (size > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+    throw Error("FlatArray size is too large");
+  }
+  const std::size_t byte_size = size * sizeof(T);
+
+  if (auto mapped = impl::TryReadMapped(reader, byte_size)) {
+    const auto* values = mapped.get();
+    if (reinterpret_cast<std::uintptr_t>(values) % alignof(T) != 0) {
+      return impl::CopyFlatArray<T>(values, size);
+    }
+    return FlatArray<T>(
+        std::shared_ptr<const T>(std::move(mapped),
+                                 reinterpret_cast<const T*>(values)),
+        size);
+  }
+
+  return impl::CopyFlatArray<T>(ReadStringViewUnsafe(reader, byte_size).data(),
+                                size);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
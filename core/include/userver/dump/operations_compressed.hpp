@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+
+#include <userver/dump/config.hpp>
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/utils/fast_pimpl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// A `Writer` that compresses the data on the fly and passes it to `base`
+class CompressedWriter final : public Writer {
+ public:
+  /// @throws `Error` if the compressor could not be initialized
+  CompressedWriter(std::unique_ptr<Writer> base, Compression compression);
+
+  ~CompressedWriter() override;
+
+  void Finish() override;
+
+ private:
+  void WriteRaw(std::string_view data) override;
+
+  struct Impl;
+  utils::FastPimpl<Impl, 152, 8> impl_;
+};
+
+/// A `Reader` that decompresses the data from `base` on the fly, without
+/// reading the whole dump into memory
+class CompressedReader final : public Reader {
+ public:
+  /// @throws `Error` if the decompressor could not be initialized
+  CompressedReader(std::unique_ptr<Reader> base, Compression compression);
+
+  ~CompressedReader() override;
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  struct Impl;
+  utils::FastPimpl<Impl, 160, 8> impl_;
+};
+
+/// Wraps the Readers and Writers of `base` to compress the dump data
+class CompressedOperationsFactory final : public OperationsFactory {
+ public:
+  CompressedOperationsFactory(std::unique_ptr<OperationsFactory> base,
+                              Compression compression);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  const std::unique_ptr<OperationsFactory> base_;
+  const Compression compression_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief A handle to a memory-mapped dump file
+///
+/// The file is mapped read-only and shared, so its pages are loaded lazily and
+/// shared through the page cache between processes on the same host. Unlike
+/// FileReader, the data is not copied into a buffer.
+///
+/// @warning Page faults block the thread on disk reads. The dump file must not
+/// be modified in place while it is mapped; `Dumper` only renames new dumps
+/// into place and removes old ones, which is safe.
+class MappedFileReader final : public Reader {
+ public:
+  /// @brief Maps an existing dump file
+  /// @throws `Error` on a filesystem error
+  explicit MappedFileReader(std::string path);
+
+  void Finish() override;
+
+  /// @brief Reads exactly `size` bytes without copying
+  /// @returns A pointer into the mapping that keeps the mapping alive, even
+  /// after the reader is destroyed
+  /// @throws `Error` on end-of-file
+  std::shared_ptr<const char> ReadMapped(std::size_t size);
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  std::string path_;
+  std::shared_ptr<const char> mapping_;
+  std::string_view data_;
+  std::string_view unread_data_;
+};
+
+/// Writes dumps with FileWriter and reads them with MappedFileReader
+class MappedFileOperationsFactory final : public OperationsFactory {
+ public:
+  explicit MappedFileOperationsFactory(boost::filesystem::perms perms);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  const boost::filesystem::perms perms_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,75 @@
+#pragma once
+
+/// @file userver/dump/parallel.hpp
+/// @brief Parallel dump serialization of sharded containers
+///
+/// @ingroup userver_dump_read_write
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <userver/dump/operations.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace impl {
+
+void WriteShardsParallel(
+    Writer& writer, std::size_t shard_count, std::size_t concurrency,
+    utils::function_ref<void(Writer&, std::size_t)> write_shard);
+
+void ReadShardsParallel(
+    Reader& reader, std::size_t concurrency,
+    utils::function_ref<void(std::size_t)> set_shard_count,
+    utils::function_ref<void(Reader&, std::size_t)> read_shard);
+
+}  // namespace impl
+
+/// @brief Writes the `shards` of a container, serializing up to `concurrency`
+/// shards in parallel tasks of the current task processor
+///
+/// Each shard is serialized into a separate chunk of the dump: the number of
+/// shards goes first, then each shard as a size-prefixed string. Only the
+/// chunks being serialized are kept in memory, they are written in order.
+///
+/// @note `shards` must be a random-access range, e.g. `std::vector`. Shards
+/// must not be modified until the function returns.
+/// @throws `Error` and any user-thrown `std::exception`
+template <typename Shards>
+void WriteShardsParallel(Writer& writer, const Shards& shards,
+                         std::size_t concurrency) {
+  impl::WriteShardsParallel(
+      writer, std::size(shards), concurrency,
+      [&shards](Writer& shard_writer, std::size_t index) {
+        shard_writer.Write(shards[index]);
+      });
+}
+
+/// @brief Reads shards written by `WriteShardsParallel`, deserializing up to
+/// `concurrency` shards in parallel tasks of the current task processor
+///
+/// The chunks are streamed from `reader`: only the chunks being deserialized
+/// are kept in memory.
+///
+/// @note `Shard` must be default-constructible
+/// @throws `Error` and any user-thrown `std::exception`
+template <typename Shard>
+std::vector<Shard> ReadShardsParallel(Reader& reader,
+                                      std::size_t concurrency) {
+  std::vector<Shard> shards;
+  impl::ReadShardsParallel(
+      reader, concurrency,
+      [&shards](std::size_t shard_count) { shards.resize(shard_count); },
+      [&shards](Reader& shard_reader, std::size_t index) {
+        shards[index] = shard_reader.Read<Shard>();
+      });
+  return shards;
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
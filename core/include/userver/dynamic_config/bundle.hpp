@@ -0,0 +1,109 @@
+#pragma once
+
+/// @file userver/dynamic_config/bundle.hpp
+/// @brief @copybrief dynamic_config::Bundle
+
+#include <functional>
+#include <string_view>
+#include <utility>
+
+#include <userver/concurrent/async_event_source.hpp>
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/dynamic_config/source.hpp>
+#include <userver/rcu/rcu.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dynamic_config {
+
+/// @ingroup userver_clients
+///
+/// @brief A struct of config values, that is built once per config update.
+///
+/// Each dynamic_config::Snapshot lookup costs a type-checked access to the
+/// type-erased storage of all the configs, and obtaining the snapshot itself
+/// costs an RCU read. Code that reads many configs on each request may instead
+/// declare a compact struct of the values it needs together with a function
+/// that builds the struct from a snapshot. `Bundle` calls the function once on
+/// construction and then on each config update, and publishes the result
+/// through rcu::Variable with the epoch-based reclamation, so reading the
+/// values is a single pointer load.
+///
+/// The struct may also store values that are derived from the configs, so
+/// that they are not recomputed on each request.
+///
+/// ## Example usage:
+/// @snippet dynamic_config/bundle_test.cpp  Sample dynamic_config::Bundle usage
+template <typename T>
+class Bundle final {
+ public:
+  using Factory = std::function<T(const Snapshot&)>;
+  using RcuTraits = rcu::EpochRcuTraits<T>;
+  using ReadablePtr = rcu::ReadablePtr<T, RcuTraits>;
+
+  /// Builds the value from the current config and subscribes to the updates
+  /// @param source the config source, usually obtained from
+  /// components::DynamicConfig
+  /// @param name the name of the subscriber, for diagnostic purposes
+  /// @param factory a function or a functor that builds the value from
+  /// a config snapshot
+  Bundle(Source source, std::string_view name, Factory factory);
+
+  Bundle(Bundle&&) = delete;
+  Bundle& operator=(Bundle&&) = delete;
+
+  ~Bundle();
+
+  /// @brief Returns the value that was built from the latest config
+  /// @warning Do not keep the pointer for long, as it delays the destruction
+  /// of old values, see rcu::EpochReclamation.
+  ReadablePtr Read() const { return value_.Read(); }
+
+  /// Returns a copy of the value that was built from the latest config
+  T ReadCopy() const { return value_.ReadCopy(); }
+
+ private:
+  Bundle(const Snapshot& config, Source source, std::string_view name,
+         Factory&& factory);
+
+  void OnConfigUpdate(const Diff& diff);
+
+  const Factory factory_;
+  rcu::Variable<T, RcuTraits> value_;
+  // Only set during the synchronous first call of OnConfigUpdate
+  const Snapshot* initial_config_{nullptr};
+  concurrent::AsyncEventSubscriberScope subscriber_;
+};
+
+template <typename T>
+Bundle<T>::Bundle(Source source, std::string_view name, Factory factory)
+    : Bundle(source.GetSnapshot(), source, name, std::move(factory)) {}
+
+template <typename T>
+Bundle<T>::Bundle(const Snapshot& config, Source source, std::string_view name,
+                  Factory&& factory)
+    : factory_(std::move(factory)), value_(factory_(config)) {
+  initial_config_ = &config;
+  subscriber_ = source.UpdateAndListen(this, name, &Bundle::OnConfigUpdate);
+  initial_config_ = nullptr;
+}
+
+template <typename T>
+Bundle<T>::~Bundle() {
+  subscriber_.Unsubscribe();
+}
+
+template <typename T>
+void Bundle<T>::OnConfigUpdate(const Diff& diff) {
+  // The value is already built, unless the config was updated before
+  // the subscription
+  if (!diff.previous && initial_config_ &&
+      diff.current.IsSameConfig(*initial_config_)) {
+    return;
+  }
+  value_.Assign(factory_(diff.current));
+}
+
+}  // namespace dynamic_config
+
+USERVER_NAMESPACE_END
@@ -155,6 +155,9 @@ class Snapshot final {
   // No longer supported, use `config[key]` instead
   template <typename T>
   const T& Get() &&;
+
+  // For internal use only. Whether both snapshots hold the same config update
+  bool IsSameConfig(const Snapshot& other) const noexcept;
   /// @endcond
 
  private:
@@ -0,0 +1,426 @@
+#pragma once
+
+/// @file userver/formats/json/aggregates.hpp
+/// @brief SAX serialization and parsing of aggregates without building
+/// a formats::json::Value
+///
+/// @ingroup userver_formats_serialize_sax
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/core_name.hpp>
+#include <boost/pfr/tuple_size.hpp>
+
+#include <userver/formats/json/parser/parser.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+/// @brief Marks an aggregate for SAX serialization and parsing
+///
+/// To enable WriteToStream and parser::AggregateParser for an aggregate,
+/// add in the global namespace:
+///
+/// @code
+/// template <>
+/// struct formats::json::IsJsonAggregate<MyStruct> {
+///   static constexpr std::string_view kNames[] = {"id", "name", "tags"};
+/// };
+/// @endcode
+///
+/// `kNames` are the JSON keys of the aggregate members in the order of
+/// declaration. When the field names reflection of Boost.PFR is available
+/// (C++20), the specialization may be declared without a definition and the
+/// member names are used as keys:
+///
+/// @code
+/// template <>
+/// struct formats::json::IsJsonAggregate<MyStruct>;
+/// @endcode
+template <typename T>
+struct IsJsonAggregate {};
+
+namespace impl {
+
+// The non-specialized IsJsonAggregate and the specializations with names are
+// complete, the specializations without names are declared without
+// a definition
+template <typename T>
+using IsNotJsonAggregateDeclaration = decltype(sizeof(IsJsonAggregate<T>));
+
+template <typename T>
+using JsonAggregateNames = decltype(IsJsonAggregate<T>::kNames);
+
+template <typename T>
+constexpr bool HasJsonAggregateNames() {
+  if constexpr (meta::kIsDetected<IsNotJsonAggregateDeclaration, T>) {
+    return meta::kIsDetected<JsonAggregateNames, T>;
+  } else {
+    return false;
+  }
+}
+
+template <typename T>
+constexpr bool IsJsonAggregateType() {
+  if constexpr (std::is_aggregate_v<T>) {
+    return !meta::kIsDetected<IsNotJsonAggregateDeclaration, T> ||
+           HasJsonAggregateNames<T>();
+  } else {
+    return false;
+  }
+}
+
+template <typename T>
+inline constexpr bool kIsJsonAggregate = IsJsonAggregateType<T>();
+
+template <typename T, std::size_t... Indices>
+constexpr auto MakeNames(std::index_sequence<Indices...>) {
+  if constexpr (HasJsonAggregateNames<T>()) {
+    static_assert(std::size(IsJsonAggregate<T>::kNames) == sizeof...(Indices),
+                  "The number of names in formats::json::IsJsonAggregate "
+                  "differs from the number of the aggregate members");
+    return std::array<std::string_view, sizeof...(Indices)>{
+        IsJsonAggregate<T>::kNames[Indices]...};
+  } else {
+#if BOOST_PFR_CORE_NAME_ENABLED
+    return boost::pfr::names_as_array<T>();
+#else
+    static_assert(!sizeof(T),
+                  "Field names reflection is not available for this compiler, "
+                  "list the names in kNames of formats::json::IsJsonAggregate");
+    return std::array<std::string_view, sizeof...(Indices)>{};
+#endif
+  }
+}
+
+template <typename T>
+inline constexpr auto kAggregateNames =
+    MakeNames<T>(std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+
+}  // namespace impl
+
+/// @brief SAX serialization of aggregates marked with IsJsonAggregate
+///
+/// Members are written in the order of declaration by the WriteToStream
+/// functions for their types.
+template <typename T>
+std::enable_if_t<impl::kIsJsonAggregate<T>> WriteToStream(const T& value,
+                                                          StringBuilder& sw) {
+  constexpr const auto& kNames = impl::kAggregateNames<T>;
+  StringBuilder::ObjectGuard guard{sw};
+  std::size_t index = 0;
+  boost::pfr::for_each_field(value, [&sw, &index](const auto& field) {
+    sw.Key(kNames[index++]);
+    WriteToStream(field, sw);
+  });
+}
+
+namespace parser {
+
+template <typename T>
+class AggregateParser;
+
+namespace impl {
+
+// Consumes a single JSON value of any type
+class SkipParser final : public TypedParser<std::nullptr_t> {
+ public:
+  void Reset() override { depth_ = 0; }
+
+ protected:
+  void Null() override { OnScalar(); }
+  void Bool(bool) override { OnScalar(); }
+  void Int64(std::int64_t) override { OnScalar(); }
+  void Uint64(std::uint64_t) override { OnScalar(); }
+  void Double(double) override { OnScalar(); }
+  void String(std::string_view) override { OnScalar(); }
+
+  void StartObject() override { ++depth_; }
+  void Key(std::string_view) override {}
+  void EndObject() override { OnEnd(); }
+  void StartArray() override { ++depth_; }
+  void EndArray() override { OnEnd(); }
+
+  std::string Expected() const override { return "value"; }
+  std::string GetPathItem() const override { return {}; }
+
+ private:
+  void OnScalar() {
+    if (depth_ == 0) SetResult(nullptr);
+  }
+
+  void OnEnd() {
+    if (--depth_ == 0) SetResult(nullptr);
+  }
+
+  std::size_t depth_{0};
+};
+
+template <typename T, typename = void>
+struct ParserForImpl {
+  static_assert(!sizeof(T),
+                "There is no SAX parser for the type of an aggregate member");
+};
+
+template <typename T>
+using ParserFor = typename ParserForImpl<T>::Type;
+
+// Accepts null or a value parsed by the parser of T
+template <typename T>
+class OptionalParser final : public TypedParser<std::optional<T>>,
+                             public Subscriber<T> {
+ public:
+  OptionalParser() { parser_.Subscribe(*this); }
+
+ protected:
+  void Null() override { this->SetResult(std::nullopt); }
+  void Bool(bool value) override { Push().Bool(value); }
+  void Int64(std::int64_t value) override { Push().Int64(value); }
+  void Uint64(std::uint64_t value) override { Push().Uint64(value); }
+  void Double(double value) override { Push().Double(value); }
+  void String(std::string_view value) override { Push().String(value); }
+  void StartObject() override { Push().StartObject(); }
+  void StartArray() override { Push().StartArray(); }
+
+  std::string Expected() const override { return "null or value"; }
+  std::string GetPathItem() const override { return {}; }
+
+ private:
+  BaseParser& Push() {
+    parser_.Reset();
+    this->parser_state_->PushParser(parser_.GetParser());
+    return parser_.GetParser();
+  }
+
+  void OnSend(T&& value) override {
+    this->SetResult(std::optional<T>{std::move(value)});
+  }
+
+  ParserFor<T> parser_;
+};
+
+// Proxy parser that owns the parser of the items
+template <typename T>
+class VectorParser final {
+ public:
+  using ResultType = std::vector<T>;
+
+  void Reset() { array_parser_.Reset(); }
+
+  void Subscribe(Subscriber<ResultType>& subscriber) {
+    array_parser_.Subscribe(subscriber);
+  }
+
+  auto& GetParser() { return array_parser_.GetParser(); }
+
+ private:
+  ParserFor<T> item_parser_;
+  ArrayParser<T, ParserFor<T>> array_parser_{item_parser_};
+};
+
+template <>
+struct ParserForImpl<bool> {
+  using Type = BoolParser;
+};
+
+template <>
+struct ParserForImpl<std::int32_t> {
+  using Type = Int32Parser;
+};
+
+template <>
+struct ParserForImpl<std::int64_t> {
+  using Type = Int64Parser;
+};
+
+template <>
+struct ParserForImpl<double> {
+  using Type = DoubleParser;
+};
+
+template <>
+struct ParserForImpl<float> {
+  using Type = FloatParser;
+};
+
+template <>
+struct ParserForImpl<std::string> {
+  using Type = StringParser;
+};
+
+template <typename T>
+struct ParserForImpl<std::optional<T>> {
+  using Type = OptionalParser<T>;
+};
+
+template <typename T>
+struct ParserForImpl<std::vector<T>> {
+  using Type = VectorParser<T>;
+};
+
+template <typename T>
+struct ParserForImpl<T, std::enable_if_t<json::impl::kIsJsonAggregate<T>>> {
+  using Type = AggregateParser<T>;
+};
+
+}  // namespace impl
+
+/// @brief SAX parser of an aggregate marked with formats::json::IsJsonAggregate
+///
+/// Members of types bool, std::int32_t, std::int64_t, double, float,
+/// std::string, other marked aggregates and std::optional or std::vector of
+/// those are supported. Members of std::optional type may be missing or null,
+/// other members are required. Unknown keys are skipped.
+///
+/// ## Example usage:
+///
+/// @code
+/// auto value = formats::json::parser::ParseToType<
+///     MyStruct, formats::json::parser::AggregateParser<MyStruct>>(input);
+/// @endcode
+template <typename T>
+class AggregateParser final : public TypedParser<T> {
+ public:
+  static_assert(json::impl::kIsJsonAggregate<T>,
+                "Mark the type with formats::json::IsJsonAggregate");
+
+  AggregateParser() : sinks_(BindSinks(std::make_index_sequence<kSize>{})) {
+    SubscribeFields(std::make_index_sequence<kSize>{});
+  }
+
+  AggregateParser(const AggregateParser&) = delete;
+  AggregateParser& operator=(const AggregateParser&) = delete;
+
+  void Reset() override {
+    state_ = State::kStart;
+    result_ = T{};
+    seen_.reset();
+    key_.clear();
+  }
+
+ protected:
+  void StartObject() override {
+    if (state_ != State::kStart) this->Throw("object");
+    state_ = State::kInside;
+  }
+
+  void Key(std::string_view key) override {
+    if (state_ != State::kInside) {
+      this->Throw("field '" + std::string{key} + "'");
+    }
+    key_ = key;
+
+    for (std::size_t i = 0; i < kSize; ++i) {
+      if (kNames[i] == key) {
+        seen_.set(i);
+        PushField(i, std::make_index_sequence<kSize>{});
+        return;
+      }
+    }
+
+    skip_parser_.Reset();
+    this->parser_state_->PushParser(skip_parser_.GetParser());
+  }
+
+  void EndObject() override {
+    if (state_ != State::kInside) this->Throw("'}'");
+
+    for (std::size_t i = 0; i < kSize; ++i) {
+      if (!seen_.test(i) && kRequired[i]) {
+        this->parser_state_->PopMe(*this);
+        throw InternalParseError("required field '" + std::string{kNames[i]} +
+                                 "' is missing");
+      }
+    }
+    this->SetResult(std::move(result_));
+  }
+
+  std::string Expected() const override {
+    return state_ == State::kInside ? "string" : "object";
+  }
+
+  std::string GetPathItem() const override { return key_; }
+
+ private:
+  template <std::size_t I>
+  using Field = boost::pfr::tuple_element_t<I, T>;
+
+  static constexpr std::size_t kSize = boost::pfr::tuple_size_v<T>;
+  static constexpr const auto& kNames = json::impl::kAggregateNames<T>;
+
+  template <std::size_t... Indices>
+  static constexpr std::array<bool, kSize> MakeRequired(
+      std::index_sequence<Indices...>) {
+    return {!meta::kIsOptional<Field<Indices>>...};
+  }
+
+  static constexpr std::array<bool, kSize> kRequired =
+      MakeRequired(std::make_index_sequence<kSize>{});
+
+  template <std::size_t... Indices>
+  static auto MakeParsers(std::index_sequence<Indices...>)
+      -> std::tuple<impl::ParserFor<Field<Indices>>...>;
+
+  template <std::size_t... Indices>
+  static auto MakeSinks(std::index_sequence<Indices...>)
+      -> std::tuple<SubscriberSink<Field<Indices>>...>;
+
+  using Parsers = decltype(MakeParsers(std::make_index_sequence<kSize>{}));
+  using Sinks = decltype(MakeSinks(std::make_index_sequence<kSize>{}));
+
+  template <std::size_t... Indices>
+  Sinks BindSinks(std::index_sequence<Indices...>) {
+    return {
+        SubscriberSink<Field<Indices>>{boost::pfr::get<Indices>(result_)}...};
+  }
+
+  template <std::size_t... Indices>
+  void SubscribeFields(std::index_sequence<Indices...>) {
+    (std::get<Indices>(parsers_).Subscribe(std::get<Indices>(sinks_)), ...);
+  }
+
+  template <std::size_t I>
+  void PushField() {
+    auto& parser = std::get<I>(parsers_);
+    parser.Reset();
+    this->parser_state_->PushParser(parser.GetParser());
+  }
+
+  template <std::size_t... Indices>
+  void PushField(std::size_t index, std::index_sequence<Indices...>) {
+    ((index == Indices ? (PushField<Indices>(), true) : false) || ...);
+  }
+
+  enum class State {
+    kStart,
+    kInside,
+  };
+
+  State state_{State::kStart};
+  T result_{};
+  std::bitset<kSize> seen_;
+  std::string key_;
+  Parsers parsers_;
+  Sinks sinks_;
+  impl::SkipParser skip_parser_;
+};
+
+}  // namespace parser
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -4,17 +4,23 @@
 /// @brief Implementation of hazard pointer
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <cstdlib>
 #include <list>
 #include <unordered_set>
+#include <utility>
 
 #include <userver/compiler/thread_local.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/rcu/fwd.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/meta_light.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -69,16 +75,117 @@ inline compiler::ThreadLocal local_cached_data =
 
 uint64_t GetNextEpoch() noexcept;
 
+// Epoch-based reclamation. Readers pin the global epoch by incrementing the
+// reader counter of their thread for the parity of the epoch. The global epoch
+// is advanced only when the counters of the previous epoch are zero on all
+// threads, so a value retired at epoch E is not referenced by readers once
+// the epoch E is completed.
+class EpochReadLock final {
+ public:
+  EpochReadLock() noexcept = default;
+
+  EpochReadLock(EpochReadLock&& other) noexcept
+      : counter_(std::exchange(other.counter_, nullptr)) {}
+
+  EpochReadLock& operator=(EpochReadLock&& other) noexcept {
+    if (this != &other) {
+      Release();
+      counter_ = std::exchange(other.counter_, nullptr);
+    }
+    return *this;
+  }
+
+  ~EpochReadLock() { Release(); }
+
+  // Pins the current global epoch
+  static EpochReadLock Acquire() noexcept;
+
+  // Pins the epoch pinned by this lock once more
+  EpochReadLock Duplicate() const noexcept {
+    if (counter_) counter_->fetch_add(1, std::memory_order_relaxed);
+    return EpochReadLock{counter_};
+  }
+
+  void Release() noexcept {
+    if (counter_) {
+      counter_->fetch_sub(1, std::memory_order_release);
+      counter_ = nullptr;
+    }
+  }
+
+ private:
+  explicit EpochReadLock(std::atomic<std::uint64_t>* counter) noexcept
+      : counter_(counter) {}
+
+  std::atomic<std::uint64_t>* counter_{nullptr};
+};
+
+// Returns the current global epoch
+std::uint64_t GetGlobalEpoch() noexcept;
+
+// Advances the global epoch as far as the readers allow without waiting for
+// them. Returns the latest completed epoch.
+std::uint64_t TryAdvanceGlobalEpoch() noexcept;
+
+inline constexpr std::chrono::milliseconds kEpochReclaimInterval{1};
+
 }  // namespace impl
 
+/// @brief Reclamation policy of rcu::Variable that protects the values being
+/// read with hazard pointers. Used by default.
+///
+/// Each ReadablePtr acquires a hazard pointer of its Variable, and each update
+/// scans all the hazard pointers of the Variable to find out whether the old
+/// value may be destroyed.
+struct HazardPointerReclamation {};
+
+/// @brief Reclamation policy of rcu::Variable that protects the values being
+/// read with global epochs.
+///
+/// A ReadablePtr pins the current global epoch in the reader counter of its
+/// thread, that is cheaper than acquiring a hazard pointer and does not
+/// contend with other threads. An old value is destroyed once all the readers
+/// that pinned the epoch of its retirement are gone. With
+/// DestructionType::kAsync a background task of the Variable advances the
+/// global epoch until all the old values are destroyed, otherwise the old
+/// values are destroyed on subsequent updates and in Variable::Cleanup().
+///
+/// @warning The epochs are shared by all the epoch-based variables, so
+/// a long-living ReadablePtr of any of them delays the destruction of old
+/// values of all of them.
+struct EpochReclamation {};
+
 /// Default Rcu traits.
 /// - `MutexType` is a writer's mutex type that has to be used to protect
 /// structure on update
+/// - `ReclamationPolicy` (optional) is rcu::HazardPointerReclamation (default)
+/// or rcu::EpochReclamation
 template <typename T>
 struct DefaultRcuTraits {
   using MutexType = engine::Mutex;
 };
 
+/// Rcu traits for the epoch-based reclamation of old values, see
+/// rcu::EpochReclamation.
+template <typename T>
+struct EpochRcuTraits {
+  using MutexType = engine::Mutex;
+  using ReclamationPolicy = EpochReclamation;
+};
+
+namespace impl {
+
+template <typename RcuTraits>
+using ReclamationPolicyOf = typename RcuTraits::ReclamationPolicy;
+
+template <typename RcuTraits>
+inline constexpr bool kIsEpochBased =
+    std::is_same_v<meta::DetectedOr<HazardPointerReclamation,
+                                    ReclamationPolicyOf, RcuTraits>,
+                   EpochReclamation>;
+
+}  // namespace impl
+
 /// Reader smart pointer for rcu::Variable<T>. You may use operator*() or
 /// operator->() to do something with the stored value. Once created,
 /// ReadablePtr references the same immutable value: if Variable's value is
@@ -87,22 +194,31 @@ struct DefaultRcuTraits {
 template <typename T, typename RcuTraits>
 class [[nodiscard]] ReadablePtr final {
  public:
-  explicit ReadablePtr(const Variable<T, RcuTraits>& ptr)
-      : hp_record_(&ptr.MakeHazardPointer()) {
-    // This cycle guarantees that at the end of it both t_ptr_ and
-    // hp_record_->ptr will both be set to
-    // 1. something meaningful
-    // 2. and that this meaningful value was not removed between assigning to
-    //    t_ptr_ and storing  it in a hazard pointer
-    do {
+  explicit ReadablePtr(const Variable<T, RcuTraits>& ptr) {
+    if constexpr (kIsEpochBased) {
+      // Values retired after the epoch is pinned are not destroyed until
+      // the lock is released
+      epoch_lock_ = impl::EpochReadLock::Acquire();
       t_ptr_ = ptr.GetCurrent();
-
-      hp_record_->ptr.store(t_ptr_);
-    } while (t_ptr_ != ptr.GetCurrent());
+    } else {
+      hp_record_ = &ptr.MakeHazardPointer();
+      // This cycle guarantees that at the end of it both t_ptr_ and
+      // hp_record_->ptr will both be set to
+      // 1. something meaningful
+      // 2. and that this meaningful value was not removed between assigning
+      //    to t_ptr_ and storing  it in a hazard pointer
+      do {
+        t_ptr_ = ptr.GetCurrent();
+
+        hp_record_->ptr.store(t_ptr_);
+      } while (t_ptr_ != ptr.GetCurrent());
+    }
   }
 
   ReadablePtr(ReadablePtr<T, RcuTraits>&& other) noexcept
-      : t_ptr_(other.t_ptr_), hp_record_(other.hp_record_) {
+      : t_ptr_(other.t_ptr_),
+        hp_record_(other.hp_record_),
+        epoch_lock_(std::move(other.epoch_lock_)) {
     other.t_ptr_ = nullptr;
   }
 
@@ -130,7 +246,7 @@ class [[nodiscard]] ReadablePtr final {
 
     // Get rid of our current hp_record_
     if (t_ptr_) {
-      hp_record_->Release();
+      ReleaseRecord();
     }
     // After that moment, the content of our hp_record_ can't be used -
     // no more hp_record_->xyz calls, because it is probably already reused in
@@ -138,6 +254,7 @@ class [[nodiscard]] ReadablePtr final {
     // freed. Just take values from 'other'.
     hp_record_ = other.hp_record_;
     t_ptr_ = other.t_ptr_;
+    epoch_lock_ = std::move(other.epoch_lock_);
 
     // Now, it won't do us any good if there were two glorified things having
     // pointer to same hp_record_. Kill the other one.
@@ -150,7 +267,7 @@ class [[nodiscard]] ReadablePtr final {
   }
 
   ReadablePtr(const ReadablePtr<T, RcuTraits>& other)
-      : ReadablePtr(other.hp_record_->owner) {}
+      : ReadablePtr(other, std::bool_constant<kIsEpochBased>{}) {}
 
   ReadablePtr& operator=(const ReadablePtr<T, RcuTraits>& other) {
     if (this != &other) *this = ReadablePtr<T, RcuTraits>{other};
@@ -159,8 +276,7 @@ class [[nodiscard]] ReadablePtr final {
 
   ~ReadablePtr() {
     if (!t_ptr_) return;
-    UASSERT(hp_record_ != nullptr);
-    hp_record_->Release();
+    ReleaseRecord();
   }
 
   const T* Get() const& {
@@ -177,6 +293,25 @@ class [[nodiscard]] ReadablePtr final {
   const T& operator*() && { return *GetOnRvalue(); }
 
  private:
+  static constexpr bool kIsEpochBased = impl::kIsEpochBased<RcuTraits>;
+
+  ReadablePtr(const ReadablePtr<T, RcuTraits>& other, std::false_type)
+      : ReadablePtr(other.hp_record_->owner) {}
+
+  // The copy references the same value, as the epoch of the original is
+  // still pinned
+  ReadablePtr(const ReadablePtr<T, RcuTraits>& other, std::true_type)
+      : t_ptr_(other.t_ptr_), epoch_lock_(other.epoch_lock_.Duplicate()) {}
+
+  void ReleaseRecord() {
+    if constexpr (kIsEpochBased) {
+      epoch_lock_.Release();
+    } else {
+      UASSERT(hp_record_ != nullptr);
+      hp_record_->Release();
+    }
+  }
+
   const T* GetOnRvalue() {
     static_assert(!sizeof(T),
                   "Don't use temporary ReadablePtr, store it to a variable");
@@ -186,12 +321,15 @@ class [[nodiscard]] ReadablePtr final {
   // This is a pointer to actual data. If it is null, then we treat it as
   // an indicator that this ReadablePtr is cleared and won't call
   // any logic associated with hp_record_
-  T* t_ptr_;
+  T* t_ptr_{nullptr};
   // Our hazard pointer. It can be nullptr in some circumstances.
   // Invariant is this: if t_ptr_ is not nullptr, then hp_record_ is also
   // not nullptr and points to hazard pointer containing same T*.
   // Thus, if t_ptr_ is nullptr, then hp_record_ is undefined.
-  impl::HazardPointerRecord<T, RcuTraits>* hp_record_;
+  // Not used with the epoch-based reclamation.
+  impl::HazardPointerRecord<T, RcuTraits>* hp_record_{nullptr};
+  // Pins the epoch with the epoch-based reclamation
+  impl::EpochReadLock epoch_lock_;
 };
 
 /// Smart pointer for rcu::Variable<T> for changing RCU value. It stores a
@@ -340,6 +478,13 @@ class Variable final {
   Variable& operator=(Variable&&) = delete;
 
   ~Variable() {
+    if constexpr (impl::kIsEpochBased<RcuTraits>) {
+      if (reclaimer_.IsValid()) reclaimer_.SyncCancel();
+      // There must be no readers of this Variable, so the epochs of the old
+      // values are not pinned by them
+      epoch_retire_list_.clear();
+    }
+
     delete current_.load();
 
     auto* hp = hp_record_head_.load();
@@ -404,7 +549,11 @@ class Variable final {
       return;
     }
 
-    ScanRetiredList(CollectHazardPtrs(lock));
+    if constexpr (impl::kIsEpochBased<RcuTraits>) {
+      ScanEpochRetireList();
+    } else {
+      ScanRetiredList(CollectHazardPtrs(lock));
+    }
   }
 
  private:
@@ -471,6 +620,11 @@ class Variable final {
 
   void Retire(std::unique_ptr<T> old_ptr, std::unique_lock<MutexType>& lock) {
     LOG_TRACE() << "Retiring ptr=" << old_ptr.get();
+    if constexpr (impl::kIsEpochBased<RcuTraits>) {
+      RetireEpoch(std::move(old_ptr));
+      return;
+    }
+
     auto hazard_ptrs = CollectHazardPtrs(lock);
 
     if (hazard_ptrs.count(old_ptr.get()) > 0) {
@@ -511,6 +665,46 @@ class Variable final {
     return hazard_ptrs;
   }
 
+  void RetireEpoch(std::unique_ptr<T> old_ptr) {
+    // Readers that have pinned a later epoch can't see old_ptr, as it was
+    // replaced in current_ before the epoch is read
+    epoch_retire_list_.emplace_back(impl::GetGlobalEpoch(), std::move(old_ptr));
+    ScanEpochRetireList();
+
+    if (!epoch_retire_list_.empty() &&
+        destruction_type_ == DestructionType::kAsync && !reclaimer_running_) {
+      StartReclaimer();
+    }
+  }
+
+  // Destroy the old values retired at the completed epochs (asynchronously)
+  void ScanEpochRetireList() {
+    const auto completed_epoch = impl::TryAdvanceGlobalEpoch();
+    while (!epoch_retire_list_.empty() &&
+           epoch_retire_list_.front().first <= completed_epoch) {
+      DeleteAsync(std::move(epoch_retire_list_.front().second));
+      epoch_retire_list_.pop_front();
+    }
+  }
+
+  // Advances the global epoch in background until all the old values are
+  // destroyed. Must be called with mutex_ locked.
+  void StartReclaimer() {
+    reclaimer_running_ = true;
+    reclaimer_ = engine::CriticalAsyncNoSpan([this] {
+      while (!engine::current_task::ShouldCancel()) {
+        engine::InterruptibleSleepFor(impl::kEpochReclaimInterval);
+
+        std::lock_guard lock(mutex_);
+        ScanEpochRetireList();
+        if (epoch_retire_list_.empty()) {
+          reclaimer_running_ = false;
+          return;
+        }
+      }
+    });
+  }
+
   void DeleteAsync(std::unique_ptr<T> ptr) {
     switch (destruction_type_) {
       case DestructionType::kSync:
@@ -537,6 +731,11 @@ class Variable final {
   // may be read without mutex_ locked, but must be changed with held mutex_
   std::atomic<T*> current_;
   std::list<std::unique_ptr<T>> retire_list_head_;
+  // old values with the epochs of their retirement for the epoch-based
+  // reclamation, protected by mutex_
+  std::list<std::pair<std::uint64_t, std::unique_ptr<T>>> epoch_retire_list_;
+  bool reclaimer_running_{false};
+  engine::TaskWithResult<void> reclaimer_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 
   friend class ReadablePtr<T, RcuTraits>;
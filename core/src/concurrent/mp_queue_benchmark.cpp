@@ -75,6 +75,10 @@ BENCHMARK_TEMPLATE(producer_consumer, concurrent::NonFifoMpmcQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 4}, {1'000'000'000, 1'000'000'000}});
 
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::NonFifoMpscQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 1}, {128, 512}});
+
 BENCHMARK_TEMPLATE(producer_consumer, concurrent::NonFifoMpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {1'000'000'000, 1'000'000'000}});
@@ -87,6 +91,18 @@ BENCHMARK_TEMPLATE(producer_consumer, concurrent::SpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 1}, {1, 1}, {1'000'000'000, 1'000'000'000}});
 
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::BoundedMpmcQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 4}, {128, 512}});
+
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::BoundedMpmcQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 4}, {65536, 65536}});
+
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::BoundedMpscQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 1}, {128, 512}});
+
 BENCHMARK_TEMPLATE(producer_consumer, concurrent::MpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {128, 512}});
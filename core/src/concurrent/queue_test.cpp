@@ -40,10 +40,18 @@ using TestMpscTypes =
                    concurrent::NonFifoMpscQueue<std::unique_ptr<int>>,
                    concurrent::NonFifoMpscQueue<std::unique_ptr<RefCountData>>>;
 
-using TestQueueTypes = testing::Types<concurrent::NonFifoMpmcQueue<std::size_t>,
-                                      concurrent::NonFifoMpscQueue<std::size_t>,
-                                      concurrent::SpmcQueue<std::size_t>,
-                                      concurrent::SpscQueue<std::size_t>>;
+using TestBoundedTypes = testing::Types<
+    concurrent::BoundedMpmcQueue<int>,
+    concurrent::BoundedMpmcQueue<std::unique_ptr<int>>,
+    concurrent::BoundedMpmcQueue<std::unique_ptr<RefCountData>>>;
+
+using TestQueueTypes =
+    testing::Types<concurrent::NonFifoMpmcQueue<std::size_t>,
+                   concurrent::NonFifoMpscQueue<std::size_t>,
+                   concurrent::SpmcQueue<std::size_t>,
+                   concurrent::SpscQueue<std::size_t>,
+                   concurrent::BoundedMpmcQueue<std::size_t>,
+                   concurrent::BoundedMpscQueue<std::size_t>>;
 
 }  // namespace
 
@@ -59,6 +67,15 @@ INSTANTIATE_TYPED_UTEST_SUITE_P(NonFifoMpscQueue, QueueFixture,
 INSTANTIATE_TYPED_UTEST_SUITE_P(NonFifoMpscQueue, TypedQueueFixture,
                                 TestMpmcTypes);
 
+INSTANTIATE_TYPED_UTEST_SUITE_P(BoundedMpmcQueue, QueueFixture,
+                                concurrent::BoundedMpmcQueue<int>);
+
+INSTANTIATE_TYPED_UTEST_SUITE_P(BoundedMpmcQueue, TypedQueueFixture,
+                                TestBoundedTypes);
+
+INSTANTIATE_TYPED_UTEST_SUITE_P(BoundedMpscQueue, QueueFixture,
+                                concurrent::BoundedMpscQueue<int>);
+
 TYPED_TEST_SUITE(NonCoroutineTest, TestQueueTypes);
 
 TYPED_TEST(NonCoroutineTest, PushPopNoblock) {
@@ -307,6 +324,116 @@ UTEST_MT(NonFifoSpscQueue, Spsc, 1 + 1) {
                           [](int item) { return item == 1; }));
 }
 
+UTEST(BoundedMpmcQueue, Capacity) {
+  auto queue = concurrent::BoundedMpmcQueue<int>::Create(3);
+  EXPECT_EQ(queue->GetSoftMaxSize(), 3);
+
+  // The size may not exceed the preallocated storage
+  queue->SetSoftMaxSize(1'000'000);
+  EXPECT_LT(queue->GetSoftMaxSize(), 1'000'000);
+  queue->SetSoftMaxSize(2);
+  EXPECT_EQ(queue->GetSoftMaxSize(), 2);
+
+  EXPECT_EQ(concurrent::BoundedMpmcQueue<int>::Create()->GetSoftMaxSize(),
+            1024);
+}
+
+UTEST(BoundedMpmcQueue, FifoWrapAround) {
+  auto queue = concurrent::BoundedMpmcQueue<int>::Create(4);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  int next_pushed = 0;
+  int next_popped = 0;
+  for (int round = 0; round < 100; ++round) {
+    while (producer.PushNoblock(int{next_pushed})) ++next_pushed;
+    EXPECT_EQ(queue->GetSizeApproximate(), 4);
+
+    int value{};
+    for (int i = 0; i <= round % 4; ++i) {
+      ASSERT_TRUE(consumer.PopNoblock(value));
+      EXPECT_EQ(value, next_popped++);
+    }
+  }
+}
+
+UTEST(BoundedMpmcQueue, NotDefaultConstructible) {
+  struct Item final {
+    explicit Item(std::shared_ptr<int> data) : data(std::move(data)) {}
+
+    std::shared_ptr<int> data;
+  };
+
+  const auto data = std::make_shared<int>(1);
+  {
+    auto queue = concurrent::BoundedMpmcQueue<Item>::Create(4);
+    auto producer = queue->GetProducer();
+    auto consumer = queue->GetConsumer();
+    for (int i = 0; i < 3; ++i) ASSERT_TRUE(producer.PushNoblock(Item{data}));
+
+    Item value{nullptr};
+    ASSERT_TRUE(consumer.PopNoblock(value));
+    EXPECT_EQ(value.data, data);
+    EXPECT_EQ(data.use_count(), 4);
+  }
+  // The elements left in the queue are destroyed with it
+  EXPECT_EQ(data.use_count(), 1);
+}
+
+UTEST_MT(BoundedMpmcQueue, Mpmc, kProducersCount + kConsumersCount) {
+  using Queue = concurrent::BoundedMpmcQueue<std::size_t>;
+  // Small capacity makes producers and consumers wait for each other
+  auto queue = Queue::Create(16);
+
+  std::vector<Queue::Producer> producers;
+  producers.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers.emplace_back(queue->GetProducer());
+  }
+
+  std::vector<engine::TaskWithResult<void>> producers_tasks;
+  producers_tasks.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers_tasks.push_back(GetProducerTask(producers[i], i));
+  }
+
+  std::vector<int> consumed_messages(kMessageCount * kProducersCount, 0);
+  engine::Mutex mutex;
+
+  std::vector<engine::TaskWithResult<void>> consumers_tasks;
+  consumers_tasks.reserve(kConsumersCount);
+  for (std::size_t i = 0; i < kConsumersCount; ++i) {
+    consumers_tasks.push_back(utils::Async(
+        "consumer",
+        [consumer = queue->GetConsumer(), &consumed_messages, &mutex] {
+          std::size_t value{};
+          std::vector<std::size_t> last_from_producer(kProducersCount, 0);
+          while (consumer.Pop(value)) {
+            // Messages of a producer are popped in order
+            auto& last = last_from_producer[value / kMessageCount];
+            EXPECT_TRUE(last == 0 || last < value);
+            last = value;
+
+            const std::lock_guard lock(mutex);
+            ++consumed_messages[value];
+          }
+        }));
+  }
+
+  for (auto& task : producers_tasks) {
+    task.Get();
+  }
+  producers.clear();
+
+  for (auto& task : consumers_tasks) {
+    task.Get();
+  }
+
+  ASSERT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(),
+                          [](int item) { return item == 1; }));
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
 // TODO(TAXICOMMON-7429) the test occasionally hangs; fix and re-enable
 UTEST_MT(QueueFixture, DISABLED_MultiConsumerToken,
          kProducersCount + kConsumersCount) {
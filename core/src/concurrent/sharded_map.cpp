@@ -0,0 +1,18 @@
+#include <userver/concurrent/sharded_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ShardedMapStatistics& stats) {
+  writer["size"] = stats.size;
+  writer["max-shard-size"] = stats.max_shard_size;
+  writer["shards"] = stats.shards;
+  writer["buckets"] = stats.buckets;
+  writer["retired"] = stats.retired;
+}
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
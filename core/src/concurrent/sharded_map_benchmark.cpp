@@ -0,0 +1,129 @@
+#include <userver/concurrent/sharded_map.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/cache/nway_lru_cache.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::uint64_t kKeys = 10000;
+constexpr std::size_t kLruWays = 16;
+
+using ShardedMap = concurrent::ShardedMap<std::uint64_t, std::uint64_t>;
+using RcuMap = rcu::RcuMap<std::uint64_t, std::uint64_t>;
+using LruMap = cache::NWayLRU<std::uint64_t, std::uint64_t>;
+
+// Spreads the keys of the different threads, so that they do not walk the
+// same keys in lockstep
+std::uint64_t NextKey(std::uint64_t& state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state % kKeys;
+}
+
+template <typename Map>
+struct MapFactory;
+
+template <>
+struct MapFactory<ShardedMap> {
+  static auto Make() { return std::make_unique<ShardedMap>(); }
+};
+
+template <>
+struct MapFactory<RcuMap> {
+  static auto Make() { return std::make_unique<RcuMap>(); }
+};
+
+template <>
+struct MapFactory<LruMap> {
+  // Large enough to never evict the keys
+  static auto Make() {
+    return std::make_unique<LruMap>(kLruWays, kKeys / kLruWays * 2);
+  }
+};
+
+bool Read(ShardedMap& map, std::uint64_t key) { return !!map.Get(key); }
+bool Read(RcuMap& map, std::uint64_t key) { return !!map.Get(key); }
+bool Read(LruMap& map, std::uint64_t key) { return !!map.Get(key); }
+
+void Write(ShardedMap& map, std::uint64_t key) {
+  map.InsertOrAssign(key, std::make_shared<std::uint64_t>(key));
+}
+void Write(RcuMap& map, std::uint64_t key) {
+  map.InsertOrAssign(key, std::make_shared<std::uint64_t>(key));
+}
+void Write(LruMap& map, std::uint64_t key) { map.Put(key, key); }
+
+template <typename Map>
+auto MakeFilledMap() {
+  auto map = MapFactory<Map>::Make();
+  for (std::uint64_t key = 0; key < kKeys; ++key) Write(*map, key);
+  return map;
+}
+
+// The write ratio is 1 / WriteEvery, 0 means read-only
+template <typename Map, int WriteEvery>
+void concurrent_map_access(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    auto map = MakeFilledMap<Map>();
+    std::atomic<std::uint64_t> seed{1};
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      auto key_state = seed.fetch_add(0x9E3779B97F4A7C15ULL) | 1;
+      [[maybe_unused]] std::uint64_t i = 0;
+      for ([[maybe_unused]] auto _ : range) {
+        const auto key = NextKey(key_state);
+        if constexpr (WriteEvery != 0) {
+          if (++i % WriteEvery == 0) {
+            Write(*map, key);
+            continue;
+          }
+        }
+        benchmark::DoNotOptimize(Read(*map, key));
+      }
+    });
+  });
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(concurrent_map_access, ShardedMap, 0)
+    ->RangeMultiplier(2)
+    ->Range(1, 16);
+BENCHMARK_TEMPLATE(concurrent_map_access, RcuMap, 0)
+    ->RangeMultiplier(2)
+    ->Range(1, 16);
+BENCHMARK_TEMPLATE(concurrent_map_access, LruMap, 0)
+    ->RangeMultiplier(2)
+    ->Range(1, 16);
+
+// 10% of writes. RcuMap copies the whole map on each write, so it is only
+// measured with the rare writes.
+BENCHMARK_TEMPLATE(concurrent_map_access, ShardedMap, 10)
+    ->RangeMultiplier(2)
+    ->Range(1, 16);
+BENCHMARK_TEMPLATE(concurrent_map_access, LruMap, 10)
+    ->RangeMultiplier(2)
+    ->Range(1, 16);
+
+// 0.1% of writes
+BENCHMARK_TEMPLATE(concurrent_map_access, ShardedMap, 1000)
+    ->RangeMultiplier(2)
+    ->Range(1, 16);
+BENCHMARK_TEMPLATE(concurrent_map_access, RcuMap, 1000)
+    ->RangeMultiplier(2)
+    ->Range(1, 16);
+BENCHMARK_TEMPLATE(concurrent_map_access, LruMap, 1000)
+    ->RangeMultiplier(2)
+    ->Range(1, 16);
+
+USERVER_NAMESPACE_END
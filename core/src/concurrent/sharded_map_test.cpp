@@ -0,0 +1,245 @@
+#include <userver/concurrent/sharded_map.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename Key, typename Value>
+struct StdMutexTraits : concurrent::DefaultShardedMapTraits<Key, Value> {
+  using MutexType = std::mutex;
+};
+
+}  // namespace
+
+TEST(ShardedMap, StdMutexBase) {
+  concurrent::ShardedMap<std::string, int, StdMutexTraits<std::string, int>>
+      map{4};
+  const auto& cmap = map;
+
+  EXPECT_FALSE(cmap.Get("any"));
+  EXPECT_FALSE(map.Contains("any"));
+  EXPECT_FALSE(map.Erase("any"));
+
+  EXPECT_TRUE(map.Emplace("any", 1).inserted);
+  EXPECT_EQ(*cmap.Get("any"), 1);
+  EXPECT_TRUE(map.Erase("any"));
+  EXPECT_FALSE(map.Contains("any"));
+}
+
+UTEST(ShardedMap, Modify) {
+  /// [Sample ShardedMap usage]
+  concurrent::ShardedMap<std::string, int> map;
+
+  auto [value, inserted] = map.Emplace("a", 1);
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(*value, 1);
+
+  // Values are not overwritten by Insert and Emplace
+  EXPECT_FALSE(map.Insert("a", std::make_shared<int>(2)).inserted);
+  EXPECT_EQ(*map.Get("a"), 1);
+
+  map.InsertOrAssign("a", std::make_shared<int>(3));
+  EXPECT_EQ(*map.Get("a"), 3);
+
+  // Readers get shared pointers, the value outlives its removal from the map
+  const auto popped = map.Pop("a");
+  EXPECT_EQ(*popped, 3);
+  EXPECT_FALSE(map.Get("a"));
+  /// [Sample ShardedMap usage]
+
+  EXPECT_FALSE(map.Pop("a"));
+  EXPECT_EQ(map.SizeApprox(), 0);
+}
+
+UTEST(ShardedMap, Growth) {
+  constexpr int kCount = 10000;
+  concurrent::ShardedMap<int, int> map{4};
+
+  for (int i = 0; i < kCount; ++i) {
+    ASSERT_TRUE(map.Emplace(i, i).inserted);
+  }
+  EXPECT_EQ(map.SizeApprox(), kCount);
+  for (int i = 0; i < kCount; ++i) {
+    const auto value = map.Get(i);
+    ASSERT_TRUE(value);
+    ASSERT_EQ(*value, i);
+  }
+  EXPECT_FALSE(map.Get(kCount));
+
+  const auto stats = map.GetStatistics();
+  EXPECT_EQ(stats.size, kCount);
+  EXPECT_EQ(stats.shards, 4);
+  EXPECT_GE(stats.buckets, kCount);
+  EXPECT_GE(stats.max_shard_size, kCount / 4);
+
+  for (int i = 0; i < kCount; i += 2) {
+    ASSERT_TRUE(map.Erase(i));
+  }
+  EXPECT_EQ(map.SizeApprox(), kCount / 2);
+  for (int i = 0; i < kCount; ++i) {
+    ASSERT_EQ(map.Contains(i), i % 2 == 1);
+  }
+
+  map.Clear();
+  EXPECT_EQ(map.SizeApprox(), 0);
+  EXPECT_FALSE(map.Contains(1));
+
+  map.Cleanup();
+  EXPECT_EQ(map.GetStatistics().retired, 0);
+}
+
+UTEST(ShardedMap, Snapshot) {
+  concurrent::ShardedMap<int, std::string> map{2};
+  for (int i = 0; i < 100; ++i) {
+    map.Emplace(i, std::to_string(i));
+  }
+
+  const auto snapshot = map.GetSnapshot();
+  map.Clear();
+
+  ASSERT_EQ(snapshot.size(), 100);
+  for (const auto& [key, value] : snapshot) {
+    EXPECT_EQ(*value, std::to_string(key));
+  }
+
+  std::size_t visited = 0;
+  map.Emplace(1, "1");
+  map.VisitAll([&visited](int key, const auto& value) {
+    EXPECT_EQ(key, 1);
+    EXPECT_EQ(*value, "1");
+    ++visited;
+  });
+  EXPECT_EQ(visited, 1);
+}
+
+UTEST(ShardedMap, Statistics) {
+  concurrent::ShardedMap<int, int> map{2};
+  map.Emplace(1, 1);
+  map.Emplace(2, 2);
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "map", [&map](utils::statistics::Writer& writer) {
+        writer = map.GetStatistics();
+      });
+
+  const utils::statistics::Snapshot snapshot{storage};
+  EXPECT_EQ(snapshot.SingleMetric("map.size").AsInt(), 2);
+  EXPECT_EQ(snapshot.SingleMetric("map.shards").AsInt(), 2);
+}
+
+UTEST_MT(ShardedMap, ConcurrentReadWrite, 4) {
+  constexpr int kKeys = 1000;
+  concurrent::ShardedMap<int, int> map{8};
+  std::atomic<bool> stop_flag{false};
+
+  // Even keys are never removed, odd keys are constantly inserted, replaced
+  // and erased
+  for (int i = 0; i < kKeys; i += 2) map.Emplace(i, i);
+
+  auto writer = utils::Async("writer", [&map, &stop_flag] {
+    for (int iteration = 0; !stop_flag; ++iteration) {
+      for (int i = 1; i < kKeys; i += 2) {
+        map.InsertOrAssign(i, std::make_shared<int>(i));
+        if (iteration % 2) map.Erase(i);
+      }
+    }
+  });
+
+  std::vector<engine::TaskWithResult<void>> readers;
+  for (int reader = 0; reader < 3; ++reader) {
+    readers.push_back(utils::Async("reader", [&map, &stop_flag] {
+      while (!stop_flag) {
+        for (int i = 0; i < kKeys; ++i) {
+          const auto value = map.Get(i);
+          if (i % 2 == 0) {
+            ASSERT_TRUE(value);
+          }
+          if (value) {
+            ASSERT_EQ(*value, i);
+          }
+        }
+      }
+    }));
+  }
+
+  engine::SleepFor(std::chrono::milliseconds{100});
+  stop_flag = true;
+  writer.Get();
+  for (auto& reader : readers) reader.Get();
+
+  for (int i = 0; i < kKeys; i += 2) EXPECT_TRUE(map.Contains(i));
+}
+
+UTEST_MT(ShardedMap, ConcurrentGrowth, 4) {
+  constexpr int kKeys = 1000;
+  concurrent::ShardedMap<int, int> map{2};
+  std::atomic<bool> stop_flag{false};
+
+  // Each writer refills its own keys, so the tables grow again and again,
+  // while the other writer advances the epoch
+  std::vector<engine::TaskWithResult<void>> writers;
+  for (int writer = 0; writer < 2; ++writer) {
+    writers.push_back(utils::Async("writer", [&map, &stop_flag, writer] {
+      while (!stop_flag) {
+        for (int i = writer; i < kKeys; i += 2) map.Emplace(i, i);
+        for (int i = writer; i < kKeys; i += 2) map.Erase(i);
+        if (writer == 0) map.Clear();
+      }
+    }));
+  }
+
+  std::vector<engine::TaskWithResult<void>> readers;
+  for (int reader = 0; reader < 2; ++reader) {
+    readers.push_back(utils::Async("reader", [&map, &stop_flag] {
+      while (!stop_flag) {
+        for (int i = 0; i < kKeys; ++i) {
+          const auto value = map.Get(i);
+          if (value) {
+            ASSERT_EQ(*value, i);
+          }
+        }
+      }
+    }));
+  }
+
+  engine::SleepFor(std::chrono::milliseconds{100});
+  stop_flag = true;
+  for (auto& writer : writers) writer.Get();
+  for (auto& reader : readers) reader.Get();
+}
+
+UTEST_MT(ShardedMap, ConcurrentEmplace, 8) {
+  constexpr std::size_t kTasks = 16;
+  concurrent::ShardedMap<std::string, std::size_t> map;
+  std::atomic<std::size_t> insertions{0};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&map, &insertions, i] {
+      for (std::size_t key = 0; key < 1000; ++key) {
+        const auto res =
+            map.Emplace(std::to_string(key * kTasks / 2 + i / 2), i);
+        if (res.inserted) ++insertions;
+        EXPECT_EQ(*res.value / 2, i / 2);
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(insertions, kTasks / 2 * 1000);
+  EXPECT_EQ(map.SizeApprox(), kTasks / 2 * 1000);
+}
+
+USERVER_NAMESPACE_END
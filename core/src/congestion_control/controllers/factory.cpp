@@ -0,0 +1,32 @@
+#include <userver/congestion_control/controllers/factory.hpp>
+
+#include <userver/congestion_control/controllers/gradient.hpp>
+#include <userver/congestion_control/controllers/linear.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+std::unique_ptr<Controller> MakeController(
+    const std::string& name, v2::Sensor& sensor, Limiter& limiter,
+    Stats& stats, const Controller::Config& config,
+    dynamic_config::Source config_source,
+    std::function<v2::Config(const dynamic_config::Snapshot&)> config_getter) {
+  switch (config.algorithm) {
+    case Algorithm::kLinear:
+      return std::make_unique<LinearController>(name, sensor, limiter, stats,
+                                                config, config_source,
+                                                std::move(config_getter));
+    case Algorithm::kGradient:
+      return std::make_unique<GradientController>(name, sensor, limiter, stats,
+                                                  config, config_source,
+                                                  std::move(config_getter));
+  }
+
+  UINVARIANT(false, "Unexpected congestion control algorithm");
+}
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,105 @@
+#include <userver/congestion_control/controllers/gradient.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+namespace {
+constexpr std::size_t kWarmupEpochs = 30;
+
+// Exponential smoothing factor of the no-load timings estimate
+constexpr double kNoLoadTimingsFactor = 2.0 / (kWarmupEpochs + 1);
+
+// Timings are measured in whole milliseconds
+constexpr double kTimingsResolutionMs = 1.0;
+
+constexpr double kMinGradient = 0.5;
+constexpr double kLimitSmoothingFactor = 0.2;
+}  // namespace
+
+GradientController::GradientController(
+    const std::string& name, v2::Sensor& sensor, Limiter& limiter, Stats& stats,
+    const StaticConfig& config, dynamic_config::Source config_source,
+    std::function<v2::Config(const dynamic_config::Snapshot&)> config_getter)
+    : Controller(name, sensor, limiter, stats, config),
+      config_source_(config_source),
+      config_getter_(std::move(config_getter)) {}
+
+Limit GradientController::Update(const Sensor::Data& current) {
+  const v2::Config config = config_getter_(config_source_.GetSnapshot());
+
+  if (current.total < config.min_qps && !limit_) {
+    // Too little QPS, timings avg data is VERY noisy, EPS is noisy
+    return {std::nullopt, current.current_load};
+  }
+
+  const auto timings = static_cast<double>(current.timings_avg_ms);
+  if (epochs_passed_ < kWarmupEpochs) {
+    // First seconds of service life might be too noisy
+    UpdateNoLoadTimings(timings);
+    epochs_passed_++;
+    return {std::nullopt, current.current_load};
+  }
+
+  const bool errors = 100 * current.GetRate() > config.errors_threshold_percent;
+  const double timings_ratio =
+      (config.gradient_tolerance * no_load_timings_ + kTimingsResolutionMs) /
+      std::max(timings, kTimingsResolutionMs);
+  const double gradient =
+      errors ? kMinGradient : std::clamp(timings_ratio, kMinGradient, 1.0);
+
+  const bool overloaded = gradient < 1.0;
+  if (limit_ ? *limit_ <= config.min_limit : !overloaded) {
+    // The limit keeps the timings near the tolerance by design, so only the
+    // unlimited timings are learnt. Unless the limit can not go any lower:
+    // then the resource got slower rather than overloaded.
+    UpdateNoLoadTimings(timings);
+  }
+
+  LOG_DEBUG() << "CC " << GetName() << ":"
+              << " sensor=(" << current.ToLogString() << ")"
+              << " no_load_timings=" << no_load_timings_
+              << " gradient=" << gradient;
+
+  if (!limit_) {
+    if (!overloaded) return {std::nullopt, current.current_load};
+
+    LOG_ERROR() << GetName() << " Congestion Control is activated";
+    // With the same throughput the timings are proportional to the load, so
+    // jump right to the load that the resource handles within tolerance
+    limit_ = std::max(current.current_load * std::min(timings_ratio, gradient),
+                      static_cast<double>(config.min_limit));
+    return {static_cast<std::size_t>(*limit_), current.current_load};
+  }
+
+  if (!overloaded && *limit_ > current.current_load + config.safe_delta_limit) {
+    LOG_ERROR() << GetName() << " Congestion Control is deactivated";
+    limit_.reset();
+    return {std::nullopt, current.current_load};
+  }
+
+  double new_limit = *limit_ * gradient;
+  if (!overloaded) new_limit += std::sqrt(*limit_);
+  *limit_ += (new_limit - *limit_) * kLimitSmoothingFactor;
+  *limit_ = std::max(*limit_, static_cast<double>(config.min_limit));
+
+  return {static_cast<std::size_t>(*limit_), current.current_load};
+}
+
+void GradientController::UpdateNoLoadTimings(double timings) {
+  if (epochs_passed_ == 0) {
+    no_load_timings_ = timings;
+  } else {
+    no_load_timings_ += (timings - no_load_timings_) * kNoLoadTimingsFactor;
+  }
+}
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,198 @@
+#include <userver/utest/utest.hpp>
+
+#include <congestion_control/controllers/simulation.hpp>
+#include <userver/congestion_control/controllers/gradient.hpp>
+#include <userver/congestion_control/controllers/linear.hpp>
+#include <userver/dynamic_config/test_helpers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace v2 = congestion_control::v2;
+namespace simulation = v2::simulation;
+
+class NoopSensor final : public v2::Sensor {
+  Data GetCurrent() override { return {}; }
+};
+
+class NoopLimiter final : public congestion_control::Limiter {
+  void SetLimit(const congestion_control::Limit&) override {}
+};
+
+constexpr std::size_t kWarmupSeconds = 60;
+constexpr std::size_t kSimulationSeconds = 300;
+constexpr double kNormalRps = 1000;
+constexpr double kOverloadRps = 5000;
+
+template <typename Controller>
+class ControllerHolder final {
+ public:
+  ControllerHolder()
+      : controller_("test", sensor_, limiter_, stats_, {},
+                    dynamic_config::GetDefaultSource(),
+                    [](const auto&) { return v2::Config{}; }) {}
+
+  Controller& operator*() { return controller_; }
+  Controller* operator->() { return &controller_; }
+
+ private:
+  v2::Stats stats_;
+  NoopSensor sensor_;
+  NoopLimiter limiter_;
+  Controller controller_;
+};
+
+template <typename Controller>
+simulation::Result Simulate(const simulation::LoadCurve& curve,
+                            const simulation::Resource& resource = {}) {
+  ControllerHolder<Controller> controller;
+  return simulation::Run(
+      *controller, resource, kWarmupSeconds + kSimulationSeconds,
+      [&curve](std::size_t second) {
+        return second < kWarmupSeconds ? kNormalRps
+                                       : curve(second - kWarmupSeconds);
+      });
+}
+
+void ExpectHigherGoodput(const simulation::LoadCurve& curve) {
+  const auto linear = Simulate<v2::LinearController>(curve);
+  const auto gradient = Simulate<v2::GradientController>(curve);
+  EXPECT_GT(gradient.goodput, linear.goodput * 1.03)
+      << "linear: " << linear.goodput << ", gradient: " << gradient.goodput;
+}
+
+v2::Sensor::Data MakeData(std::size_t timings_ms, std::size_t load) {
+  v2::Sensor::Data data;
+  data.total = 100;
+  data.timings_avg_ms = timings_ms;
+  data.current_load = load;
+  return data;
+}
+
+}  // namespace
+
+TEST(CCGradient, Zero) {
+  ControllerHolder<v2::GradientController> controller;
+
+  for (size_t i = 0; i < 1000; i++) {
+    auto limit = controller->Update({});
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCGradient, FirstSeconds) {
+  ControllerHolder<v2::GradientController> controller;
+
+  for (size_t i = 0; i < 30; i++) {
+    auto limit = controller->Update(MakeData(10000, 50));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCGradient, SmallRps) {
+  ControllerHolder<v2::GradientController> controller;
+  for (size_t i = 0; i < 30; i++) {
+    auto limit = controller->Update(MakeData(100, 50));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+
+  for (size_t i = 0; i < 100; i++) {
+    auto data = MakeData(10000, 50);
+    data.total = 1;
+
+    auto limit = controller->Update(data);
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCGradient, ExtraLoad) {
+  ControllerHolder<v2::GradientController> controller;
+  for (size_t i = 0; i < 30; i++) {
+    auto limit = controller->Update(MakeData(100, 50));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+
+  // Timings are proportional to the load, the limit jumps right to the load
+  // that fits the tolerance
+  auto limit = controller->Update(MakeData(1000, 100));
+  ASSERT_NE(limit.load_limit, std::nullopt);
+  EXPECT_EQ(*limit.load_limit, 15);
+
+  // The limit goes down to `min-limit`
+  for (size_t i = 0; i < 10; i++) {
+    const auto new_limit = controller->Update(MakeData(1000, 15));
+    ASSERT_NE(new_limit.load_limit, std::nullopt) << i;
+    EXPECT_LE(*new_limit.load_limit, *limit.load_limit) << i;
+    limit = new_limit;
+  }
+  EXPECT_EQ(*limit.load_limit, 10);
+
+  // Back to normal
+  for (size_t i = 0; i < 100 && limit.load_limit; i++) {
+    limit = controller->Update(MakeData(100, 5));
+  }
+  EXPECT_EQ(limit.load_limit, std::nullopt);
+
+  for (size_t i = 0; i < 1000; i++) {
+    limit = controller->Update(MakeData(100, 50));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCGradient, Errors) {
+  ControllerHolder<v2::GradientController> controller;
+  for (size_t i = 0; i < 30; i++) {
+    controller->Update(MakeData(100, 50));
+  }
+
+  auto data = MakeData(100, 50);
+  data.timeouts = 10;
+  auto limit = controller->Update(data);
+  ASSERT_NE(limit.load_limit, std::nullopt);
+  EXPECT_EQ(*limit.load_limit, 25);
+}
+
+TEST(CCGradientSimulation, ConstantOverload) {
+  ExpectHigherGoodput([](std::size_t) { return kOverloadRps; });
+}
+
+TEST(CCGradientSimulation, TemporaryOverload) {
+  const auto curve = [](std::size_t second) {
+    return second < kSimulationSeconds / 2 ? kOverloadRps : kNormalRps;
+  };
+  ExpectHigherGoodput(curve);
+
+  const auto result = Simulate<v2::GradientController>(curve);
+  EXPECT_EQ(result.last_limit, std::nullopt);
+}
+
+TEST(CCGradientSimulation, Ramp) {
+  ExpectHigherGoodput([](std::size_t second) {
+    return kNormalRps / 2 + kOverloadRps * second / kSimulationSeconds;
+  });
+}
+
+TEST(CCGradientSimulation, Bursts) {
+  ExpectHigherGoodput([](std::size_t second) {
+    return second % 60 < 15 ? kOverloadRps : kNormalRps;
+  });
+}
+
+TEST(CCGradientSimulation, SlowerResource) {
+  // The resource is 2.5 times slower from the start, the controller should
+  // learn the new timings instead of limiting the load forever
+  ControllerHolder<v2::GradientController> controller;
+  const auto curve = [](std::size_t) { return 700.0; };
+  auto result = simulation::Run(*controller, simulation::Resource{},
+                                kWarmupSeconds, curve);
+  EXPECT_EQ(result.last_limit, std::nullopt);
+
+  simulation::Resource slower_resource;
+  slower_resource.service_time = std::chrono::milliseconds{25};
+  result =
+      simulation::Run(*controller, slower_resource, kSimulationSeconds, curve);
+  EXPECT_EQ(result.last_limit, std::nullopt);
+}
+
+USERVER_NAMESPACE_END
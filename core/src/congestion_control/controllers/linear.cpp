@@ -1,6 +1,7 @@
 #include <userver/congestion_control/controllers/linear.hpp>
 
 #include <userver/utils/impl/userver_experiments.hpp>
+#include <userver/utils/trivial_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -10,6 +11,12 @@ namespace {
 constexpr std::size_t kCurrentLoadEpochs = 3;
 constexpr std::size_t kShortTimingsEpochs = 3;
 constexpr std::size_t kLongTimingsEpochs = 30;
+
+constexpr utils::TrivialBiMap kAlgorithmMap([](auto selector) {
+  return selector()
+      .Case(Algorithm::kLinear, "linear")
+      .Case(Algorithm::kGradient, "gradient");
+});
 }  // namespace
 
 LinearController::LinearController(
@@ -101,6 +108,10 @@ LinearController::StaticConfig Parse(
   LinearController::StaticConfig config;
   config.fake_mode = value["fake-mode"].As<bool>(false);
   config.enabled = value["enabled"].As<bool>(true);
+  if (value.HasMember("algorithm")) {
+    config.algorithm =
+        utils::ParseFromValueString(value["algorithm"], kAlgorithmMap);
+  }
   return config;
 }
 
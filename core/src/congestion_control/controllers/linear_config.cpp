@@ -17,6 +17,7 @@ Config Parse(const formats::json::Value& value, formats::parse::To<Config>) {
       std::chrono::milliseconds(value["min-timings-ms"].As<std::size_t>(20));
   result.min_limit = value["min-limit"].As<std::size_t>(10);
   result.min_qps = value["min-qps"].As<std::size_t>(10);
+  result.gradient_tolerance = value["gradient-tolerance"].As<double>(1.5);
   return result;
 }
 
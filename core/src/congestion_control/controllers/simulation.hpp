@@ -0,0 +1,105 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <optional>
+
+#include <userver/congestion_control/limiter.hpp>
+#include <userver/congestion_control/sensor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// Closed-loop simulation of a congestion controlled resource, e.g. a database
+/// behind a connection pool. Used to compare the v2 controllers on synthetic
+/// load curves.
+namespace congestion_control::v2::simulation {
+
+/// The resource runs `workers` requests in parallel, each takes
+/// `service_time`. Requests above that contend for the resource and slow
+/// down all the requests, so the throughput drops under overload.
+struct Resource final {
+  double workers{20};
+  std::chrono::milliseconds service_time{10};
+  /// Throughput loss per request above `workers`
+  double contention{0.02};
+  /// Requests that take longer are timeouts
+  std::chrono::milliseconds deadline{100};
+  /// Load limit without the congestion control, e.g. the pool size
+  std::size_t max_load{100};
+};
+
+/// Requests per second for each second of the simulation
+using LoadCurve = std::function<double(std::size_t second)>;
+
+struct Epoch final {
+  Sensor::Data data;
+  double goodput{0};
+};
+
+struct Result final {
+  /// Successful requests over the whole simulation
+  double goodput{0};
+  std::optional<std::size_t> last_limit;
+};
+
+inline double GetThroughput(const Resource& resource, double load) {
+  const double overload = std::max(0.0, load - resource.workers);
+  return std::min(load, resource.workers) * 1000 /
+         resource.service_time.count() / (1 + resource.contention * overload);
+}
+
+/// Simulates a second of the resource work with `rps` offered requests.
+/// Requests above the limit wait for the resource and fail, they are not
+/// counted by the sensor.
+inline Epoch SimulateEpoch(const Resource& resource, double rps,
+                           std::optional<std::size_t> limit) {
+  const auto max_load = static_cast<double>(
+      std::max<std::size_t>(1, std::min(limit.value_or(resource.max_load),
+                                        resource.max_load)));
+  const double service_ms = resource.service_time.count();
+  const double required_load = rps * service_ms / 1000;
+
+  double load = required_load;
+  double served = rps;
+  double timings_ms = service_ms;
+  if (required_load > std::min(max_load, resource.workers)) {
+    // Queueing: all the allowed requests are running
+    load = max_load;
+    served = GetThroughput(resource, load);
+    timings_ms = load * 1000 / served;
+  }
+
+  // Exponentially distributed timings
+  const double timeouts =
+      served * std::exp(-resource.deadline.count() / timings_ms);
+
+  Epoch epoch;
+  epoch.data.total = served;
+  epoch.data.timeouts = timeouts;
+  epoch.data.timings_avg_ms = timings_ms;
+  epoch.data.current_load = load;
+  epoch.goodput = served - timeouts;
+  return epoch;
+}
+
+/// Feeds the `controller` with the resource responses to `curve` for
+/// `seconds`, the limits are applied on the next second.
+template <typename Controller>
+Result Run(Controller& controller, const Resource& resource,
+           std::size_t seconds, const LoadCurve& curve) {
+  Result result;
+  for (std::size_t second = 0; second < seconds; ++second) {
+    const auto epoch =
+        SimulateEpoch(resource, curve(second), result.last_limit);
+    result.goodput += epoch.goodput;
+    result.last_limit = controller.Update(epoch.data).load_limit;
+  }
+  return result;
+}
+
+}  // namespace congestion_control::v2::simulation
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <fmt/format.h>
 
 #include <userver/dynamic_config/value.hpp>
+#include <userver/utils/trivial_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,10 +19,18 @@ constexpr std::string_view kDumpFormatVersion = "format-version";
 constexpr std::string_view kMaxDumpCount = "max-count";
 constexpr std::string_view kWorldReadable = "world-readable";
 constexpr std::string_view kEncrypted = "encrypted";
+constexpr std::string_view kCompression = "compression";
+constexpr std::string_view kMemoryMapped = "memory-mapped";
 
 constexpr auto kDefaultFsTaskProcessor = std::string_view{"fs-task-processor"};
 constexpr auto kDefaultMaxDumpCount = uint64_t{1};
 
+constexpr utils::TrivialBiMap kCompressionMap([](auto selector) {
+  return selector()
+      .Case(Compression::kNone, "none")
+      .Case(Compression::kZlib, "zlib");
+});
+
 }  // namespace
 
 namespace impl {
@@ -40,6 +49,11 @@ std::chrono::milliseconds ParseMs(
 
 }  // namespace impl
 
+Compression Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<Compression>) {
+  return utils::ParseFromValueString(value, kCompressionMap);
+}
+
 constexpr std::string_view kDump = "dump";
 constexpr std::string_view kMaxDumpAge = "max-age";
 constexpr std::string_view kMinDumpInterval = "min-interval";
@@ -67,6 +81,8 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
           config[kMaxDumpAge].As<std::optional<std::chrono::milliseconds>>()),
       max_dump_age_set(config.HasMember(kMaxDumpAge)),
       dump_is_encrypted(config[kEncrypted].As<bool>(false)),
+      compression(config[kCompression].As<Compression>(Compression::kNone)),
+      memory_mapped(config[kMemoryMapped].As<bool>(false)),
       static_dumps_enabled(config[kDumpsEnabled].As<bool>()),
       static_min_dump_interval(
           config[kMinDumpInterval].As<std::chrono::milliseconds>(0)) {
@@ -78,6 +94,12 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
     throw std::logic_error(
         fmt::format("{}: {} must not be 0", this->name, kMaxDumpCount));
   }
+  if (memory_mapped &&
+      (dump_is_encrypted || compression != Compression::kNone)) {
+    throw std::logic_error(
+        fmt::format("{}: {} dumps can not be encrypted or compressed",
+                    this->name, kMemoryMapped));
+  }
 }
 
 DynamicConfig::DynamicConfig(const Config& config, ConfigPatch&& patch)
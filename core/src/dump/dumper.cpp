@@ -574,6 +574,19 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            compression:
+                type: string
+                description: Compression of the dump data
+                enum:
+                  - none
+                  - zlib
+                defaultDescription: none
+            memory-mapped:
+                type: boolean
+                description: |
+                    Whether to read the dump by mapping it into memory, so that
+                    dump::FlatArray data is used without deserialization
+                defaultDescription: false
 )");
 }
 
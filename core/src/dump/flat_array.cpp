@@ -0,0 +1,17 @@
+#include <userver/dump/flat_array.hpp>
+
+#include <userver/dump/operations_mapped.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+std::shared_ptr<const char> TryReadMapped(Reader& reader, std::size_t size) {
+  auto* mapped_reader = dynamic_cast<MappedFileReader*>(&reader);
+  if (!mapped_reader) return {};
+  return mapped_reader->ReadMapped(size);
+}
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,97 @@
+#include <userver/dump/flat_array.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/operations_mapped.hpp>
+#include <userver/dump/test_helpers.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Entry {
+  std::uint64_t key;
+  double value;
+};
+
+bool operator==(const Entry& lhs, const Entry& rhs) {
+  return lhs.key == rhs.key && lhs.value == rhs.value;
+}
+
+dump::FlatArray<Entry> MakeEntries(std::size_t count) {
+  std::vector<Entry> entries;
+  for (std::size_t i = 0; i < count; ++i) {
+    entries.push_back({i * 2, i * 0.5});
+  }
+  return dump::FlatArray<Entry>(std::move(entries));
+}
+
+template <typename... Values>
+void WriteDump(const std::string& path, const Values&... values) {
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  (writer.Write(values), ...);
+  writer.Finish();
+}
+
+bool IsInFile(const void* data) {
+  // The mapping is page-aligned, the values follow the 8-byte size
+  return reinterpret_cast<std::uintptr_t>(data) % 4096 == sizeof(std::uint64_t);
+}
+
+}  // namespace
+
+TEST(DumpFlatArray, WriteReadCycle) {
+  dump::TestWriteReadCycle(dump::FlatArray<int>{});
+  dump::TestWriteReadCycle(dump::FlatArray<int>({1, 2, 3}));
+  dump::TestWriteReadCycle(MakeEntries(1000));
+}
+
+UTEST(DumpFlatArray, Mapped) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+  const auto entries = MakeEntries(10'000);
+  WriteDump(path, entries);
+
+  dump::FlatArray<Entry> result;
+  {
+    dump::MappedFileReader reader(path);
+    result = reader.Read<dump::FlatArray<Entry>>();
+    reader.Finish();
+  }
+  // The old dumps are removed while the cache still uses them
+  boost::filesystem::remove(path);
+
+  EXPECT_TRUE(IsInFile(result.data()));
+  EXPECT_EQ(result, entries);
+
+  const auto it = std::lower_bound(
+      result.begin(), result.end(), 1000,
+      [](const Entry& entry, std::uint64_t key) { return entry.key < key; });
+  ASSERT_NE(it, result.end());
+  EXPECT_EQ(it->value, 250);
+}
+
+UTEST(DumpFlatArray, MappedMisaligned) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+  const auto entries = MakeEntries(100);
+  WriteDump(path, true, entries);
+
+  dump::MappedFileReader reader(path);
+  EXPECT_TRUE(reader.Read<bool>());
+  const auto result = reader.Read<dump::FlatArray<Entry>>();
+  reader.Finish();
+
+  EXPECT_FALSE(IsInFile(result.data()));
+  EXPECT_EQ(result, entries);
+}
+
+USERVER_NAMESPACE_END
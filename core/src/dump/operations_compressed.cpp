@@ -0,0 +1,235 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+#include <zlib.h>
+
+#include <userver/dump/unsafe.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+constexpr std::size_t kBufferSize = 64 * 1024;
+
+// Dumps are written periodically and read at startup, so the speed matters
+// more than the last percents of the size
+constexpr int kCompressionLevel = Z_BEST_SPEED;
+
+constexpr std::size_t kMaxChunkSize = std::numeric_limits<uInt>::max();
+
+// Written uncompressed in front of the compressed stream, followed by
+// the algorithm id, so that a dump written with another `compression` setting
+// is reported as such instead of failing somewhere in the middle
+constexpr std::string_view kFormatMarker = "USRVDMPZ";
+
+Bytef* GetBytes(std::string_view data) {
+  // zlib does not modify the input, `next_in` is non-const for historical
+  // reasons
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  return reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+}
+
+Bytef* GetBytes(std::string& data) {
+  return reinterpret_cast<Bytef*>(data.data());
+}
+
+std::string GetErrorMessage(const z_stream& stream, int code) {
+  return stream.msg ? stream.msg : fmt::format("error code {}", code);
+}
+
+void CheckCompression(Compression compression) {
+  UINVARIANT(compression == Compression::kZlib,
+             "Unexpected dump compression algorithm");
+}
+
+std::string MakeHeader(Compression compression) {
+  std::string header{kFormatMarker};
+  header.push_back(static_cast<char>(compression));
+  return header;
+}
+
+void CheckHeader(Reader& reader, Compression compression) {
+  const auto expected = MakeHeader(compression);
+  const auto header = ReadUnsafeAtMost(reader, expected.size());
+  if (header == expected) return;
+
+  if (header.size() == expected.size() &&
+      header.substr(0, kFormatMarker.size()) == kFormatMarker) {
+    throw Error(fmt::format(
+        "The dump is compressed with another algorithm: algorithm-id={}, "
+        "expected-algorithm-id={}",
+        static_cast<int>(header.back()), static_cast<int>(compression)));
+  }
+  throw Error(
+      "The compressed dump format marker is missing, the dump is not "
+      "compressed or is corrupted. Was the `compression` setting changed "
+      "without changing `format-version`?");
+}
+
+}  // namespace
+
+struct CompressedWriter::Impl {
+  std::unique_ptr<Writer> base;
+  z_stream stream{};
+  std::string buffer;
+
+  // Compresses the pending input, flushing the output to `base`
+  void Deflate(int flush) {
+    int result = Z_OK;
+    do {
+      stream.next_out = GetBytes(buffer);
+      stream.avail_out = buffer.size();
+      result = deflate(&stream, flush);
+      if (result == Z_STREAM_ERROR) {
+        throw Error(fmt::format("Failed to compress the dump: {}",
+                                GetErrorMessage(stream, result)));
+      }
+      WriteStringViewUnsafe(
+          *base, {buffer.data(), buffer.size() - stream.avail_out});
+    } while (stream.avail_out == 0);
+  }
+};
+
+CompressedWriter::CompressedWriter(std::unique_ptr<Writer> base,
+                                   Compression compression) {
+  UASSERT(base);
+  CheckCompression(compression);
+  impl_->base = std::move(base);
+  impl_->buffer.resize(kBufferSize);
+  WriteStringViewUnsafe(*impl_->base, MakeHeader(compression));
+
+  const auto result = deflateInit(&impl_->stream, kCompressionLevel);
+  if (result != Z_OK) {
+    throw Error(fmt::format("Failed to initialize the dump compression: {}",
+                            GetErrorMessage(impl_->stream, result)));
+  }
+}
+
+CompressedWriter::~CompressedWriter() { deflateEnd(&impl_->stream); }
+
+void CompressedWriter::WriteRaw(std::string_view data) {
+  while (!data.empty()) {
+    const auto chunk = data.substr(0, kMaxChunkSize);
+    data.remove_prefix(chunk.size());
+
+    impl_->stream.next_in = GetBytes(chunk);
+    impl_->stream.avail_in = chunk.size();
+    impl_->Deflate(Z_NO_FLUSH);
+    UASSERT(impl_->stream.avail_in == 0);
+  }
+}
+
+void CompressedWriter::Finish() {
+  impl_->stream.next_in = nullptr;
+  impl_->stream.avail_in = 0;
+  impl_->Deflate(Z_FINISH);
+  impl_->base->Finish();
+}
+
+struct CompressedReader::Impl {
+  std::unique_ptr<Reader> base;
+  z_stream stream{};
+  bool is_stream_end{false};
+  std::string buffer;
+};
+
+CompressedReader::CompressedReader(std::unique_ptr<Reader> base,
+                                   Compression compression) {
+  UASSERT(base);
+  CheckCompression(compression);
+  impl_->base = std::move(base);
+  CheckHeader(*impl_->base, compression);
+
+  const auto result = inflateInit(&impl_->stream);
+  if (result != Z_OK) {
+    throw Error(fmt::format("Failed to initialize the dump decompression: {}",
+                            GetErrorMessage(impl_->stream, result)));
+  }
+}
+
+CompressedReader::~CompressedReader() { inflateEnd(&impl_->stream); }
+
+std::string_view CompressedReader::ReadRaw(std::size_t max_size) {
+  auto& stream = impl_->stream;
+  auto& buffer = impl_->buffer;
+
+  // the storage of buffer is reused between ReadRaw calls
+  if (buffer.size() < max_size) {
+    buffer.resize(
+        std::max(max_size, static_cast<std::size_t>(buffer.size() * 1.5)));
+  }
+
+  std::size_t size = 0;
+  while (size < max_size && !impl_->is_stream_end) {
+    if (stream.avail_in == 0) {
+      // Only the compressed chunk being inflated is kept in memory
+      const auto input = ReadUnsafeAtMost(*impl_->base, kBufferSize);
+      if (input.empty()) break;
+      stream.next_in = GetBytes(input);
+      stream.avail_in = input.size();
+    }
+
+    stream.next_out = GetBytes(buffer) + size;
+    stream.avail_out = std::min(max_size - size, kMaxChunkSize);
+    const auto avail_out = stream.avail_out;
+
+    const auto result = inflate(&stream, Z_NO_FLUSH);
+    if (result == Z_STREAM_END) {
+      impl_->is_stream_end = true;
+    } else if (result != Z_OK && result != Z_BUF_ERROR) {
+      throw Error(fmt::format("Failed to decompress the dump: {}",
+                              GetErrorMessage(stream, result)));
+    }
+    size += avail_out - stream.avail_out;
+  }
+
+  return {buffer.data(), size};
+}
+
+void CompressedReader::Finish() {
+  if (!ReadRaw(1).empty()) {
+    throw Error("Unexpected extra data at the end of the compressed dump");
+  }
+  if (!impl_->is_stream_end) {
+    throw Error(
+        "Unexpected end-of-file while trying to read the compressed dump");
+  }
+  if (impl_->stream.avail_in != 0) {
+    throw Error(fmt::format(
+        "Unexpected extra data after the end of the compressed dump: "
+        "unread-size={}",
+        impl_->stream.avail_in));
+  }
+  impl_->base->Finish();
+}
+
+CompressedOperationsFactory::CompressedOperationsFactory(
+    std::unique_ptr<OperationsFactory> base, Compression compression)
+    : base_(std::move(base)), compression_(compression) {
+  UASSERT(base_);
+  CheckCompression(compression_);
+}
+
+std::unique_ptr<Reader> CompressedOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<CompressedReader>(
+      base_->CreateReader(std::move(full_path)), compression_);
+}
+
+std::unique_ptr<Writer> CompressedOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<CompressedWriter>(
+      base_->CreateWriter(std::move(full_path), scope), compression_);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,134 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/operations_mock.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kCompression = dump::Compression::kZlib;
+
+std::string Compress(const std::vector<std::string>& values) {
+  auto base = std::make_unique<dump::MockWriter>();
+  auto& mock_writer = *base;
+
+  dump::CompressedWriter writer(std::move(base), kCompression);
+  for (const auto& value : values) writer.Write(value);
+  writer.Finish();
+  return std::move(mock_writer).Extract();
+}
+
+dump::CompressedReader MakeReader(std::string data) {
+  return dump::CompressedReader(
+      std::make_unique<dump::MockReader>(std::move(data)), kCompression);
+}
+
+}  // namespace
+
+UTEST(DumpOperationsCompressed, WriteRead) {
+  const std::vector<std::string> values{"", "a", std::string(100'000, 'b'),
+                                        "cde"};
+  const auto compressed = Compress(values);
+
+  auto reader = MakeReader(compressed);
+  for (const auto& value : values) {
+    EXPECT_EQ(reader.Read<std::string>(), value);
+  }
+  UEXPECT_NO_THROW(reader.Finish());
+}
+
+UTEST(DumpOperationsCompressed, EmptyDump) {
+  auto reader = MakeReader(Compress({}));
+  UEXPECT_NO_THROW(reader.Finish());
+}
+
+UTEST(DumpOperationsCompressed, Overread) {
+  auto reader = MakeReader(Compress({"abc"}));
+  EXPECT_EQ(reader.Read<std::string>(), "abc");
+  UEXPECT_THROW(reader.Read<int>(), dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, Underread) {
+  auto reader = MakeReader(Compress({"abc"}));
+  // Only the size of the string is read
+  EXPECT_EQ(reader.Read<std::size_t>(), 3);
+  UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, Truncated) {
+  auto compressed = Compress({std::string(1000, 'a')});
+  compressed.pop_back();
+
+  auto reader = MakeReader(std::move(compressed));
+  EXPECT_EQ(reader.Read<std::string>(), std::string(1000, 'a'));
+  UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, ExtraDataAfterStream) {
+  auto reader = MakeReader(Compress({"abc"}) + "extra");
+  EXPECT_EQ(reader.Read<std::string>(), "abc");
+  UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, Corrupted) {
+  auto compressed = Compress({"abc"});
+  compressed.replace(compressed.size() / 2, compressed.size(),
+                     std::string(100, 'a'));
+
+  auto reader = MakeReader(std::move(compressed));
+  UEXPECT_THROW(reader.Read<std::string>(), dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, NotCompressed) {
+  dump::MockWriter writer;
+  writer.Write(std::string(100, 'a'));
+  writer.Finish();
+
+  UEXPECT_THROW_MSG(MakeReader(std::move(writer).Extract()), dump::Error,
+                    "format marker is missing");
+  UEXPECT_THROW_MSG(MakeReader(""), dump::Error, "format marker is missing");
+}
+
+UTEST(DumpOperationsCompressed, AnotherAlgorithm) {
+  auto compressed = Compress({"abc"});
+  // The algorithm id follows the 8-byte format marker
+  compressed[8] = 42;
+
+  UEXPECT_THROW_MSG(MakeReader(std::move(compressed)), dump::Error,
+                    "algorithm-id=42");
+}
+
+UTEST(DumpOperationsCompressed, Factory) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+
+  dump::CompressedOperationsFactory factory(
+      std::make_unique<dump::FileOperationsFactory>(
+          boost::filesystem::perms::owner_read),
+      kCompression);
+
+  constexpr int kCount = 100'000;
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  auto writer = factory.CreateWriter(path, scope_time);
+  for (int i = 0; i < kCount; ++i) writer->Write(i);
+  writer->Finish();
+
+  EXPECT_LT(boost::filesystem::file_size(path), kCount);
+
+  auto reader = factory.CreateReader(path);
+  for (int i = 0; i < kCount; ++i) ASSERT_EQ(reader->Read<int>(), i);
+  UEXPECT_NO_THROW(reader->Finish());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#include <userver/dump/operations_mapped.hpp>
+
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/dump/operations_file.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+std::string GetErrnoMessage() {
+  return std::error_code(errno, std::generic_category()).message();
+}
+
+std::shared_ptr<const char> MapFile(const std::string& path,
+                                    std::size_t& size) {
+  auto file = fs::blocking::FileDescriptor::Open(
+      path, fs::blocking::OpenFlag::kRead);
+  size = file.GetSize();
+  if (size == 0) return {};
+
+  void* address =
+      ::mmap(nullptr, size, PROT_READ, MAP_SHARED, file.GetNative(), 0);
+  if (address == MAP_FAILED) {
+    throw std::runtime_error(
+        fmt::format("calling ::mmap: {}", GetErrnoMessage()));
+  }
+  // The mapping outlives the file descriptor. Start reading the file ahead
+  // without waiting for the first page faults.
+  ::madvise(address, size, MADV_WILLNEED);
+
+  return std::shared_ptr<const char>(
+      static_cast<const char*>(address), [size](const char* data) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        ::munmap(const_cast<char*>(data), size);
+      });
+}
+
+}  // namespace
+
+MappedFileReader::MappedFileReader(std::string path) : path_(std::move(path)) {
+  std::size_t size = 0;
+  try {
+    mapping_ = MapFile(path_, size);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format(
+        "Failed to open the dump file for reading \"{}\". Reason: {}", path_,
+        ex.what()));
+  }
+  data_ = std::string_view{mapping_.get(), size};
+  unread_data_ = data_;
+}
+
+std::string_view MappedFileReader::ReadRaw(std::size_t max_size) {
+  const auto result = unread_data_.substr(0, max_size);
+  unread_data_.remove_prefix(result.size());
+  return result;
+}
+
+std::shared_ptr<const char> MappedFileReader::ReadMapped(std::size_t size) {
+  const auto result = ReadRaw(size);
+  if (result.size() != size) {
+    throw Error(
+        fmt::format("Unexpected end-of-file while trying to read from the dump "
+                    "file: requested-size={}",
+                    size));
+  }
+  // Shares the ownership of the whole mapping
+  return std::shared_ptr<const char>(mapping_, result.data());
+}
+
+void MappedFileReader::Finish() {
+  if (!unread_data_.empty()) {
+    throw Error(
+        fmt::format("Unexpected extra data at the end of the dump file \"{}\": "
+                    "file-size={}, position={}, unread-size={}",
+                    path_, data_.size(), data_.size() - unread_data_.size(),
+                    unread_data_.size()));
+  }
+  // The data read with `ReadMapped` keeps the mapping alive
+  mapping_.reset();
+}
+
+MappedFileOperationsFactory::MappedFileOperationsFactory(
+    boost::filesystem::perms perms)
+    : perms_(perms) {}
+
+std::unique_ptr<Reader> MappedFileOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<MappedFileReader>(std::move(full_path));
+}
+
+std::unique_ptr<Writer> MappedFileOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<FileWriter>(std::move(full_path), perms_, scope);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,88 @@
+#include <userver/dump/operations_mapped.hpp>
+
+#include <string>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string DumpFilePath(const fs::blocking::TempDirectory& dir) {
+  return dir.GetPath() + "/dump";
+}
+
+}  // namespace
+
+UTEST(DumpOperationsMapped, WriteRead) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  dump::MappedFileOperationsFactory factory(
+      boost::filesystem::perms::owner_read);
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  auto writer = factory.CreateWriter(path, scope_time);
+  writer->Write(std::string{"abc"});
+  writer->Write(42);
+  writer->Finish();
+
+  auto reader = factory.CreateReader(path);
+  EXPECT_EQ(reader->Read<std::string>(), "abc");
+  EXPECT_EQ(reader->Read<int>(), 42);
+  UEXPECT_NO_THROW(reader->Finish());
+}
+
+TEST(DumpOperationsMapped, EmptyDump) {
+  const auto file = fs::blocking::TempFile::Create();
+
+  dump::MappedFileReader reader(file.GetPath());
+  EXPECT_EQ(ReadUnsafeAtMost(reader, 1), "");
+  UEXPECT_NO_THROW(reader.Finish());
+}
+
+TEST(DumpOperationsMapped, Overread) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
+
+  dump::MappedFileReader reader(file.GetPath());
+  UEXPECT_THROW(ReadStringViewUnsafe(reader, 11), dump::Error);
+}
+
+TEST(DumpOperationsMapped, Underread) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
+
+  dump::MappedFileReader reader(file.GetPath());
+  EXPECT_EQ(ReadStringViewUnsafe(reader, 9), std::string(9, 'a'));
+  UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+TEST(DumpOperationsMapped, MissingFile) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  UEXPECT_THROW(dump::MappedFileReader{DumpFilePath(dir)}, dump::Error);
+}
+
+TEST(DumpOperationsMapped, MappedDataOutlivesReader) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), "abcdef");
+
+  std::shared_ptr<const char> data;
+  {
+    dump::MappedFileReader reader(file.GetPath());
+    EXPECT_EQ(ReadStringViewUnsafe(reader, 1), "a");
+    data = reader.ReadMapped(5);
+    reader.Finish();
+  }
+
+  EXPECT_EQ((std::string_view{data.get(), 5}), "bcdef");
+}
+
+USERVER_NAMESPACE_END
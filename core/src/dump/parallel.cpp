@@ -0,0 +1,121 @@
+#include <userver/dump/parallel.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+namespace {
+
+class ShardWriter final : public Writer {
+ public:
+  void Finish() override {}
+
+  std::string Extract() && { return std::move(data_); }
+
+ private:
+  void WriteRaw(std::string_view data) override { data_.append(data); }
+
+  std::string data_;
+};
+
+class ShardReader final : public Reader {
+ public:
+  explicit ShardReader(std::string data)
+      : data_(std::move(data)), unread_data_(data_) {}
+
+  void Finish() override {
+    if (!unread_data_.empty()) {
+      throw Error(fmt::format(
+          "Unexpected extra data at the end of a dump shard: shard-size={}, "
+          "unread-size={}",
+          data_.size(), unread_data_.size()));
+    }
+  }
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override {
+    const auto result = unread_data_.substr(0, max_size);
+    unread_data_.remove_prefix(result.size());
+    return result;
+  }
+
+  std::string data_;
+  std::string_view unread_data_;
+};
+
+}  // namespace
+
+void WriteShardsParallel(
+    Writer& writer, std::size_t shard_count, std::size_t concurrency,
+    utils::function_ref<void(Writer&, std::size_t)> write_shard) {
+  UINVARIANT(concurrency > 0, "Dump concurrency must be positive");
+  writer.Write(shard_count);
+
+  std::deque<engine::TaskWithResult<std::string>> tasks;
+  std::size_t next_shard = 0;
+  const auto start_next_shard = [&] {
+    tasks.push_back(
+        utils::Async("dump-write-shard", [write_shard, index = next_shard] {
+          ShardWriter shard_writer;
+          write_shard(shard_writer, index);
+          return std::move(shard_writer).Extract();
+        }));
+    ++next_shard;
+  };
+
+  while (next_shard < std::min(shard_count, concurrency)) start_next_shard();
+
+  while (!tasks.empty()) {
+    const auto data = tasks.front().Get();
+    tasks.pop_front();
+    // Serialization of the next shard overlaps with the write of this one
+    if (next_shard < shard_count) start_next_shard();
+    writer.Write(data);
+  }
+}
+
+void ReadShardsParallel(
+    Reader& reader, std::size_t concurrency,
+    utils::function_ref<void(std::size_t)> set_shard_count,
+    utils::function_ref<void(Reader&, std::size_t)> read_shard) {
+  UINVARIANT(concurrency > 0, "Dump concurrency must be positive");
+  const auto shard_count = reader.Read<std::size_t>();
+  set_shard_count(shard_count);
+
+  std::deque<engine::TaskWithResult<void>> tasks;
+  for (std::size_t index = 0; index < shard_count; ++index) {
+    if (tasks.size() == concurrency) {
+      tasks.front().Get();
+      tasks.pop_front();
+    }
+
+    auto data = reader.Read<std::string>();
+    tasks.push_back(utils::Async(
+        "dump-read-shard",
+        [read_shard, index, data = std::move(data)]() mutable {
+          ShardReader shard_reader(std::move(data));
+          read_shard(shard_reader, index);
+          shard_reader.Finish();
+        }));
+  }
+
+  while (!tasks.empty()) {
+    tasks.front().Get();
+    tasks.pop_front();
+  }
+}
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
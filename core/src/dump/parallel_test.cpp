@@ -0,0 +1,100 @@
+#include <userver/dump/parallel.hpp>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/operations_mock.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Shard = std::map<int, std::string>;
+
+std::vector<Shard> MakeShards(std::size_t count) {
+  std::vector<Shard> shards(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    for (std::size_t j = 0; j < i * 10; ++j) {
+      shards[i].emplace(j, std::string(j % 7, 'a' + i % 26));
+    }
+  }
+  return shards;
+}
+
+struct Throwing {};
+
+void Write(dump::Writer&, const Throwing&) {
+  throw std::runtime_error("write failed");
+}
+
+Throwing Read(dump::Reader&, dump::To<Throwing>) {
+  throw std::runtime_error("read failed");
+}
+
+}  // namespace
+
+UTEST_MT(DumpParallel, WriteRead, 4) {
+  const auto shards = MakeShards(50);
+
+  for (const std::size_t concurrency : {1, 3, 16, 100}) {
+    dump::MockWriter writer;
+    dump::WriteShardsParallel(writer, shards, concurrency);
+    writer.Finish();
+
+    dump::MockReader reader(std::move(writer).Extract());
+    EXPECT_EQ(dump::ReadShardsParallel<Shard>(reader, concurrency), shards)
+        << concurrency;
+    reader.Finish();
+  }
+}
+
+UTEST_MT(DumpParallel, Empty, 2) {
+  dump::MockWriter writer;
+  dump::WriteShardsParallel(writer, std::vector<Shard>{}, 4);
+  writer.Finish();
+
+  dump::MockReader reader(std::move(writer).Extract());
+  EXPECT_EQ(dump::ReadShardsParallel<Shard>(reader, 4), std::vector<Shard>{});
+  reader.Finish();
+}
+
+UTEST_MT(DumpParallel, SequentialFormat, 2) {
+  // Shards are stored as size-prefixed strings after the number of shards
+  const auto shards = MakeShards(5);
+
+  dump::MockWriter writer;
+  dump::WriteShardsParallel(writer, shards, 2);
+  writer.Finish();
+
+  dump::MockReader reader(std::move(writer).Extract());
+  const auto chunks = reader.Read<std::vector<std::string>>();
+  reader.Finish();
+
+  ASSERT_EQ(chunks.size(), shards.size());
+  for (std::size_t i = 0; i < shards.size(); ++i) {
+    dump::MockReader shard_reader(chunks[i]);
+    EXPECT_EQ(shard_reader.Read<Shard>(), shards[i]);
+    shard_reader.Finish();
+  }
+}
+
+UTEST_MT(DumpParallel, Errors, 2) {
+  dump::MockWriter writer;
+  UEXPECT_THROW(
+      dump::WriteShardsParallel(writer, std::vector<Throwing>(10), 3),
+      std::runtime_error);
+
+  dump::MockWriter shards_writer;
+  dump::WriteShardsParallel(shards_writer, MakeShards(10), 3);
+  shards_writer.Finish();
+
+  dump::MockReader reader(std::move(shards_writer).Extract());
+  UEXPECT_THROW(dump::ReadShardsParallel<Throwing>(reader, 3),
+                std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,104 @@
+#include <userver/dynamic_config/bundle.hpp>
+
+#include <chrono>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/dynamic_config/storage_mock.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const dynamic_config::Key kEnabled{"BENCH_ENABLED", true};
+const dynamic_config::Key kTimeoutMs{"BENCH_TIMEOUT_MS", 100};
+const dynamic_config::Key kRetries{"BENCH_RETRIES", 3};
+const dynamic_config::Key kMaxSize{"BENCH_MAX_SIZE", 1024};
+const dynamic_config::Key kRatio{"BENCH_RATIO", 0.5};
+const dynamic_config::Key kPriority{"BENCH_PRIORITY", 7};
+const dynamic_config::Key kEndpoint{"BENCH_ENDPOINT", std::string{"a.net"}};
+const dynamic_config::Key kLogLevel{"BENCH_LOG_LEVEL", std::string{"info"}};
+
+struct Settings final {
+  bool enabled;
+  std::chrono::milliseconds timeout;
+  int retries;
+  int max_size;
+  double ratio;
+  int priority;
+  std::string endpoint;
+  std::string log_level;
+};
+
+dynamic_config::StorageMock MakeStorage() {
+  return {
+      {kEnabled, true},     {kTimeoutMs, 100},    {kRetries, 3},
+      {kMaxSize, 1024},     {kRatio, 0.5},        {kPriority, 7},
+      {kEndpoint, "a.net"}, {kLogLevel, "info"},
+  };
+}
+
+Settings MakeSettings(const dynamic_config::Snapshot& config) {
+  return Settings{
+      config[kEnabled],
+      std::chrono::milliseconds{config[kTimeoutMs]},
+      config[kRetries],
+      config[kMaxSize],
+      config[kRatio],
+      config[kPriority],
+      config[kEndpoint],
+      config[kLogLevel],
+  };
+}
+
+std::size_t UseSnapshot(const dynamic_config::Source& source) {
+  const auto config = source.GetSnapshot();
+  return config[kEnabled] + config[kTimeoutMs] + config[kRetries] +
+         config[kMaxSize] + static_cast<int>(config[kRatio]) +
+         config[kPriority] + config[kEndpoint].size() +
+         config[kLogLevel].size();
+}
+
+std::size_t UseBundle(const dynamic_config::Bundle<Settings>& bundle) {
+  const auto settings = bundle.Read();
+  return settings->enabled + settings->timeout.count() + settings->retries +
+         settings->max_size + static_cast<int>(settings->ratio) +
+         settings->priority + settings->endpoint.size() +
+         settings->log_level.size();
+}
+
+}  // namespace
+
+void dynamic_config_snapshot_lookups(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    const auto storage = MakeStorage();
+    const auto source = storage.GetSource();
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      for ([[maybe_unused]] auto _ : range) {
+        benchmark::DoNotOptimize(UseSnapshot(source));
+      }
+    });
+  });
+}
+BENCHMARK(dynamic_config_snapshot_lookups)->RangeMultiplier(2)->Range(1, 16);
+
+void dynamic_config_bundle(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    const auto storage = MakeStorage();
+    const dynamic_config::Bundle<Settings> bundle{storage.GetSource(),
+                                                  "benchmark", &MakeSettings};
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      for ([[maybe_unused]] auto _ : range) {
+        benchmark::DoNotOptimize(UseBundle(bundle));
+      }
+    });
+  });
+}
+BENCHMARK(dynamic_config_bundle)->RangeMultiplier(2)->Range(1, 16);
+
+USERVER_NAMESPACE_END
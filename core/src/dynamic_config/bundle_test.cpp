@@ -0,0 +1,123 @@
+#include <userver/dynamic_config/bundle.hpp>
+
+#include <chrono>
+#include <string>
+
+#include <userver/dynamic_config/storage_mock.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const dynamic_config::Key kTimeoutMs{"SAMPLE_TIMEOUT_MS", 100};
+const dynamic_config::Key kRetries{"SAMPLE_RETRIES", 3};
+const dynamic_config::Key kEndpoint{"SAMPLE_ENDPOINT", std::string{"a.net"}};
+
+/// [Sample dynamic_config::Bundle usage]
+// Only the values needed on the hot path
+struct ClientSettings final {
+  std::chrono::milliseconds attempt_timeout;
+  int attempts;
+  std::string url;
+};
+
+ClientSettings MakeClientSettings(const dynamic_config::Snapshot& config) {
+  const auto attempts = config[kRetries] + 1;
+  return ClientSettings{
+      std::chrono::milliseconds{config[kTimeoutMs]} / attempts,
+      attempts,
+      "https://" + config[kEndpoint] + "/v1/",
+  };
+}
+
+class Client final {
+ public:
+  explicit Client(dynamic_config::Source config_source)
+      : settings_(config_source, "client", &MakeClientSettings) {}
+
+  std::string MakeRequestUrl(std::string_view path) const {
+    // A single pointer read instead of a snapshot and 3 lookups
+    const auto settings = settings_.Read();
+    return settings->url + std::string{path};
+  }
+
+  int GetAttempts() const { return settings_.ReadCopy().attempts; }
+
+ private:
+  dynamic_config::Bundle<ClientSettings> settings_;
+};
+/// [Sample dynamic_config::Bundle usage]
+
+}  // namespace
+
+UTEST(DynamicConfigBundle, Read) {
+  dynamic_config::StorageMock storage{
+      {kTimeoutMs, 400}, {kRetries, 3}, {kEndpoint, "example.com"}};
+  dynamic_config::Bundle<ClientSettings> bundle{storage.GetSource(), "test",
+                                                &MakeClientSettings};
+
+  const auto settings = bundle.Read();
+  EXPECT_EQ(settings->attempt_timeout, std::chrono::milliseconds{100});
+  EXPECT_EQ(settings->attempts, 4);
+  EXPECT_EQ(settings->url, "https://example.com/v1/");
+  EXPECT_EQ(bundle.ReadCopy().url, settings->url);
+}
+
+UTEST(DynamicConfigBundle, Update) {
+  dynamic_config::StorageMock storage{
+      {kTimeoutMs, 400}, {kRetries, 3}, {kEndpoint, "example.com"}};
+  const Client client{storage.GetSource()};
+
+  EXPECT_EQ(client.MakeRequestUrl("ping"), "https://example.com/v1/ping");
+  EXPECT_EQ(client.GetAttempts(), 4);
+
+  {
+    // Old values stay valid while they are being read
+    dynamic_config::Bundle<ClientSettings> bundle{storage.GetSource(), "test",
+                                                  &MakeClientSettings};
+    const auto old_settings = bundle.Read();
+
+    storage.Extend({{kRetries, 0}, {kEndpoint, "example.org"}});
+    EXPECT_EQ(old_settings->url, "https://example.com/v1/");
+    EXPECT_EQ(bundle.ReadCopy().url, "https://example.org/v1/");
+  }
+
+  EXPECT_EQ(client.MakeRequestUrl("ping"), "https://example.org/v1/ping");
+  EXPECT_EQ(client.GetAttempts(), 1);
+}
+
+UTEST(DynamicConfigBundle, FactoryCalls) {
+  dynamic_config::StorageMock storage{
+      {kTimeoutMs, 400}, {kRetries, 3}, {kEndpoint, "example.com"}};
+
+  int calls = 0;
+  dynamic_config::Bundle<int> bundle{
+      storage.GetSource(), "test",
+      [&calls](const dynamic_config::Snapshot& config) {
+        ++calls;
+        return config[kRetries];
+      }};
+  // The value is built once on construction
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(bundle.ReadCopy(), 3);
+
+  storage.Extend({{kRetries, 5}});
+  EXPECT_EQ(calls, 2);
+  EXPECT_EQ(bundle.ReadCopy(), 5);
+}
+
+UTEST(DynamicConfigBundle, FactoryFailure) {
+  dynamic_config::StorageMock storage{
+      {kTimeoutMs, 400}, {kRetries, 3}, {kEndpoint, "example.com"}};
+
+  const auto failing_factory =
+      [](const dynamic_config::Snapshot&) -> ClientSettings {
+    throw std::runtime_error("bad config");
+  };
+  UEXPECT_THROW((dynamic_config::Bundle<ClientSettings>{
+                    storage.GetSource(), "test", failing_factory}),
+                std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -33,6 +33,10 @@ Snapshot::Snapshot(const impl::StorageData& storage) : impl_(storage) {}
 
 const impl::SnapshotData& Snapshot::GetData() const { return *impl_->data_ptr; }
 
+bool Snapshot::IsSameConfig(const Snapshot& other) const noexcept {
+  return impl_->data_ptr.Get() == other.impl_->data_ptr.Get();
+}
+
 }  // namespace dynamic_config
 
 USERVER_NAMESPACE_END
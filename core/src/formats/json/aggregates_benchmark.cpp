@@ -0,0 +1,125 @@
+#include <userver/formats/json/aggregates.hpp>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Order {
+  std::int64_t id;
+  std::string customer;
+  double price;
+  bool paid;
+  std::vector<std::string> items;
+};
+
+formats::json::Value Serialize(const Order& order,
+                               formats::serialize::To<formats::json::Value>) {
+  formats::json::ValueBuilder builder;
+  builder["id"] = order.id;
+  builder["customer"] = order.customer;
+  builder["price"] = order.price;
+  builder["paid"] = order.paid;
+  builder["items"] = order.items;
+  return builder.ExtractValue();
+}
+
+Order Parse(const formats::json::Value& value, formats::parse::To<Order>) {
+  return Order{
+      value["id"].As<std::int64_t>(),
+      value["customer"].As<std::string>(),
+      value["price"].As<double>(),
+      value["paid"].As<bool>(),
+      value["items"].As<std::vector<std::string>>(),
+  };
+}
+
+}  // namespace
+
+template <>
+struct formats::json::IsJsonAggregate<Order> {
+  static constexpr std::string_view kNames[] = {"id", "customer", "price",
+                                                "paid", "items"};
+};
+
+namespace {
+
+std::vector<Order> MakeOrders(std::size_t count) {
+  std::vector<Order> orders;
+  orders.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    orders.push_back(Order{static_cast<std::int64_t>(i),
+                           "customer-" + std::to_string(i), i * 1.5, i % 2 == 0,
+                           {"apple", "banana", "cherry"}});
+  }
+  return orders;
+}
+
+struct Orders {
+  std::vector<Order> orders;
+};
+
+}  // namespace
+
+template <>
+struct formats::json::IsJsonAggregate<Orders> {
+  static constexpr std::string_view kNames[] = {"orders"};
+};
+
+namespace {
+
+std::string WriteOrders(const Orders& orders) {
+  formats::json::StringBuilder sb;
+  WriteToStream(orders, sb);
+  return sb.GetString();
+}
+
+}  // namespace
+
+void json_aggregates_serialize_dom(benchmark::State& state) {
+  const auto orders = MakeOrders(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    formats::json::ValueBuilder builder;
+    builder["orders"] = orders;
+    benchmark::DoNotOptimize(ToString(builder.ExtractValue()));
+  }
+}
+BENCHMARK(json_aggregates_serialize_dom)->RangeMultiplier(10)->Range(1, 1000);
+
+void json_aggregates_serialize_sax(benchmark::State& state) {
+  const Orders orders{MakeOrders(state.range(0))};
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(WriteOrders(orders));
+  }
+}
+BENCHMARK(json_aggregates_serialize_sax)->RangeMultiplier(10)->Range(1, 1000);
+
+void json_aggregates_parse_dom(benchmark::State& state) {
+  const auto input = WriteOrders(Orders{MakeOrders(state.range(0))});
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(formats::json::FromString(input)["orders"]
+                                 .As<std::vector<Order>>());
+  }
+}
+BENCHMARK(json_aggregates_parse_dom)->RangeMultiplier(10)->Range(1, 1000);
+
+void json_aggregates_parse_sax(benchmark::State& state) {
+  namespace fjp = formats::json::parser;
+  const auto input = WriteOrders(Orders{MakeOrders(state.range(0))});
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        fjp::ParseToType<Orders, fjp::AggregateParser<Orders>>(input));
+  }
+}
+BENCHMARK(json_aggregates_parse_sax)->RangeMultiplier(10)->Range(1, 1000);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,146 @@
+#include <userver/formats/json/aggregates.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Point {
+  double x;
+  double y;
+};
+
+bool operator==(const Point& lhs, const Point& rhs) {
+  return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+struct Place {
+  std::int64_t id;
+  std::string name;
+  bool visible;
+  Point location;
+  std::vector<std::string> tags;
+  std::vector<Point> border;
+  std::optional<std::int32_t> rating;
+};
+
+bool operator==(const Place& lhs, const Place& rhs) {
+  return lhs.id == rhs.id && lhs.name == rhs.name &&
+         lhs.visible == rhs.visible && lhs.location == rhs.location &&
+         lhs.tags == rhs.tags && lhs.border == rhs.border &&
+         lhs.rating == rhs.rating;
+}
+
+struct NotMarked {
+  int value;
+};
+
+}  // namespace
+
+template <>
+struct formats::json::IsJsonAggregate<Point> {
+  static constexpr std::string_view kNames[] = {"x", "y"};
+};
+
+template <>
+struct formats::json::IsJsonAggregate<Place> {
+  static constexpr std::string_view kNames[] = {
+      "id", "name", "visible", "location", "tags", "border", "rating"};
+};
+
+namespace {
+
+namespace fjp = formats::json::parser;
+
+const Place kPlace{
+    42,   "Red \"square\"", true, {37.62, 55.75}, {"square", "center"},
+    {{1, 2}, {3, 4}},       5,
+};
+
+std::string ToJsonString(const Place& place) {
+  formats::json::StringBuilder sb;
+  WriteToStream(place, sb);
+  return sb.GetString();
+}
+
+Place ParsePlace(std::string_view input) {
+  return fjp::ParseToType<Place, fjp::AggregateParser<Place>>(input);
+}
+
+}  // namespace
+
+TEST(JsonAggregates, Traits) {
+  static_assert(formats::json::impl::kIsJsonAggregate<Point>);
+  static_assert(formats::json::impl::kIsJsonAggregate<Place>);
+  static_assert(!formats::json::impl::kIsJsonAggregate<NotMarked>);
+  static_assert(!formats::json::impl::kIsJsonAggregate<int>);
+  static_assert(!formats::json::impl::kIsJsonAggregate<std::string>);
+}
+
+TEST(JsonAggregates, Write) {
+  EXPECT_EQ(ToJsonString(kPlace),
+            R"({"id":42,"name":"Red \"square\"","visible":true,)"
+            R"("location":{"x":37.62,"y":55.75},"tags":["square","center"],)"
+            R"("border":[{"x":1.0,"y":2.0},{"x":3.0,"y":4.0}],"rating":5})");
+
+  auto place = kPlace;
+  place.rating.reset();
+  place.tags.clear();
+  EXPECT_EQ(formats::json::FromString(ToJsonString(place))["rating"],
+            formats::json::ValueBuilder{nullptr}.ExtractValue());
+  EXPECT_TRUE(formats::json::FromString(ToJsonString(place))["tags"].IsEmpty());
+}
+
+TEST(JsonAggregates, Parse) {
+  EXPECT_EQ(ParsePlace(ToJsonString(kPlace)), kPlace);
+
+  auto place = kPlace;
+  place.rating.reset();
+  EXPECT_EQ(ParsePlace(ToJsonString(place)), place);
+
+  const auto parsed = ParsePlace(R"({
+    "border": [], "tags": [], "location": {"y": 2, "x": 1},
+    "name": "n", "visible": false, "id": -1
+  })");
+  EXPECT_EQ(parsed, (Place{-1, "n", false, {1, 2}, {}, {}, std::nullopt}));
+}
+
+TEST(JsonAggregates, ParseSkipsUnknownFields) {
+  const auto parsed = ParsePlace(R"({
+    "unknown": {"a": [1, {"b": null}], "c": "d"},
+    "id": 1, "name": "n", "visible": true, "location": {"x": 0, "y": 0},
+    "other": [[], {}, 1.5, "s", true, null],
+    "tags": ["t"], "border": [], "rating": null, "last": 3
+  })");
+  EXPECT_EQ(parsed, (Place{1, "n", true, {0, 0}, {"t"}, {}, std::nullopt}));
+}
+
+TEST(JsonAggregates, ParseErrors) {
+  EXPECT_THROW(ParsePlace("[]"), fjp::ParseError);
+  EXPECT_THROW(ParsePlace(R"({"id": 1})"), fjp::ParseError);
+  EXPECT_THROW(ParsePlace(R"({"id": "1", "name": "n", "visible": true,
+    "location": {"x": 0, "y": 0}, "tags": [], "border": []})"),
+               fjp::ParseError);
+  EXPECT_THROW(ParsePlace(R"({"id": 1, "name": "n", "visible": true,
+    "location": {"x": 0}, "tags": [], "border": []})"),
+               fjp::ParseError);
+
+  try {
+    ParsePlace(R"({"id": 1, "name": "n", "visible": true,
+      "location": {"x": 0, "y": 0}, "tags": [1], "border": []})");
+    FAIL() << "parse error was expected";
+  } catch (const fjp::ParseError& e) {
+    EXPECT_NE(std::string{e.what()}.find("path 'tags.[0]'"), std::string::npos)
+        << e.what();
+  }
+}
+
+USERVER_NAMESPACE_END
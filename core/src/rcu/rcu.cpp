@@ -1,16 +1,136 @@
 #include <userver/rcu/rcu.hpp>
 
 #include <atomic>
+#include <mutex>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace rcu::impl {
 
+namespace {
+
+// Reader counters of a thread, indexed by the parity of the pinned epoch.
+// Slots are never destroyed, a slot of an exited thread is reused by another
+// thread. Counters of a slot may be decremented by other threads, if a reader
+// migrated between threads.
+struct alignas(concurrent::impl::kDestructiveInterferenceSize)
+    EpochReaderSlot final {
+  std::atomic<std::uint64_t> readers[2]{0, 0};
+  std::atomic<bool> is_owned{true};
+  EpochReaderSlot* next{nullptr};
+};
+
+struct EpochDomain final {
+  std::atomic<std::uint64_t> global_epoch{1};
+  std::atomic<std::uint64_t> completed_epoch{0};
+  std::atomic<EpochReaderSlot*> slots_head{nullptr};
+  std::mutex advance_mutex;
+};
+
+EpochDomain& GetEpochDomain() noexcept {
+  static EpochDomain domain;
+  return domain;
+}
+
+EpochReaderSlot& AcquireSlot() {
+  auto& domain = GetEpochDomain();
+
+  for (auto* slot = domain.slots_head.load(); slot; slot = slot->next) {
+    bool is_owned = false;
+    if (!slot->is_owned.load(std::memory_order_relaxed) &&
+        slot->is_owned.compare_exchange_strong(is_owned, true)) {
+      return *slot;
+    }
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+  auto* slot = new EpochReaderSlot();
+  auto* head = domain.slots_head.load();
+  do {
+    slot->next = head;
+  } while (!domain.slots_head.compare_exchange_weak(head, slot));
+  return *slot;
+}
+
+// Returns the slot to the domain on thread exit
+class LocalReaderSlot final {
+ public:
+  LocalReaderSlot() = default;
+  LocalReaderSlot(const LocalReaderSlot&) = delete;
+  LocalReaderSlot& operator=(const LocalReaderSlot&) = delete;
+
+  ~LocalReaderSlot() {
+    if (slot_) slot_->is_owned.store(false);
+  }
+
+  EpochReaderSlot& Get() {
+    if (!slot_) slot_ = &AcquireSlot();
+    return *slot_;
+  }
+
+ private:
+  EpochReaderSlot* slot_{nullptr};
+};
+
+compiler::ThreadLocal local_reader_slot = [] { return LocalReaderSlot{}; };
+
+bool HasReaders(const EpochDomain& domain, std::uint64_t epoch) noexcept {
+  for (auto* slot = domain.slots_head.load(); slot; slot = slot->next) {
+    if (slot->readers[epoch & 1].load() != 0) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
 uint64_t GetNextEpoch() noexcept {
   static std::atomic<uint64_t> counter{1};  // 0 is the default value in data
   return counter++;
 }
 
+EpochReadLock EpochReadLock::Acquire() noexcept {
+  auto& domain = GetEpochDomain();
+  auto local_slot = local_reader_slot.Use();
+  auto& slot = local_slot->Get();
+
+  while (true) {
+    const auto epoch = domain.global_epoch.load();
+    auto& counter = slot.readers[epoch & 1];
+    counter.fetch_add(1);
+    // If the epoch was advanced meanwhile, the writer might have missed our
+    // counter while checking for the readers of the previous epochs
+    if (domain.global_epoch.load() == epoch) return EpochReadLock{&counter};
+    counter.fetch_sub(1, std::memory_order_release);
+  }
+}
+
+std::uint64_t GetGlobalEpoch() noexcept {
+  return GetEpochDomain().global_epoch.load();
+}
+
+std::uint64_t TryAdvanceGlobalEpoch() noexcept {
+  auto& domain = GetEpochDomain();
+  std::unique_lock lock(domain.advance_mutex, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    // Someone else is advancing the epoch
+    return domain.completed_epoch.load();
+  }
+
+  // Readers may only pin the current epoch and the previous one. Advancing
+  // twice completes the current epoch if there are no readers at all.
+  for (int i = 0; i < 2; ++i) {
+    const auto epoch = domain.global_epoch.load();
+    if (HasReaders(domain, epoch - 1)) break;
+
+    // The counters of epoch - 1 are reused by epoch + 1
+    domain.completed_epoch.store(epoch - 1);
+    domain.global_epoch.store(epoch + 1);
+  }
+  return domain.completed_epoch.load();
+}
+
 }  // namespace rcu::impl
 
 USERVER_NAMESPACE_END
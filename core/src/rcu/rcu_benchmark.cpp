@@ -135,4 +135,104 @@ void rcu_of_shared_ptr(benchmark::State& state) {
 }
 BENCHMARK(rcu_of_shared_ptr)->RangeMultiplier(2)->Range(1, 32);
 
+template <typename RcuTraits>
+void rcu_read_many_threads(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    rcu::Variable<std::uint64_t, RcuTraits> var{42};
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      for ([[maybe_unused]] auto _ : range) {
+        const auto reader = var.Read();
+        benchmark::DoNotOptimize(*reader);
+      }
+    });
+  });
+}
+BENCHMARK_TEMPLATE(rcu_read_many_threads, rcu::DefaultRcuTraits<std::uint64_t>)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK_TEMPLATE(rcu_read_many_threads, rcu::EpochRcuTraits<std::uint64_t>)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
+// Readers on all the threads, a single writer updates the value once in
+// a while, like config updates do.
+template <typename RcuTraits>
+void rcu_read_many_threads_with_writer(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    std::atomic<bool> run{true};
+    rcu::Variable<std::uint64_t, RcuTraits> var{0};
+
+    auto writer = utils::Async("writer", [&] {
+      std::uint64_t i = 0;
+      while (run) {
+        var.Assign(++i);
+        engine::SleepFor(std::chrono::microseconds{100});
+      }
+    });
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      for ([[maybe_unused]] auto _ : range) {
+        const auto reader = var.Read();
+        benchmark::DoNotOptimize(*reader);
+      }
+    });
+
+    run = false;
+    writer.Get();
+  });
+}
+BENCHMARK_TEMPLATE(rcu_read_many_threads_with_writer,
+                   rcu::DefaultRcuTraits<std::uint64_t>)
+    ->RangeMultiplier(2)
+    ->Range(2, 32);
+BENCHMARK_TEMPLATE(rcu_read_many_threads_with_writer,
+                   rcu::EpochRcuTraits<std::uint64_t>)
+    ->RangeMultiplier(2)
+    ->Range(2, 32);
+
+// Writes contending with readers that keep several ReadablePtr each
+template <typename RcuTraits>
+void rcu_write_many_readers(benchmark::State& state) {
+  const std::size_t readers_count = state.range(0);
+
+  engine::RunStandalone(std::min(readers_count + 1, std::size_t{8}), [&] {
+    std::atomic<bool> run{true};
+    rcu::Variable<std::uint64_t, RcuTraits> var{0};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(readers_count);
+    for (std::size_t j = 0; j < readers_count; ++j) {
+      tasks.push_back(utils::Async("reader", [&] {
+        std::vector<rcu::ReadablePtr<std::uint64_t, RcuTraits>> pointers;
+        pointers.reserve(4);
+        while (run) {
+          for (std::size_t i = 0; i < 4; ++i) {
+            pointers.push_back(var.Read());
+            benchmark::DoNotOptimize(pointers.back());
+          }
+          engine::Yield();
+          pointers.clear();
+        }
+      }));
+    }
+
+    std::uint64_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      var.Assign(++i);
+    }
+
+    run = false;
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+BENCHMARK_TEMPLATE(rcu_write_many_readers, rcu::DefaultRcuTraits<std::uint64_t>)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+BENCHMARK_TEMPLATE(rcu_write_many_readers, rcu::EpochRcuTraits<std::uint64_t>)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
 USERVER_NAMESPACE_END
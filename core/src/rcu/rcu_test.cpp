@@ -624,4 +624,111 @@ TEST(Rcu, StdMutexConcurrentWrites) {
   EXPECT_EQ(std::make_pair(3, 2), *reader);
 }
 
+UTEST(Rcu, EpochChangeRead) {
+  rcu::Variable<X, rcu::EpochRcuTraits<X>> ptr(1, 2);
+
+  auto reader1 = ptr.Read();
+  {
+    auto writer = ptr.StartWrite();
+    writer->first = 3;
+    writer.Commit();
+  }
+  EXPECT_EQ(std::make_pair(1, 2), *reader1);
+
+  const auto reader1_copy = reader1;
+  EXPECT_EQ(reader1.Get(), reader1_copy.Get());
+
+  auto reader2 = ptr.Read();
+  EXPECT_EQ(std::make_pair(3, 2), *reader2);
+
+  reader2 = std::move(reader1);
+  EXPECT_EQ(std::make_pair(1, 2), *reader2);
+}
+
+UTEST(Rcu, EpochSyncDestruction) {
+  std::atomic<bool> destroyed[3]{false, false, false};
+  {
+    rcu::Variable<DestructionTracker, rcu::EpochRcuTraits<DestructionTracker>>
+        var{rcu::DestructionType::kSync, destroyed[0]};
+
+    var.Emplace(destroyed[1]);
+    EXPECT_TRUE(destroyed[0]);
+
+    {
+      const auto reader = var.Read();
+      var.Emplace(destroyed[2]);
+      EXPECT_FALSE(destroyed[1]);
+    }
+
+    var.Cleanup();
+    EXPECT_TRUE(destroyed[1]);
+    EXPECT_FALSE(destroyed[2]);
+  }
+  EXPECT_TRUE(destroyed[2]);
+}
+
+UTEST(Rcu, EpochAsyncReclamation) {
+  std::atomic<bool> destroyed[2]{false, false};
+  rcu::Variable<DestructionTracker, rcu::EpochRcuTraits<DestructionTracker>>
+      var{rcu::DestructionType::kAsync, destroyed[0]};
+
+  {
+    const auto reader = var.Read();
+    var.Emplace(destroyed[1]);
+    engine::SleepFor(std::chrono::milliseconds{10});
+    EXPECT_FALSE(destroyed[0]);
+  }
+
+  // The background task of the variable destroys the old value
+  while (!destroyed[0]) {
+    engine::SleepFor(std::chrono::milliseconds{1});
+  }
+  EXPECT_FALSE(destroyed[1]);
+}
+
+UTEST_MT(Rcu, EpochTortureTest, kTotalTasks) {
+  using EpochRcuTraits = rcu::EpochRcuTraits<CleaningUpInt>;
+  rcu::Variable<CleaningUpInt, EpochRcuTraits> data{1};
+  std::atomic<bool> keep_running{true};
+
+  engine::Mutex ping_pong_mutex;
+  rcu::ReadablePtr<CleaningUpInt, EpochRcuTraits> ptr = data.Read();
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+
+  for (std::size_t i = 0; i < kReadablePtrPingPongTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        std::lock_guard lock(ping_pong_mutex);
+        // copy a ptr created by another thread
+        ptr = rcu::ReadablePtr{ptr};
+        ASSERT_GT(ptr->value, 0);
+        ptr = data.Read();
+      }
+    }));
+  }
+
+  for (std::size_t i = 0; i < kReadingTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        const auto local_ptr = data.Read();
+        engine::Yield();
+        ASSERT_GT(local_ptr->value, 0);
+      }
+    }));
+  }
+
+  for (std::size_t i = 0; i < kWritingTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        const auto old = data.Read();
+        data.Assign(CleaningUpInt{old->value + 1});
+      }
+    }));
+  }
+
+  engine::SleepFor(std::chrono::milliseconds{100});
+  keep_running = false;
+}
+
 USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/ugrpc/tests/service.hpp>
 #include <userver/utils/algo.hpp>
@@ -104,6 +105,18 @@ void NewClientRepeated(GrpcClientTest& client_factory) {
   }
 }
 
+// Arg 1 polls the server completion queues from the engine workers
+GrpcClientTest MakePingPongService(bool poll_in_engine) {
+  server::ServerConfig config;
+  config.completion_queue_num = 1;
+  if (poll_in_engine) {
+    config.completion_queue_task_processor =
+        &engine::current_task::GetTaskProcessor();
+  }
+  return GrpcClientTest{dynamic_config::MakeDefaultStorage({}),
+                        std::move(config)};
+}
+
 }  // namespace
 
 void UnaryRPC(benchmark::State& state) {
@@ -134,6 +147,42 @@ void UnaryRPCNewClient(benchmark::State& state) {
 
 BENCHMARK(UnaryRPCNewClient)->DenseRange(1, 4)->Unit(benchmark::kMicrosecond);
 
+void UnaryRPCPingPong(benchmark::State& state) {
+  engine::RunStandalone(2, [&] {
+    auto client_factory = MakePingPongService(state.range(0) != 0);
+    auto client =
+        client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    for (auto _ : state) {
+      UnaryRPCPayload(client);
+    }
+  });
+}
+
+BENCHMARK(UnaryRPCPingPong)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+void StreamPingPong(benchmark::State& state) {
+  engine::RunStandalone(2, [&] {
+    auto client_factory = MakePingPongService(state.range(0) != 0);
+    auto client =
+        client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    auto stream = client.Chat();
+
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_name("userver");
+    sample::ugrpc::StreamGreetingResponse response;
+    for (auto _ : state) {
+      UINVARIANT(stream.Write(request), "Behavior broken");
+      UINVARIANT(stream.Read(response), "Behavior broken");
+    }
+
+    UINVARIANT(stream.WritesDone(), "Behavior broken");
+    UINVARIANT(!stream.Read(response), "Behavior broken");
+  });
+}
+
+BENCHMARK(StreamPingPong)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
 void BatchOfUnaryRPC(benchmark::State& state) {
   engine::RunStandalone(
       state.range(0),
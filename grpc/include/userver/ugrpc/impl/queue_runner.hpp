@@ -1,21 +1,54 @@
 #pragma once
 
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <vector>
+
 #include <grpcpp/completion_queue.h>
 
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/single_use_event.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::impl {
 
+/// How the events of a completion queue are delivered to the coroutines
+struct QueuePollingSettings final {
+  /// If set, the queue is polled by tasks of this task processor, otherwise
+  /// by a dedicated thread. The idle polling tasks park, and the dedicated
+  /// thread wakes them up on the next event.
+  engine::TaskProcessor* task_processor{nullptr};
+
+  /// Number of polling tasks per queue
+  std::size_t pollers{1};
+};
+
 class QueueRunner final {
  public:
-  explicit QueueRunner(grpc::CompletionQueue& queue);
+  explicit QueueRunner(grpc::CompletionQueue& queue,
+                       const QueuePollingSettings& settings = {});
   ~QueueRunner();
 
  private:
+  void ProcessQueue() noexcept;
+  void PollQueue(engine::SingleConsumerEvent& wakeup) noexcept;
+  void ParkPoller();
+
   grpc::CompletionQueue& queue_;
   engine::SingleUseEvent completion_;
+
+  // The dedicated thread blocks on the queue only when all pollers are parked
+  std::mutex pollers_mutex_;
+  std::condition_variable pollers_parked_;
+  std::size_t active_pollers_{0};
+  std::deque<engine::SingleConsumerEvent> wakeups_;
+
+  std::vector<engine::TaskWithResult<void>> pollers_;
 };
 
 }  // namespace ugrpc::impl
@@ -5,6 +5,7 @@
 #include <grpcpp/server_builder.h>
 
 #include <userver/ugrpc/impl/completion_queues.hpp>
+#include <userver/ugrpc/impl/queue_runner.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -17,7 +18,8 @@ namespace ugrpc::server::impl {
 /// instances are destroyed.
 class QueueHolder final {
  public:
-  explicit QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder);
+  QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder,
+              const ugrpc::impl::QueuePollingSettings& polling_settings = {});
 
   QueueHolder(QueueHolder&&) = delete;
   QueueHolder& operator=(QueueHolder&&) = delete;
@@ -3,6 +3,7 @@
 /// @file userver/ugrpc/server/server.hpp
 /// @brief @copybrief ugrpc::server::Server
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <unordered_map>
@@ -42,6 +43,17 @@ struct ServerConfig final {
   /// of worker threads for best RPS.
   int completion_queue_num{2};
 
+  /// If set, the completion queues are polled by tasks of this task processor
+  /// instead of dedicated threads. This saves a thread hop per event. Pollers
+  /// never block the worker threads: an idle poller sleeps for up to 1ms
+  /// between non-blocking checks, so the first event after an idle period may
+  /// be delivered with up to 1ms delay.
+  engine::TaskProcessor* completion_queue_task_processor{nullptr};
+
+  /// Number of polling tasks per completion queue, used together with
+  /// `completion_queue_task_processor`
+  std::size_t completion_queue_pollers{1};
+
   /// Optional grpc-core channel args
   /// @see https://grpc.github.io/grpc/core/group__grpc__arg__keys.html
   std::unordered_map<std::string, std::string> channel_args{};
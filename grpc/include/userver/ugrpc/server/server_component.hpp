@@ -30,6 +30,8 @@ struct ServiceDefaults;
 /// port | the port to use for all gRPC services, or 0 to pick any available | -
 /// unix-socket-path | unix socket absolute path to listen to, instead of listening on `port` | -
 /// completion-queue-count | count of completion queues to create | 2
+/// completion-queue-task-processor | if set, completion queues are polled by tasks of this task processor instead of dedicated threads | -
+/// completion-queue-pollers | count of polling tasks per completion queue, used with `completion-queue-task-processor` | 1
 /// channel-args | a map of channel arguments, see gRPC Core docs | {}
 /// native-log-level | min log level for the native gRPC library | 'error'
 /// enable-channelz | initialize service with runtime info about gRPC connections | false
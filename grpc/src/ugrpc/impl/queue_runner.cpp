@@ -1,7 +1,14 @@
 #include <userver/ugrpc/impl/queue_runner.hpp>
 
+#include <chrono>
 #include <thread>
 
+#include <grpc/support/time.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/thread_name.hpp>
 
@@ -13,30 +20,122 @@ namespace ugrpc::impl {
 
 namespace {
 
-void ProcessQueue(grpc::CompletionQueue& queue,
-                  engine::SingleUseEvent& completion) noexcept {
+// Idle pollers keep polling for this long before parking
+constexpr std::chrono::microseconds kIdleSpinDuration{50};
+
+void Notify(void* tag, bool ok) noexcept {
+  auto* call = static_cast<EventBase*>(tag);
+  UASSERT(call != nullptr);
+  call->Notify(ok);
+}
+
+}  // namespace
+
+QueueRunner::QueueRunner(grpc::CompletionQueue& queue,
+                         const QueuePollingSettings& settings)
+    : queue_(queue) {
+  if (settings.task_processor) {
+    UINVARIANT(settings.pollers > 0, "At least one poller is required");
+    for (std::size_t i = 0; i < settings.pollers; ++i) {
+      wakeups_.emplace_back();
+    }
+    active_pollers_ = settings.pollers;
+  }
+
+  std::thread([this] { ProcessQueue(); }).detach();
+
+  pollers_.reserve(wakeups_.size());
+  for (auto& wakeup : wakeups_) {
+    pollers_.push_back(engine::CriticalAsyncNoSpan(
+        *settings.task_processor, [this, &wakeup] { PollQueue(wakeup); }));
+  }
+}
+
+void QueueRunner::ProcessQueue() noexcept {
   utils::SetCurrentThreadName("grpc-queue");
 
   void* tag = nullptr;
   bool ok = false;
 
-  while (queue.Next(&tag, &ok)) {
-    auto* call = static_cast<EventBase*>(tag);
-    UASSERT(call != nullptr);
-    call->Notify(ok);
+  while (true) {
+    if (!wakeups_.empty()) {
+      // Active pollers take the events without a hop from this thread
+      std::unique_lock lock{pollers_mutex_};
+      pollers_parked_.wait(lock, [this] { return active_pollers_ == 0; });
+    }
+
+    if (!queue_.Next(&tag, &ok)) break;
+    Notify(tag, ok);
+
+    if (!wakeups_.empty()) {
+      {
+        const std::lock_guard lock{pollers_mutex_};
+        active_pollers_ = wakeups_.size();
+      }
+      for (auto& wakeup : wakeups_) wakeup.Send();
+    }
   }
 
-  completion.Send();
+  if (!wakeups_.empty()) {
+    // Parked pollers observe the shutdown, each of them parks once more
+    {
+      const std::lock_guard lock{pollers_mutex_};
+      active_pollers_ = wakeups_.size();
+    }
+    for (auto& wakeup : wakeups_) wakeup.Send();
+  }
+  completion_.Send();
 }
 
-}  // namespace
+void QueueRunner::PollQueue(engine::SingleConsumerEvent& wakeup) noexcept {
+  // The queue must be drained until shutdown
+  const engine::TaskCancellationBlocker blocker;
+
+  void* tag = nullptr;
+  bool ok = false;
+  auto spin_deadline = engine::Deadline::FromDuration(kIdleSpinDuration);
+
+  while (true) {
+    // Never blocks the worker thread, idle pollers park on `wakeup` instead
+    const auto status =
+        queue_.AsyncNext(&tag, &ok, gpr_inf_past(GPR_CLOCK_MONOTONIC));
+    if (status == grpc::CompletionQueue::SHUTDOWN) break;
+
+    if (status == grpc::CompletionQueue::GOT_EVENT) {
+      Notify(tag, ok);
+      spin_deadline = engine::Deadline::FromDuration(kIdleSpinDuration);
+    } else if (spin_deadline.IsReached()) {
+      // No timers: the thread blocked on the queue sends the wakeup with
+      // the next event
+      ParkPoller();
+      [[maybe_unused]] const bool signaled = wakeup.WaitForEvent();
+      UASSERT(signaled);
+      spin_deadline = engine::Deadline::FromDuration(kIdleSpinDuration);
+      continue;
+    }
 
-QueueRunner::QueueRunner(grpc::CompletionQueue& queue) : queue_(queue) {
-  std::thread([this] { ProcessQueue(queue_, completion_); }).detach();
+    // Lets the notified coroutines run on this worker
+    engine::Yield();
+  }
+
+  ParkPoller();
+}
+
+void QueueRunner::ParkPoller() {
+  const std::lock_guard lock{pollers_mutex_};
+  UASSERT(active_pollers_ > 0);
+  if (--active_pollers_ == 0) pollers_parked_.notify_one();
 }
 
 QueueRunner::~QueueRunner() {
   queue_.Shutdown();
+
+  if (!pollers_.empty()) {
+    const engine::TaskCancellationBlocker blocker;
+    for (auto& poller : pollers_) {
+      poller.Wait();
+    }
+  }
   completion_.WaitNonCancellable();
 }
 
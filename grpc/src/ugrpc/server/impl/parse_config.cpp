@@ -98,6 +98,13 @@ ServerConfig ParseServerConfig(const yaml_config::YamlConfig& value,
       value["unix-socket-path"].As<std::optional<std::string>>();
   config.port = value["port"].As<std::optional<int>>();
   config.completion_queue_num = value["completion-queue-count"].As<int>(2);
+  const auto queue_task_processor = value["completion-queue-task-processor"];
+  if (!queue_task_processor.IsMissing()) {
+    config.completion_queue_task_processor =
+        &ParseTaskProcessor(queue_task_processor, context);
+  }
+  config.completion_queue_pollers =
+      value["completion-queue-pollers"].As<std::size_t>(1);
   config.channel_args =
       value["channel-args"].As<decltype(config.channel_args)>({});
   config.native_log_level =
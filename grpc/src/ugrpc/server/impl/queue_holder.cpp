@@ -15,19 +15,22 @@ namespace ugrpc::server::impl {
 namespace {
 
 struct QueueSubHolder final {
-  explicit QueueSubHolder(std::unique_ptr<grpc::ServerCompletionQueue> queue)
-      : queue(std::move(queue)) {}
+  QueueSubHolder(std::unique_ptr<grpc::ServerCompletionQueue> queue,
+                 const ugrpc::impl::QueuePollingSettings& polling_settings)
+      : queue(std::move(queue)), queue_runner(*this->queue, polling_settings) {}
 
   std::unique_ptr<grpc::ServerCompletionQueue> queue;
-  ugrpc::impl::QueueRunner queue_runner{*queue};
+  ugrpc::impl::QueueRunner queue_runner;
 };
 
 }  // namespace
 
 struct QueueHolder::Impl final {
-  explicit Impl(std::size_t num, grpc::ServerBuilder& server_builder)
-      : queue(utils::GenerateFixedArray(num, [&server_builder](size_t) {
-          return QueueSubHolder(server_builder.AddCompletionQueue());
+  Impl(std::size_t num, grpc::ServerBuilder& server_builder,
+       const ugrpc::impl::QueuePollingSettings& polling_settings)
+      : queue(utils::GenerateFixedArray(num, [&](size_t) {
+          return QueueSubHolder(server_builder.AddCompletionQueue(),
+                                polling_settings);
         })) {
     for (auto& subholder : queue)
       queues.queues.push_back(subholder.queue.get());
@@ -37,8 +40,10 @@ struct QueueHolder::Impl final {
   ugrpc::impl::CompletionQueues queues;
 };
 
-QueueHolder::QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder)
-    : impl_(num, server_builder) {}
+QueueHolder::QueueHolder(
+    std::size_t num, grpc::ServerBuilder& server_builder,
+    const ugrpc::impl::QueuePollingSettings& polling_settings)
+    : impl_(num, server_builder, polling_settings) {}
 
 QueueHolder::~QueueHolder() = default;
 
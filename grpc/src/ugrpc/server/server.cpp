@@ -139,8 +139,10 @@ Server::Impl::Impl(ServerConfig&& config,
   }
   server_builder_.emplace();
   ApplyChannelArgs(*server_builder_, config);
+  const ugrpc::impl::QueuePollingSettings polling_settings{
+      config.completion_queue_task_processor, config.completion_queue_pollers};
   queue_.emplace(static_cast<std::size_t>(config.completion_queue_num),
-                 std::ref(*server_builder_));
+                 std::ref(*server_builder_), polling_settings);
 
   if (config.unix_socket_path) AddListeningUnixSocket(*config.unix_socket_path);
 
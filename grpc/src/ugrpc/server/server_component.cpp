@@ -54,6 +54,17 @@ properties:
             completion queue count to create. Should be ~2 times less than worker
             threads for best RPS.
         minimum: 1
+    completion-queue-task-processor:
+        type: string
+        description: |
+            if set, completion queues are polled by tasks of this task
+            processor instead of dedicated threads
+    completion-queue-pollers:
+        type: integer
+        description: |
+            count of polling tasks per completion queue, used with
+            completion-queue-task-processor
+        minimum: 1
     channel-args:
         type: object
         description: a map of channel arguments, see gRPC Core docs
@@ -0,0 +1,82 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <utility>
+
+#include <userver/engine/task/task.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kNumber = 42;
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& request) override {
+    sample::ugrpc::StreamGreetingResponse response;
+    response.set_name("Hello again " + request.name());
+    for (int i = 0; i < request.number(); ++i) {
+      response.set_number(i);
+      call.Write(response);
+    }
+    call.Finish();
+  }
+};
+
+ugrpc::server::ServerConfig MakeServerConfig() {
+  ugrpc::server::ServerConfig config;
+  config.completion_queue_num = 1;
+  config.completion_queue_task_processor =
+      &engine::current_task::GetTaskProcessor();
+  config.completion_queue_pollers = 2;
+  return config;
+}
+
+class GrpcQueuePolling : public ugrpc::tests::ServiceFixture<UnitTestService> {
+ protected:
+  GrpcQueuePolling()
+      : ServiceFixture(dynamic_config::MakeDefaultStorage({}),
+                       MakeServerConfig()) {}
+};
+
+}  // namespace
+
+UTEST_F_MT(GrpcQueuePolling, UnaryRPC, 2) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  for (int i = 0; i < 10; ++i) {
+    sample::ugrpc::GreetingRequest out;
+    out.set_name("userver");
+    const auto in = client.SayHello(out).Finish();
+    EXPECT_EQ(in.name(), "Hello userver");
+  }
+}
+
+UTEST_F_MT(GrpcQueuePolling, InputStream, 2) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::StreamGreetingRequest out;
+  out.set_name("userver");
+  out.set_number(kNumber);
+  auto is = client.ReadMany(out);
+
+  sample::ugrpc::StreamGreetingResponse in;
+  for (int i = 0; i < kNumber; ++i) {
+    ASSERT_TRUE(is.Read(in));
+    EXPECT_EQ(in.number(), i);
+  }
+  EXPECT_FALSE(is.Read(in));
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <chrono>
+#include <memory>
+#include <optional>
 #include <queue>
+#include <string_view>
+#include <vector>
 
 #include <userver/kafka/stats.hpp>
 
@@ -33,6 +38,42 @@ struct MessagePolled {
   MessagePolled(cppkafka::Message&& message);
 };
 
+/// @brief Polled message that owns the underlying rdkafka message.
+///
+/// Unlike MessagePolled, key, payload and topic are not copied, they are
+/// views into the message buffers and are valid while the Message is alive.
+class Message final {
+ public:
+  explicit Message(cppkafka::Message&& message);
+
+  /// For testsuite messages
+  explicit Message(MessagePolled&& message);
+
+  Message(Message&&) noexcept;
+  Message& operator=(Message&&) noexcept;
+  ~Message();
+
+  std::string_view GetKey() const { return key_; }
+  std::string_view GetPayload() const { return payload_; }
+  std::string_view GetTopic() const { return topic_; }
+  std::optional<std::chrono::milliseconds> GetTimestamp() const {
+    return timestamp_;
+  }
+  int GetPartition() const { return partition_; }
+  int64_t GetOffset() const { return offset_; }
+
+ private:
+  std::unique_ptr<cppkafka::Message> message_;
+  std::unique_ptr<MessagePolled> test_message_;
+
+  std::string_view key_;
+  std::string_view payload_;
+  std::string_view topic_;
+  std::optional<std::chrono::milliseconds> timestamp_;
+  int partition_{};
+  int64_t offset_{};
+};
+
 class Consumer;
 
 /// Must be placed as one of the last fields in the consumer component.
@@ -45,6 +86,9 @@ class ConsumerScope final {
  public:
   using Callback = std::function<void(std::vector<MessagePolled>&&)>;
 
+  /// Receives messages of a single partition in the order of offsets
+  using PartitionCallback = std::function<void(std::vector<Message>&&)>;
+
   ConsumerScope(ConsumerScope&&) noexcept = delete;
   ConsumerScope& operator=(ConsumerScope&&) noexcept = delete;
   ~ConsumerScope();
@@ -52,6 +96,24 @@ class ConsumerScope final {
   /// @note Each message pack must be committed using ConsumerScope::Commit.
   void Start(Callback callback);
 
+  /// @brief Starts processing of the polled messages in a separate task per
+  /// partition, so messages of different partitions are processed in parallel
+  /// and messages of a partition are processed in order.
+  ///
+  /// Offsets of the partitions processed without exceptions are committed
+  /// after each polled batch. Partitions whose callback has thrown are
+  /// rewound to the last committed offset.
+  ///
+  /// @warning The next batch is polled only after the callbacks of all the
+  /// partitions of the current batch have finished, so a single slow
+  /// partition delays the processing of all the other partitions
+  /// (head-of-line blocking). The parallelism only helps when the processing
+  /// times of the partitions are comparable; keep the callback fast or use
+  /// Start with your own queueing otherwise.
+  ///
+  /// Only one of Start and StartPerPartition may be called.
+  void StartPerPartition(PartitionCallback callback);
+
   /// Called in the destructor of ConsumerScope automatically. Can be called in
   /// the beginning of your destructor if some other actions in that destructor
   /// prevent the callback from functioning correctly.
@@ -92,10 +154,16 @@ class Consumer final {
   friend class ConsumerScope;
 
   void StartMessageProcessing(ConsumerScope::Callback callback);
+  void StartPartitionsProcessing(ConsumerScope::PartitionCallback callback);
+  void ProcessPartitions(const ConsumerScope::PartitionCallback& callback,
+                         std::vector<std::vector<Message>>&& partitions);
   void Stop() noexcept;
   void AsyncCommit();
 
   std::vector<MessagePolled> GetPolledMessages();
+  std::vector<std::vector<Message>> GetPolledPartitions();
+  void AccountPolledMessages(const std::vector<Message>& partition_messages);
+  void HandleProcessingError(const std::string& topic, std::string_view error);
   void Init();
   void GetAssigment();
 
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <optional>
+#include <string>
+#include <vector>
+
 #include <userver/kafka/stats.hpp>
 
+#include <userver/engine/future.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utils/statistics/entry.hpp>
 #include <userver/utils/statistics/storage.hpp>
@@ -17,6 +22,14 @@ class Producer;
 
 namespace kafka {
 
+/// Message to send with Producer::SendBatch
+struct ProducerMessage {
+  std::string topic_name;
+  std::string key;
+  std::string payload;
+  std::optional<int> partition{};
+};
+
 class Producer {
  public:
   Producer(std::unique_ptr<cppkafka::Configuration> config,
@@ -32,11 +45,27 @@ class Producer {
   void SendAsync(std::string topic_name, std::string key, std::string message,
                  const std::optional<int> partition_value = std::nullopt);
 
+  /// @brief Enqueues all the messages into the producer queue without
+  /// starting a task per message.
+  ///
+  /// Waits while the producer queue is full.
+  /// @returns future that becomes ready when all the messages are delivered
+  /// and throws std::runtime_error if any of them was not delivered
+  [[nodiscard]] engine::Future<void> SendBatch(
+      std::vector<ProducerMessage> messages);
+
  private:
   [[nodiscard]] engine::TaskWithResult<void> SendInternal(
       std::string topic_name, std::string key, std::string message,
       const std::optional<int> partition_value);
 
+  engine::Future<void> EnqueueBatch(
+      const std::vector<ProducerMessage>& messages);
+
+  void SendToTestPoint(const std::string& key,
+                       const std::string& message) const;
+
+  void EnsurePolling();
   void Init();
 
  private:
@@ -90,6 +90,16 @@ std::string GetGroupId(const components::ComponentConfig& config) {
   return group_id;
 }
 
+/// Notifies the impl::DeliveryState passed as the message opaque
+void SetDeliveryReportCallback(cppkafka::Configuration& config) {
+  config.set_delivery_report_callback(
+      [](cppkafka::Producer&, const cppkafka::Message& message) {
+        auto* state =
+            static_cast<impl::DeliveryState*>(message.get_user_data());
+        state->OnDelivered(message);
+      });
+}
+
 }  // namespace
 
 Secret Parse(const formats::json::Value& doc, formats::parse::To<Secret>) {
@@ -183,12 +193,7 @@ std::unique_ptr<cppkafka::Configuration> MakeProducerConfiguration(
     const BrokerSecrets& secrets, const components::ComponentConfig& config) {
   CheckComponentNameStart(config.Name(), "kafka-producer");
   auto cppkafka_config = MakeConfiguration(secrets, config);
-  cppkafka_config->set_delivery_report_callback(
-      [](cppkafka::Producer&, const cppkafka::Message& message) {
-        auto* state = static_cast<impl::AsyncState*>(message.get_user_data());
-        state->promise.set_value(message.get_error());
-        delete state;
-      });
+  SetDeliveryReportCallback(*cppkafka_config);
   cppkafka_config->set("delivery.timeout.ms",
                        config[kDeliveryTimeoutField].As<std::string>());
   cppkafka_config->set("queue.buffering.max.ms",
@@ -1,8 +1,14 @@
 #include <userver/kafka/consumer.hpp>
 
+#include <map>
+#include <utility>
+
 #include <userver/testsuite/testpoint.hpp>
 
 #include <cppkafka/consumer.h>
+#include <cppkafka/message.h>
+#include <cppkafka/topic_partition_list.h>
+#include <librdkafka/rdkafka.h>
 
 #include <kafka/configuration.hpp>
 #include <kafka/impl/common.hpp>
@@ -11,6 +17,19 @@ USERVER_NAMESPACE_BEGIN
 
 namespace kafka {
 
+namespace {
+
+std::string_view AsStringView(const cppkafka::Buffer& buffer) {
+  return {reinterpret_cast<const char*>(buffer.get_data()), buffer.get_size()};
+}
+
+std::string_view GetTopicName(const cppkafka::Message& message) {
+  const auto* topic = message.get_handle()->rkt;
+  return topic ? rd_kafka_topic_name(topic) : std::string_view{};
+}
+
+}  // namespace
+
 MessagePolled::MessagePolled(cppkafka::Message&& message)
     : key(message.get_key()),
       payload(message.get_payload()),
@@ -22,6 +41,34 @@ MessagePolled::MessagePolled(cppkafka::Message&& message)
   }
 }
 
+Message::Message(cppkafka::Message&& message)
+    : message_(std::make_unique<cppkafka::Message>(std::move(message))),
+      key_(AsStringView(message_->get_key())),
+      payload_(AsStringView(message_->get_payload())),
+      topic_(GetTopicName(*message_)),
+      partition_(message_->get_partition()),
+      offset_(message_->get_offset()) {
+  if (message_->get_timestamp().has_value()) {
+    timestamp_ = message_->get_timestamp().value().get_timestamp();
+  }
+}
+
+Message::Message(MessagePolled&& message)
+    : test_message_(std::make_unique<MessagePolled>(std::move(message))),
+      key_(test_message_->key),
+      payload_(test_message_->payload),
+      topic_(test_message_->topic),
+      timestamp_(test_message_->timestamp),
+      partition_(test_message_->partition),
+      offset_(test_message_->offset) {}
+
+// Views point into the heap-allocated message, so moves keep them valid
+Message::Message(Message&&) noexcept = default;
+
+Message& Message::operator=(Message&&) noexcept = default;
+
+Message::~Message() = default;
+
 ConsumerScope::ConsumerScope(Consumer& consumer) noexcept
     : consumer_(consumer) {}
 
@@ -31,6 +78,10 @@ void ConsumerScope::Start(Callback callback) {
   consumer_.StartMessageProcessing(std::move(callback));
 }
 
+void ConsumerScope::StartPerPartition(PartitionCallback callback) {
+  consumer_.StartPartitionsProcessing(std::move(callback));
+}
+
 void ConsumerScope::Stop() noexcept { consumer_.Stop(); }
 
 void ConsumerScope::AsyncCommit() { consumer_.AsyncCommit(); }
@@ -86,19 +137,10 @@ void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
             message_processing_task.Get();
             TESTPOINT(fmt::format("tp_{}", component_name_), {});
           } catch (const std::exception& e) {
-            ++stats_.topics_stats[""]->messages_counts.messages_error;
-
             // Returning to last committed message
             GetAssigment();
 
-            const std::string& error_text = e.what();
-            LOG_ERROR() << "Message's processing failed: " << error_text;
-            TESTPOINT(fmt::format("tp_error_{}", component_name_),
-                      [&error_text]() {
-                        formats::json::ValueBuilder error_json;
-                        error_json["error"] = std::string(error_text);
-                        return error_json.ExtractValue();
-                      }());
+            HandleProcessingError("", e.what());
           }
         }
       });
@@ -106,6 +148,92 @@ void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
   LOG_INFO() << "Consumer started messages processing";
 }
 
+void Consumer::StartPartitionsProcessing(
+    ConsumerScope::PartitionCallback callback) {
+  UASSERT_MSG(!started_processing_.test_and_set(),
+              "Message processing already started");
+
+  poll_task_ = utils::Async(
+      consumer_task_processor_, "consumer_polling",
+      [this, callback = std::move(callback)] {
+        LOG_INFO() << "Consumer started per-partition messages polling";
+        while (!engine::current_task::IsCancelRequested()) {
+          auto partitions = GetPolledPartitions();
+          if (partitions.empty()) {
+            continue;
+          }
+          ProcessPartitions(callback, std::move(partitions));
+        }
+      });
+
+  LOG_INFO() << "Consumer started per-partition messages processing";
+}
+
+void Consumer::ProcessPartitions(
+    const ConsumerScope::PartitionCallback& callback,
+    std::vector<std::vector<Message>>&& partitions) {
+  cppkafka::TopicPartitionList offsets;
+  offsets.reserve(partitions.size());
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(partitions.size());
+  for (auto& messages : partitions) {
+    const auto& last_message = messages.back();
+    // Committed offset is the offset of the next message to consume
+    offsets.emplace_back(std::string{last_message.GetTopic()},
+                         last_message.GetPartition(),
+                         last_message.GetOffset() + 1);
+
+    // Tasks are awaited or cancelled before return, so `callback` outlives
+    // them
+    tasks.push_back(utils::Async(
+        main_task_processor_, "partition_messages_processing",
+        [&callback, messages = std::move(messages)]() mutable {
+          callback(std::move(messages));
+        }));
+  }
+
+  cppkafka::TopicPartitionList processed;
+  processed.reserve(tasks.size());
+  for (std::size_t i = 0; i < tasks.size(); ++i) {
+    try {
+      tasks[i].Get();
+      processed.push_back(offsets[i]);
+    } catch (const std::exception& e) {
+      HandleProcessingError(offsets[i].get_topic(), e.what());
+    }
+  }
+
+  const bool has_failed = processed.size() != tasks.size();
+  if (!is_testsuite_mode_ && !processed.empty()) {
+    // Processed partitions must be committed before the failed ones are
+    // rewound, otherwise they are consumed again
+    if (has_failed) {
+      consumer_->commit(processed);
+    } else {
+      consumer_->async_commit(processed);
+    }
+  }
+
+  if (has_failed) {
+    // Returning failed partitions to last committed message
+    GetAssigment();
+  } else {
+    TESTPOINT(fmt::format("tp_{}", component_name_), {});
+  }
+}
+
+void Consumer::HandleProcessingError(const std::string& topic,
+                                     std::string_view error) {
+  ++stats_.topics_stats[topic]->messages_counts.messages_error;
+
+  LOG_ERROR() << "Message's processing failed: " << error;
+  TESTPOINT(fmt::format("tp_error_{}", component_name_), [error]() {
+    formats::json::ValueBuilder error_json;
+    error_json["error"] = std::string(error);
+    return error_json.ExtractValue();
+  }());
+}
+
 void Consumer::AsyncCommit() {
   utils::Async(consumer_task_processor_, "consumer_committing", [this]() {
     consumer_->async_commit();
@@ -159,6 +287,66 @@ std::vector<MessagePolled> Consumer::GetPolledMessages() {
   return messages_polled;
 }
 
+std::vector<std::vector<Message>> Consumer::GetPolledPartitions() {
+  std::vector<Message> messages;
+  if (!is_testsuite_mode_) {
+    std::vector<cppkafka::Message> messages_batch =
+        consumer_->poll_batch(max_batch_size_, std::chrono::milliseconds(500));
+    messages.reserve(messages_batch.size());
+    for (auto&& message : messages_batch) {
+      if (message.get_error()) {
+        LOG_WARNING() << "Polled message with error: "
+                      << message.get_error().to_string();
+        continue;
+      }
+      messages.emplace_back(std::move(message));
+    }
+  } else {
+    for (std::size_t i = 0; i < max_batch_size_ && !tests_messages_.empty();
+         ++i) {
+      messages.emplace_back(std::move(tests_messages_.front()));
+      tests_messages_.pop();
+    }
+  }
+
+  std::vector<std::vector<Message>> partitions;
+  std::map<std::pair<std::string_view, int>, std::size_t> partition_indices;
+  for (auto& message : messages) {
+    const auto [it, is_new] = partition_indices.try_emplace(
+        {message.GetTopic(), message.GetPartition()}, partitions.size());
+    if (is_new) partitions.emplace_back();
+    partitions[it->second].push_back(std::move(message));
+  }
+
+  if (!partitions.empty()) {
+    LOG_INFO() << "Polled batch of " << messages.size() << " messages from "
+               << partitions.size() << " partitions";
+  }
+  for (const auto& partition_messages : partitions) {
+    AccountPolledMessages(partition_messages);
+  }
+  return partitions;
+}
+
+void Consumer::AccountPolledMessages(
+    const std::vector<Message>& partition_messages) {
+  UASSERT(!partition_messages.empty());
+  const auto topic_stats =
+      stats_.topics_stats[std::string{partition_messages.front().GetTopic()}];
+  topic_stats->messages_counts.messages_total += partition_messages.size();
+
+  const auto take_time = std::chrono::system_clock::now().time_since_epoch();
+  for (const auto& message : partition_messages) {
+    const auto message_timestamp = message.GetTimestamp();
+    if (!message_timestamp) continue;
+
+    topic_stats->avg_ms_spent_time.GetCurrentCounter().Account(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            take_time - message_timestamp.value())
+            .count());
+  }
+}
+
 void Consumer::Init() {
   consumer_->set_assignment_callback(
       [](const cppkafka::TopicPartitionList& topic_partitions) {
@@ -0,0 +1,86 @@
+#include <kafka/impl/async_state.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace kafka::impl {
+
+BatchState::BatchState(std::size_t messages_count, Stats& stats)
+    : stats_(stats),
+      start_time_(std::chrono::steady_clock::now()),
+      // The last reference is held by the sender
+      references_(messages_count + 1) {}
+
+void BatchState::AddTopicMessage(const std::string& topic_name) {
+  // Batches usually contain messages of a few topics
+  auto it = std::find_if(
+      topics_.rbegin(), topics_.rend(),
+      [&topic_name](const auto& topic) { return topic.first == topic_name; });
+  if (it == topics_.rend()) {
+    topics_.emplace_back(topic_name, stats_.topics_stats[topic_name]);
+    it = topics_.rbegin();
+  }
+  ++it->second->messages_counts.messages_total;
+}
+
+void BatchState::OnDelivered(const cppkafka::Message& message) {
+  if (const auto error = message.get_error()) {
+    ++stats_.topics_stats[message.get_topic()]->messages_counts.messages_error;
+    SetError(1, error.to_string());
+  }
+  OnDone(1);
+}
+
+void BatchState::OnNotEnqueued(std::size_t messages_count,
+                               const std::string& error) {
+  SetError(messages_count, error);
+  OnDone(messages_count);
+}
+
+void BatchState::Release() { OnDone(1); }
+
+void BatchState::SetError(std::size_t messages_count, std::string error) {
+  failed_ += messages_count;
+  if (!has_error_.test_and_set()) {
+    first_error_ = std::move(error);
+  }
+}
+
+void BatchState::OnDone(std::size_t messages_count) {
+  if (references_.fetch_sub(messages_count, std::memory_order_acq_rel) !=
+      messages_count) {
+    return;
+  }
+
+  const auto ms_duration =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start_time_)
+          .count();
+  for (const auto& [topic_name, topic_stats] : topics_) {
+    topic_stats->avg_ms_spent_time.GetCurrentCounter().Account(ms_duration);
+  }
+
+  const auto failed = failed_.load();
+  if (failed == 0) {
+    promise_.set_value();
+  } else {
+    auto error_text =
+        fmt::format("{} messages of the batch were not sent, first error: {}",
+                    failed, first_error_);
+    LOG_ERROR() << error_text;
+    promise_.set_exception(
+        std::make_exception_ptr(std::runtime_error(std::move(error_text))));
+  }
+  delete this;
+}
+
+}  // namespace kafka::impl
+
+USERVER_NAMESPACE_END
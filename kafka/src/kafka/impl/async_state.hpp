@@ -1,24 +1,82 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include <cppkafka/message.h>
 #include <cppkafka/message_builder.h>
 
 #include <userver/engine/future.hpp>
+#include <userver/kafka/stats.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace kafka::impl {
 
-struct AsyncState final {
+/// Message opaque, notified from the delivery report callback
+class DeliveryState {
+ public:
+  virtual ~DeliveryState() = default;
+
+  /// Called exactly once for each produced message
+  virtual void OnDelivered(const cppkafka::Message& message) = 0;
+};
+
+struct AsyncState final : public DeliveryState {
   explicit AsyncState(std::string topic_name) : builder(std::move(topic_name)) {
-    builder.user_data(&promise);
+    builder.user_data(static_cast<DeliveryState*>(this));
+  }
+
+  void OnDelivered(const cppkafka::Message& message) override {
+    promise.set_value(message.get_error());
+    delete this;
   }
 
   engine::Promise<cppkafka::Error> promise{};
   cppkafka::MessageBuilder builder;
 };
 
+/// Shared by all the messages of a batch, completes the batch promise when
+/// the last message is delivered and destroys itself
+class BatchState final : public DeliveryState {
+ public:
+  /// The state is held by the sender until Release() is called
+  BatchState(std::size_t messages_count, Stats& stats);
+
+  engine::Future<void> GetFuture() { return promise_.get_future(); }
+
+  /// Accounts the message in the statistics of its topic
+  void AddTopicMessage(const std::string& topic_name);
+
+  void OnDelivered(const cppkafka::Message& message) override;
+
+  /// Marks the messages that were not enqueued as failed
+  void OnNotEnqueued(std::size_t messages_count, const std::string& error);
+
+  /// Releases the sender's reference, may destroy the state
+  void Release();
+
+ private:
+  void SetError(std::size_t messages_count, std::string error);
+  void OnDone(std::size_t messages_count);
+
+  Stats& stats_;
+  const std::chrono::steady_clock::time_point start_time_;
+  engine::Promise<void> promise_;
+  std::atomic<std::size_t> references_;
+  std::atomic<std::size_t> failed_{0};
+  std::atomic_flag has_error_ ATOMIC_FLAG_INIT;
+  // Written once by the first failed message
+  std::string first_error_;
+
+  // Written by the sender only, read when the last message is done
+  std::vector<std::pair<std::string, std::shared_ptr<TopicStats>>> topics_;
+};
+
 }  // namespace kafka::impl
 
 USERVER_NAMESPACE_END
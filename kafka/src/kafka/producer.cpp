@@ -1,10 +1,12 @@
 #include <userver/kafka/producer.hpp>
 
+#include <userver/engine/sleep.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/testsuite/testpoint.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/text_light.hpp>
 
+#include <cppkafka/exceptions.h>
 #include <cppkafka/producer.h>
 
 #include <kafka/configuration.hpp>
@@ -15,6 +17,32 @@ USERVER_NAMESPACE_BEGIN
 
 namespace kafka {
 
+namespace {
+
+constexpr std::chrono::milliseconds kQueueFullBackoff{10};
+
+void ProduceWaitingForSpace(cppkafka::Producer& producer,
+                            const cppkafka::MessageBuilder& builder) {
+  while (true) {
+    try {
+      producer.produce(builder);
+      return;
+    } catch (const cppkafka::HandleException& e) {
+      if (e.get_error().get_error() != RD_KAFKA_RESP_ERR__QUEUE_FULL) {
+        throw;
+      }
+    }
+
+    // Queue is freed by delivery reports served in the polling task
+    engine::InterruptibleSleepFor(kQueueFullBackoff);
+    if (engine::current_task::ShouldCancel()) {
+      throw std::runtime_error("Producer queue is full, sending is cancelled");
+    }
+  }
+}
+
+}  // namespace
+
 Producer::Producer(std::unique_ptr<cppkafka::Configuration> config,
                    const std::string& component_name,
                    engine::TaskProcessor& producer_task_processor,
@@ -59,6 +87,17 @@ void Producer::SendAsync(std::string topic_name, std::string key,
       .Detach();
 }
 
+engine::Future<void> Producer::SendBatch(
+    std::vector<ProducerMessage> messages) {
+  LOG_INFO() << "Batch of " << messages.size()
+             << " messages is requested to send";
+  EnsurePolling();
+
+  return utils::Async(producer_task_processor_, "producer_batch_producing",
+                      [this, &messages] { return EnqueueBatch(messages); })
+      .Get();
+}
+
 Producer::~Producer() {
   LOG_INFO() << "Producer poll task is requested to cancel";
   if (poll_task_.IsValid()) {
@@ -71,30 +110,14 @@ Producer::~Producer() {
     std::string topic_name, std::string key, std::string message,
     const std::optional<int> partition_value) {
   LOG_INFO() << "Message to topic " << topic_name << " is requested to send";
-  if (first_send_) {
-    Init();
-    first_send_ = false;
-  }
-
-  if (!poll_task_.IsValid() || poll_task_.IsFinished()) {
-    throw std::runtime_error(
-        "Polling task is invalid or finish, message is not sent");
-  }
+  EnsurePolling();
 
   return utils::Async(
       producer_task_processor_, "producer_producing",
       [this, topic_name = std::move(topic_name), partition_value,
        key = std::move(key), message = std::move(message)] {
         if (is_testsuite_mode_) {
-          // Testpoint server does not accept non-utf8 data
-          TESTPOINT(fmt::format("tp_{}", component_name_), [&] {
-            formats::json::ValueBuilder builder;
-            builder["key"] = key;
-            if (utils::text::IsUtf8(message)) {
-              builder["message"] = message;
-            }
-            return builder.ExtractValue();
-          }());
+          SendToTestPoint(key, message);
           return;
         }
 
@@ -134,6 +157,71 @@ Producer::~Producer() {
       });
 }
 
+engine::Future<void> Producer::EnqueueBatch(
+    const std::vector<ProducerMessage>& messages) {
+  if (is_testsuite_mode_) {
+    for (const auto& message : messages) {
+      SendToTestPoint(message.key, message.payload);
+    }
+    engine::Promise<void> promise;
+    promise.set_value();
+    return promise.get_future();
+  }
+
+  // All the messages share one state, it is destroyed by the last delivery
+  // report or by Release()
+  auto* state = new impl::BatchState(messages.size(), stats_);
+  auto future = state->GetFuture();
+
+  cppkafka::MessageBuilder builder{""};
+  builder.user_data(static_cast<impl::DeliveryState*>(state));
+  std::size_t enqueued = 0;
+  try {
+    for (; enqueued < messages.size(); ++enqueued) {
+      const auto& message = messages[enqueued];
+      builder.topic(message.topic_name)
+          .partition(message.partition.value_or(RD_KAFKA_PARTITION_UA))
+          .key(message.key)
+          .payload(message.payload);
+      state->AddTopicMessage(message.topic_name);
+      ProduceWaitingForSpace(*producer_, builder);
+    }
+  } catch (const std::exception& e) {
+    ++stats_.topics_stats[messages[enqueued].topic_name]
+          ->messages_counts.messages_error;
+    state->OnNotEnqueued(messages.size() - enqueued, e.what());
+  }
+  state->Release();
+
+  LOG_INFO() << "Batch of " << enqueued << " messages was enqueued";
+  return future;
+}
+
+void Producer::SendToTestPoint(const std::string& key,
+                               const std::string& message) const {
+  // Testpoint server does not accept non-utf8 data
+  TESTPOINT(fmt::format("tp_{}", component_name_), [&] {
+    formats::json::ValueBuilder builder;
+    builder["key"] = key;
+    if (utils::text::IsUtf8(message)) {
+      builder["message"] = message;
+    }
+    return builder.ExtractValue();
+  }());
+}
+
+void Producer::EnsurePolling() {
+  if (first_send_) {
+    Init();
+    first_send_ = false;
+  }
+
+  if (!poll_task_.IsValid() || poll_task_.IsFinished()) {
+    throw std::runtime_error(
+        "Polling task is invalid or finish, message is not sent");
+  }
+}
+
 }  // namespace kafka
 
 USERVER_NAMESPACE_END
@@ -3,7 +3,13 @@
 /// @file userver/cache/base_mongo_cache.hpp
 /// @brief @copybrief components::MongoCache
 
+#include <algorithm>
 #include <chrono>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -11,13 +17,16 @@
 #include <userver/cache/caching_component_base.hpp>
 #include <userver/cache/mongo_cache_type_traits.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/inline.hpp>
+#include <userver/formats/bson/stream_reader.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/collection.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/options.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -32,10 +41,120 @@ inline constexpr std::chrono::milliseconds kCpuRelaxInterval{2};
 
 namespace impl {
 
+// The stream is drained on every update, the last read waits this long
+inline constexpr std::chrono::milliseconds kChangeStreamMaxAwaitTime{10};
+// The rest of the events are applied by the next update
+inline constexpr std::size_t kChangeStreamMaxEvents = 100'000;
+
+enum class MongoCacheChangeType { kUpsert, kDelete, kInvalidate, kIgnore };
+
+struct MongoCacheChanges {
+  std::vector<formats::bson::Document> events;
+  std::optional<formats::bson::Document> resume_token;
+  // The collection was dropped or renamed, the events after it are lost
+  bool is_invalidated{false};
+};
+
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 
+bool IsMongoCacheChangeStreamEnabled(const ComponentConfig&);
+
+storages::mongo::operations::Watch MakeMongoCacheWatchOperation(
+    const std::optional<formats::bson::Document>& resume_token,
+    bool is_secondary_preferred);
+
+MongoCacheChangeType GetMongoCacheChangeType(const formats::bson::Document&);
+
+std::string GetMongoCacheDocumentId(const formats::bson::Value& id);
+
+bool IsMongoCacheChangeStreamLost(const std::exception&);
+
+/// @returns the token to read the changes made after the call
+std::optional<formats::bson::Document> GetMongoCacheResumeToken(
+    const storages::mongo::Collection& collection,
+    bool is_secondary_preferred);
+
+/// Reads the changes made after `resume_token`. The change stream and its
+/// connection are only held during the call.
+MongoCacheChanges ReadMongoCacheChanges(
+    const storages::mongo::Collection& collection,
+    const formats::bson::Document& resume_token, bool is_secondary_preferred);
+
+std::size_t GetMongoCacheFullUpdatePartitions(const ComponentConfig&);
+
+std::vector<formats::bson::Document> GetMongoCachePartitionFilters(
+    storages::mongo::Collection collection, std::size_t partitions,
+    bool is_secondary_preferred);
+
+/// @returns filters of up to `partitions` _id ranges split at the sorted
+/// sample of _id values
+std::vector<formats::bson::Document> MakeMongoCachePartitionFilters(
+    const std::vector<formats::bson::Value>& samples, std::size_t partitions);
+
+template <typename MongoCacheTraits>
+using MongoCacheKeyType = std::decay_t<decltype(
+    std::declval<const typename MongoCacheTraits::ObjectType&>().*
+    MongoCacheTraits::kKeyField)>;
+
+template <typename ObjectType>
+struct MongoCachePartition {
+  struct Item {
+    std::string document_id;
+    ObjectType object;
+  };
+
+  std::vector<Item> items;
+  std::size_t documents_read{0};
+  std::size_t parse_failures{0};
+};
+
+/// Moves the partitions items into `data`, the first item wins for duplicate
+/// keys. Fills `document_keys` if not null.
+template <typename MongoCacheTraits>
+void MergeMongoCachePartitions(
+    std::vector<MongoCachePartition<typename MongoCacheTraits::ObjectType>>&
+        partitions,
+    typename MongoCacheTraits::DataType& data,
+    std::unordered_map<std::string, MongoCacheKeyType<MongoCacheTraits>>*
+        document_keys,
+    utils::CpuRelax& relax) {
+  for (auto& partition : partitions) {
+    for (auto& item : partition.items) {
+      relax.Relax();
+
+      auto key = (item.object.*MongoCacheTraits::kKeyField);
+      if (data.count(key) == 0) {
+        if (document_keys) {
+          (*document_keys)[std::move(item.document_id)] = key;
+        }
+        data[key] = std::move(item.object);
+      } else {
+        LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
+                            << MongoCacheTraits::kName << ", key=" << key;
+      }
+    }
+    // Frees the moved-from objects early
+    partition.items.clear();
+  }
+}
+
+/// Default conversion of a document to the cached object
+template <typename MongoCacheTraits>
+typename MongoCacheTraits::ObjectType DeserializeMongoCacheObject(
+    const formats::bson::Document& doc) {
+  using ObjectType = typename MongoCacheTraits::ObjectType;
+  if constexpr (mongo_cache::impl::IsStreamParseEnabled<MongoCacheTraits>()) {
+    static_assert(formats::bson::kHasStreamParse<ObjectType>,
+                  "kUseStreamParse requires `Parse(formats::bson::"
+                  "StreamReader&, formats::parse::To<ObjectType>)`");
+    return formats::bson::StreamParse<ObjectType>(doc);
+  } else {
+    return doc.As<ObjectType>();
+  }
 }
 
+}  // namespace impl
+
 // clang-format off
 
 /// @ingroup userver_components
@@ -52,6 +171,33 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// update-correction | adjusts incremental updates window to overlap with previous update | 0
+/// change-stream-enabled | apply changes from a MongoDB change stream instead of polling for incremental updates | false
+/// full-update-partitions | number of `_id` ranges fetched and parsed in parallel on full updates | 1
+///
+/// ### Change streams
+/// With `change-stream-enabled` incremental updates read the inserts, updates
+/// and deletes made since the previous update from a MongoDB change stream
+/// instead of polling the collection. Unlike polling, this also removes the
+/// deleted documents from the cache, and updates without changes do not copy
+/// the cache. The stream is resumed from the last applied event on every
+/// update and is closed in between, so it does not hold a connection. If the
+/// stream fails, the update polls the collection; if the event is no longer in
+/// the oplog, a full update is scheduled. Invalid documents in the stream are
+/// handled the same way as in polling updates, see
+/// `kAreInvalidDocumentsSkipped`. Requires a replica set and the default find
+/// operation.
+///
+/// ### Partitioned full updates
+/// With `full-update-partitions` greater than 1 the full update splits the
+/// collection into `_id` ranges using split points from a `$sample` of the
+/// collection. Each range is read by its own cursor and deserialized in a
+/// separate task, the results are merged into the cache at the end. If the
+/// collection is too small to be split, a single cursor is used. Requires the
+/// default find operation.
+///
+/// @warning The parsed objects of all the partitions are kept until the
+/// merge, so the peak memory usage of a partitioned full update is about
+/// twice the size of the cache contents.
 ///
 /// ## Traits example:
 /// All fields below (except for function overrides) are mandatory.
@@ -92,6 +238,10 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///   // (default implementation calls doc.As<ObjectType>())
 ///   // For using default implementation
 ///   static constexpr bool kUseDefaultDeserializeObject = true;
+///   // Optional, makes the default implementation call
+///   // formats::bson::StreamParse<ObjectType>(doc) instead, requires
+///   // `Parse(formats::bson::StreamReader&, formats::parse::To<ObjectType>)`
+///   static constexpr bool kUseStreamParse = true;
 ///
 ///   // Optional function that overrides data retrieval operation
 ///   static storages::mongo::operations::Find GetFindOperation(
@@ -151,10 +301,33 @@ class MongoCache
   std::unique_ptr<typename MongoCacheTraits::DataType> GetData(
       cache::UpdateType type);
 
+  using PartitionData =
+      impl::MongoCachePartition<typename MongoCacheTraits::ObjectType>;
+
+  PartitionData FetchPartition(formats::bson::Document filter) const;
+  void UpdateFullPartitioned(
+      const std::vector<formats::bson::Document>& filters,
+      cache::UpdateStatisticsScope& stats_scope);
+
+  void ResetChangeStream();
+  bool UpdateFromChangeStream(cache::UpdateStatisticsScope& stats_scope);
+
+  void UpdateCpuRelaxIterations(
+      std::size_t doc_count, tracing::ScopeTime::DurationMillis elapsed_time);
+
+  using KeyType = impl::MongoCacheKeyType<MongoCacheTraits>;
+
   const std::shared_ptr<CollectionsType> mongo_collections_;
   const storages::mongo::Collection* const mongo_collection_;
   const std::chrono::system_clock::duration correction_;
+  const bool change_stream_enabled_;
+  const std::size_t full_update_partitions_;
   std::size_t cpu_relax_iterations_{0};
+
+  // Cache keys by document _id to apply deletes
+  std::unordered_map<std::string, KeyType> document_keys_;
+  // Change stream position of the cache contents
+  std::optional<formats::bson::Document> resume_token_;
 };
 
 template <class MongoCacheTraits>
@@ -172,7 +345,10 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
               .template GetCollectionForLibrary<CollectionsType>()),
       mongo_collection_(std::addressof(
           mongo_collections_.get()->*MongoCacheTraits::kMongoCollectionsField)),
-      correction_(impl::GetMongoCacheUpdateCorrection(config)) {
+      correction_(impl::GetMongoCacheUpdateCorrection(config)),
+      change_stream_enabled_(impl::IsMongoCacheChangeStreamEnabled(config)),
+      full_update_partitions_(
+          impl::GetMongoCacheFullUpdatePartitions(config)) {
   [[maybe_unused]] mongo_cache::impl::CheckTraits<MongoCacheTraits>
       check_traits;
 
@@ -192,6 +368,21 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
         "config for '" +
         components::GetCurrentComponentName(config) + "' cache");
   }
+  if (change_stream_enabled_ &&
+      !mongo_cache::impl::kHasDefaultFindOperation<MongoCacheTraits>) {
+    throw std::logic_error(
+        "Change stream is requested in config but a custom find operation is "
+        "specified in traits of '" +
+        components::GetCurrentComponentName(config) + "' cache");
+  }
+
+  if (full_update_partitions_ > 1 &&
+      !mongo_cache::impl::kHasDefaultFindOperation<MongoCacheTraits>) {
+    throw std::logic_error(
+        "Partitioned full updates are requested in config but a custom find "
+        "operation is specified in traits of '" +
+        components::GetCurrentComponentName(config) + "' cache");
+  }
 
   this->StartPeriodicUpdates();
 }
@@ -209,6 +400,26 @@ void MongoCache<MongoCacheTraits>::Update(
     cache::UpdateStatisticsScope& stats_scope) {
   namespace sm = storages::mongo;
 
+  if (change_stream_enabled_) {
+    if (type == cache::UpdateType::kIncremental && resume_token_) {
+      if (UpdateFromChangeStream(stats_scope)) return;
+    } else {
+      // This update reads the changes made before the new token, the next
+      // incremental updates read the ones after it
+      ResetChangeStream();
+    }
+  }
+
+  if (type == cache::UpdateType::kFull && full_update_partitions_ > 1) {
+    const auto filters = impl::GetMongoCachePartitionFilters(
+        *mongo_collection_, full_update_partitions_,
+        MongoCacheTraits::kIsSecondaryPreferred);
+    if (filters.size() > 1) {
+      UpdateFullPartitioned(filters, stats_scope);
+      return;
+    }
+  }
+
   const auto* collection = mongo_collection_;
   auto find_op = GetFindOperation(type, last_update, now, correction_);
   auto cursor = collection->Execute(find_op);
@@ -228,6 +439,11 @@ void MongoCache<MongoCacheTraits>::Update(
   utils::CpuRelax relax{cpu_relax_iterations_, &scope};
   std::size_t doc_count = 0;
 
+  std::unordered_map<std::string, KeyType> new_document_keys;
+  auto& document_keys = type == cache::UpdateType::kIncremental
+                            ? document_keys_
+                            : new_document_keys;
+
   for (const auto& doc : cursor) {
     ++doc_count;
 
@@ -241,6 +457,9 @@ void MongoCache<MongoCacheTraits>::Update(
 
       if (type == cache::UpdateType::kIncremental ||
           new_cache->count(key) == 0) {
+        if (change_stream_enabled_) {
+          document_keys[impl::GetMongoCacheDocumentId(doc["_id"])] = key;
+        }
         (*new_cache)[key] = std::move(object);
       } else {
         LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
@@ -257,7 +476,107 @@ void MongoCache<MongoCacheTraits>::Update(
     }
   }
 
-  const auto elapsed_time = scope.ElapsedTotal(kFetchAndParseStage);
+  UpdateCpuRelaxIterations(doc_count,
+                           scope.ElapsedTotal(kFetchAndParseStage));
+
+  scope.Reset();
+
+  const auto size = new_cache->size();
+  this->Set(std::move(new_cache));
+  if (type == cache::UpdateType::kFull) {
+    document_keys_ = std::move(new_document_keys);
+  }
+  stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+typename MongoCache<MongoCacheTraits>::PartitionData
+MongoCache<MongoCacheTraits>::FetchPartition(
+    formats::bson::Document filter) const {
+  namespace sm = storages::mongo;
+
+  sm::operations::Find find_op(std::move(filter));
+  if (MongoCacheTraits::kIsSecondaryPreferred) {
+    find_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+
+  utils::CpuRelax relax{cpu_relax_iterations_, nullptr};
+  PartitionData result;
+  for (const auto& doc : mongo_collection_->Execute(find_op)) {
+    ++result.documents_read;
+
+    relax.Relax();
+
+    try {
+      auto object = DeserializeObject(doc);
+      auto document_id = change_stream_enabled_
+                             ? impl::GetMongoCacheDocumentId(doc["_id"])
+                             : std::string{};
+      result.items.push_back({std::move(document_id), std::move(object)});
+    } catch (const std::exception& e) {
+      LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                          << MongoCacheTraits::kName << ", _id="
+                          << doc["_id"].template ConvertTo<std::string>()
+                          << ", what(): " << e;
+      ++result.parse_failures;
+
+      if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+    }
+  }
+  return result;
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::UpdateFullPartitioned(
+    const std::vector<formats::bson::Document>& filters,
+    cache::UpdateStatisticsScope& stats_scope) {
+  auto scope =
+      tracing::Span::CurrentSpan().CreateScopeTime(kFetchAndParseStage);
+
+  std::vector<engine::TaskWithResult<PartitionData>> tasks;
+  tasks.reserve(filters.size());
+  for (const auto& filter : filters) {
+    tasks.push_back(utils::Async(
+        fmt::format("mongo-cache-partition/{}", MongoCacheTraits::kName),
+        [this, &filter] { return FetchPartition(filter); }));
+  }
+
+  std::vector<PartitionData> partitions;
+  partitions.reserve(tasks.size());
+  std::size_t max_partition_size = 0;
+  for (auto& task : tasks) {
+    partitions.push_back(task.Get());
+    stats_scope.IncreaseDocumentsReadCount(partitions.back().documents_read);
+    stats_scope.IncreaseDocumentsParseFailures(
+        partitions.back().parse_failures);
+    max_partition_size =
+        std::max(max_partition_size, partitions.back().documents_read);
+  }
+
+  // Partitions are parsed in parallel, so the rate of a single task matters
+  UpdateCpuRelaxIterations(max_partition_size,
+                           scope.ElapsedTotal(kFetchAndParseStage));
+
+  scope.Reset("merge");
+  auto new_cache = GetData(cache::UpdateType::kFull);
+  std::unordered_map<std::string, KeyType> new_document_keys;
+
+  utils::CpuRelax relax{cpu_relax_iterations_, &scope};
+  impl::MergeMongoCachePartitions<MongoCacheTraits>(
+      partitions, *new_cache,
+      change_stream_enabled_ ? &new_document_keys : nullptr, relax);
+
+  scope.Reset();
+
+  const auto size = new_cache->size();
+  this->Set(std::move(new_cache));
+  document_keys_ = std::move(new_document_keys);
+  stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::UpdateCpuRelaxIterations(
+    std::size_t doc_count, tracing::ScopeTime::DurationMillis elapsed_time) {
   if (elapsed_time > kCpuRelaxThreshold) {
     cpu_relax_iterations_ = static_cast<std::size_t>(
         static_cast<double>(doc_count) / (elapsed_time / kCpuRelaxInterval));
@@ -266,12 +585,6 @@ void MongoCache<MongoCacheTraits>::Update(
         "Will relax CPU every {} iterations",
         kName, elapsed_time.count(), doc_count, cpu_relax_iterations_);
   }
-
-  scope.Reset();
-
-  const auto size = new_cache->size();
-  this->Set(std::move(new_cache));
-  stats_scope.Finish(size);
 }
 
 template <class MongoCacheTraits>
@@ -283,7 +596,7 @@ MongoCache<MongoCacheTraits>::DeserializeObject(
   }
   if constexpr (mongo_cache::impl::kHasDefaultDeserializeObject<
                     MongoCacheTraits>) {
-    return doc.As<typename MongoCacheTraits::ObjectType>();
+    return impl::DeserializeMongoCacheObject<MongoCacheTraits>(doc);
   }
   UASSERT_MSG(false,
               "No deserialize operation defined but DeserializeObject invoked");
@@ -336,6 +649,119 @@ MongoCache<MongoCacheTraits>::GetData(cache::UpdateType type) {
   }
 }
 
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::ResetChangeStream() {
+  try {
+    resume_token_ = impl::GetMongoCacheResumeToken(
+        *mongo_collection_, MongoCacheTraits::kIsSecondaryPreferred);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to open change stream of cache "
+                  << MongoCacheTraits::kName << ": " << ex;
+    resume_token_.reset();
+  }
+}
+
+template <class MongoCacheTraits>
+bool MongoCache<MongoCacheTraits>::UpdateFromChangeStream(
+    cache::UpdateStatisticsScope& stats_scope) {
+  auto scope = tracing::Span::CurrentSpan().CreateScopeTime("read_changes");
+
+  impl::MongoCacheChanges changes;
+  try {
+    changes = impl::ReadMongoCacheChanges(
+        *mongo_collection_, *resume_token_,
+        MongoCacheTraits::kIsSecondaryPreferred);
+  } catch (const std::exception& ex) {
+    if (!impl::IsMongoCacheChangeStreamLost(ex)) {
+      // The changes are read again from the same token by the next update
+      LOG_WARNING() << "Failed to read change stream of cache "
+                    << MongoCacheTraits::kName << ", polling instead: " << ex;
+      return false;
+    }
+    LOG_WARNING() << "Change stream of cache " << MongoCacheTraits::kName
+                  << " cannot be resumed, scheduling full update: " << ex;
+    changes.is_invalidated = true;
+  }
+  if (changes.is_invalidated) {
+    ResetChangeStream();
+    this->InvalidateAsync(cache::UpdateType::kFull);
+    return false;
+  }
+
+  if (changes.events.empty()) {
+    if (changes.resume_token) resume_token_ = std::move(changes.resume_token);
+    stats_scope.FinishNoChanges();
+    return true;
+  }
+
+  scope.Reset("copy_data");
+  auto new_cache = GetData(cache::UpdateType::kIncremental);
+
+  scope.Reset(kFetchAndParseStage);
+  utils::CpuRelax relax{cpu_relax_iterations_, &scope};
+
+  // Applied to document_keys_ only if the whole update succeeds. Only the
+  // last event of each document is applied, so an invalid document version
+  // superseded by a later change does not fail the updates.
+  std::unordered_map<std::string, std::optional<KeyType>> key_changes;
+  std::unordered_set<std::string> seen_ids;
+
+  for (auto it = changes.events.rbegin(); it != changes.events.rend(); ++it) {
+    const auto& event = *it;
+    relax.Relax();
+
+    const auto change_type = impl::GetMongoCacheChangeType(event);
+    if (change_type == impl::MongoCacheChangeType::kIgnore) continue;
+
+    const auto id = impl::GetMongoCacheDocumentId(event["documentKey"]["_id"]);
+    if (!seen_ids.insert(id).second) continue;
+    stats_scope.IncreaseDocumentsReadCount(1);
+
+    std::optional<KeyType> old_key;
+    if (const auto key_it = document_keys_.find(id);
+        key_it != document_keys_.end()) {
+      old_key = key_it->second;
+    }
+
+    if (change_type == impl::MongoCacheChangeType::kDelete) {
+      if (old_key) new_cache->erase(*old_key);
+      key_changes.emplace(id, std::nullopt);
+      continue;
+    }
+
+    const formats::bson::Document doc = event["fullDocument"];
+    try {
+      auto object = DeserializeObject(doc);
+      auto key = (object.*MongoCacheTraits::kKeyField);
+      if (old_key && !(*old_key == key)) new_cache->erase(*old_key);
+      key_changes.emplace(id, key);
+      (*new_cache)[key] = std::move(object);
+    } catch (const std::exception& e) {
+      LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                          << MongoCacheTraits::kName << " from change stream, "
+                          << "_id=" << id << ", what(): " << e;
+      stats_scope.IncreaseDocumentsParseFailures(1);
+
+      if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+    }
+  }
+
+  scope.Reset();
+
+  const auto size = new_cache->size();
+  this->Set(std::move(new_cache));
+  for (auto& [id, key] : key_changes) {
+    if (key) {
+      document_keys_[id] = std::move(*key);
+    } else {
+      document_keys_.erase(id);
+    }
+  }
+  if (changes.resume_token) resume_token_ = std::move(changes.resume_token);
+  stats_scope.Finish(size);
+  return true;
+}
+
 namespace impl {
 
 std::string GetMongoCacheSchema();
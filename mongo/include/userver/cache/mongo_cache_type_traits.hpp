@@ -69,6 +69,21 @@ template <typename T>
 inline constexpr bool kHasDefaultDeserializeObject =
     meta::kIsDetected<HasDefaultDeserializeObject, T>;
 
+template <typename T>
+using HasStreamParseOption = decltype(T::kUseStreamParse);
+template <typename T>
+inline constexpr bool kHasStreamParseOption =
+    meta::kIsDetected<HasStreamParseOption, T>;
+
+template <typename T>
+constexpr bool IsStreamParseEnabled() {
+  if constexpr (kHasStreamParseOption<T>) {
+    return T::kUseStreamParse;
+  } else {
+    return false;
+  }
+}
+
 template <typename T>
 using HasFindOperation = decltype(T::GetFindOperation);
 template <typename T>
@@ -130,6 +145,15 @@ struct CheckTraits {
               bool>,
           "Mongo cache traits must specify kUseDefaultFindOperation as bool");
     }
+    if constexpr (kHasStreamParseOption<MongoCacheTraits>) {
+      static_assert(
+          std::is_same_v<
+              std::decay_t<decltype(MongoCacheTraits::kUseStreamParse)>, bool>,
+          "Mongo cache traits must specify kUseStreamParse as bool");
+      static_assert(kHasDefaultDeserializeObject<MongoCacheTraits>,
+                    "kUseStreamParse is only used by the default "
+                    "deserialize object, set kUseDefaultDeserializeObject");
+    }
   }
 
   static_assert(kHasCollectionsField<MongoCacheTraits>,
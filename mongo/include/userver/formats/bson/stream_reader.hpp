@@ -0,0 +1,234 @@
+#pragma once
+
+/// @file userver/formats/bson/stream_reader.hpp
+/// @brief @copybrief formats::bson::StreamReader
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <bson/bson.h>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/exception.hpp>
+#include <userver/formats/bson/types.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+class StreamReader;
+
+namespace impl {
+
+template <typename T>
+using HasStreamParse =
+    decltype(Parse(std::declval<StreamReader&>(), parse::To<T>{}));
+
+}  // namespace impl
+
+/// @brief Whether `T Parse(StreamReader&, formats::parse::To<T>)` is defined
+/// @note Generic `template <class Value> T Parse(const Value&, To<T>)`
+/// matches as well, so it does not tell whether the type opted in.
+template <typename T>
+inline constexpr bool kHasStreamParse =
+    meta::kIsDetected<impl::HasStreamParse, T>;
+
+// clang-format off
+
+/// @brief Forward-only reader over the fields of a BSON document or the
+/// elements of a BSON array.
+///
+/// Unlike formats::bson::Value, the reader does not build a tree of parsed
+/// nodes: values are read directly from the BSON buffer in a single pass.
+/// Use it to deserialize large amounts of documents, e.g. in caches.
+///
+/// User types are parsed by `T Parse(StreamReader& fields, formats::parse::To<T>)`
+/// found by ADL, `fields` iterates over the fields of the document being
+/// parsed. Containers, optionals and primitive types are supported out of the
+/// box.
+///
+/// ## Example:
+///
+/// @snippet formats/bson/stream_reader_test.cpp  Sample formats::bson::StreamReader usage
+///
+/// @warning The document must outlive the reader and all of its children.
+/// A child reader returned by Enter() must not outlive its parent.
+/// @note Duplicate fields are not detected, all of them are visited.
+
+// clang-format on
+
+class StreamReader final {
+ public:
+  /// Reads the fields of the document
+  explicit StreamReader(const Document& doc);
+
+  /// @brief Advances to the next field or element
+  /// @returns false if there are no more fields
+  bool Next();
+
+  /// Returns the name of the current field, for arrays it is the index
+  std::string_view GetName() const;
+
+  /// @name Type checking, same semantics as in formats::bson::Value
+  /// @{
+  bool IsNull() const;
+  bool IsBool() const;
+  bool IsInt32() const;
+  bool IsInt64() const;
+  bool IsDouble() const;
+  bool IsString() const;
+  bool IsDateTime() const;
+  bool IsOid() const;
+  bool IsArray() const;
+  bool IsDocument() const;
+  /// @}
+
+  /// @brief Extracts the current value with strict type checks
+  /// @throws TypeMismatchException, ConversionException
+  template <typename T>
+  T As() const;
+
+  /// @brief Extracts the current value with strict type checks, or returns
+  /// the default value if the current value is null
+  template <typename T, typename First, typename... Rest>
+  T As(First&& default_arg, Rest&&... more_default_args) const {
+    if (IsNull()) {
+      // NOLINTNEXTLINE(google-readability-casting)
+      return T(std::forward<First>(default_arg),
+               std::forward<Rest>(more_default_args)...);
+    }
+    return As<T>();
+  }
+
+  /// @brief Returns a reader over the fields of the current document or over
+  /// the elements of the current array
+  /// @throws TypeMismatchException if the current value is neither
+  StreamReader Enter() const;
+
+  /// Returns the path of the current value, for error messages
+  std::string GetPath() const;
+
+ private:
+  StreamReader(const StreamReader& parent, const bson_iter_t& iter);
+
+  bson_type_t Type() const;
+
+  bool AsBool() const;
+  int64_t AsInt64() const;
+  uint64_t AsUint64() const;
+  double AsDouble() const;
+  std::string_view AsStringView() const;
+  std::chrono::system_clock::time_point AsDateTime() const;
+  Oid AsOid() const;
+  Binary AsBinary() const;
+  Decimal128 AsDecimal128() const;
+  Document AsDocument() const;
+
+  [[noreturn]] void ThrowTypeMismatch(bson_type_t expected) const;
+
+  template <typename T>
+  T AsInteger() const;
+
+  template <typename T>
+  std::vector<T> AsVector() const;
+
+  bson_iter_t iter_;
+  const StreamReader* parent_{nullptr};
+  std::size_t index_{0};
+  bool is_array_{false};
+  bool has_current_{false};
+};
+
+template <typename T>
+T StreamReader::As() const {
+  if constexpr (std::is_same_v<T, bool>) {
+    return AsBool();
+  } else if constexpr (meta::kIsInteger<T>) {
+    return AsInteger<T>();
+  } else if constexpr (std::is_same_v<T, double>) {
+    return AsDouble();
+  } else if constexpr (std::is_same_v<T, float>) {
+    const auto value = AsDouble();
+    if (value < std::numeric_limits<float>::lowest() ||
+        value > std::numeric_limits<float>::max()) {
+      throw ConversionException("Value is out of bounds", GetPath());
+    }
+    return static_cast<float>(value);
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    return std::string{AsStringView()};
+  } else if constexpr (std::is_same_v<T, std::string_view>) {
+    return AsStringView();
+  } else if constexpr (std::is_same_v<T,
+                                      std::chrono::system_clock::time_point>) {
+    return AsDateTime();
+  } else if constexpr (std::is_same_v<T, Oid>) {
+    return AsOid();
+  } else if constexpr (std::is_same_v<T, Binary>) {
+    return AsBinary();
+  } else if constexpr (std::is_same_v<T, Decimal128>) {
+    return AsDecimal128();
+  } else if constexpr (std::is_same_v<T, Document>) {
+    return AsDocument();
+  } else if constexpr (meta::kIsOptional<T>) {
+    if (IsNull()) return std::nullopt;
+    return As<typename T::value_type>();
+  } else if constexpr (meta::kIsVector<T>) {
+    return AsVector<typename T::value_type>();
+  } else {
+    static_assert(kHasStreamParse<T>,
+                  "There is no `Parse(formats::bson::StreamReader&, "
+                  "formats::parse::To<T>)` in namespace of `T` or "
+                  "`formats::parse`. Probably you have not provided a `Parse` "
+                  "function overload.");
+    auto fields = Enter();
+    return Parse(fields, parse::To<T>{});
+  }
+}
+
+template <typename T>
+T StreamReader::AsInteger() const {
+  if constexpr (std::is_signed_v<T>) {
+    const auto value = AsInt64();
+    if (value < std::numeric_limits<T>::min() ||
+        value > std::numeric_limits<T>::max()) {
+      throw ConversionException("Value is out of bounds", GetPath());
+    }
+    return static_cast<T>(value);
+  } else {
+    const auto value = AsUint64();
+    if (value > std::numeric_limits<T>::max()) {
+      throw ConversionException("Value is out of bounds", GetPath());
+    }
+    return static_cast<T>(value);
+  }
+}
+
+template <typename T>
+std::vector<T> StreamReader::AsVector() const {
+  std::vector<T> result;
+  if (!IsArray()) ThrowTypeMismatch(BSON_TYPE_ARRAY);
+  for (auto elements = Enter(); elements.Next();) {
+    result.push_back(elements.As<T>());
+  }
+  return result;
+}
+
+/// @brief Parses the document in a single pass with StreamReader
+template <typename T>
+T StreamParse(const Document& doc) {
+  StreamReader fields{doc};
+  return Parse(fields, parse::To<T>{});
+}
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
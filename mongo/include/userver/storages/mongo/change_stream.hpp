@@ -0,0 +1,48 @@
+#pragma once
+
+/// @file userver/storages/mongo/change_stream.hpp
+/// @brief @copybrief storages::mongo::ChangeStream
+
+#include <memory>
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+namespace impl {
+class ChangeStreamImpl;
+}  // namespace impl
+
+/// @brief Interface for MongoDB change streams
+///
+/// Holds a connection from the pool while alive. Resumable errors are retried
+/// by the driver, other errors are thrown. The stream may be reopened after an
+/// error with options::ResumeAfter and the token from GetResumeToken().
+///
+/// @see https://www.mongodb.com/docs/manual/changeStreams/
+class ChangeStream {
+ public:
+  explicit ChangeStream(std::unique_ptr<impl::ChangeStreamImpl>&&);
+  ~ChangeStream();
+
+  ChangeStream(ChangeStream&&) noexcept;
+  ChangeStream& operator=(ChangeStream&&) noexcept;
+
+  /// @brief Waits for the next change event
+  /// @returns the event or `std::nullopt` if no events arrived during the
+  /// server await time, see options::MaxAwaitTime
+  std::optional<formats::bson::Document> Next();
+
+  /// @brief Returns the token to resume the stream after the last returned
+  /// event, may advance even if no events were returned
+  std::optional<formats::bson::Document> GetResumeToken() const;
+
+ private:
+  std::unique_ptr<impl::ChangeStreamImpl> impl_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -12,6 +12,7 @@
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/value.hpp>
 #include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/write_result.hpp>
@@ -125,6 +126,11 @@ class Collection {
   template <typename... Options>
   Cursor Aggregate(formats::bson::Value pipeline, Options&&... options);
 
+  /// @brief Opens a change stream on the collection
+  /// @param pipeline an array of aggregation stages applied to change events
+  template <typename... Options>
+  ChangeStream Watch(formats::bson::Value pipeline, Options&&... options) const;
+
   /// Get collection name
   const std::string& GetCollectionName() const;
 
@@ -143,6 +149,7 @@ class Collection {
   WriteResult Execute(operations::Bulk&&);
   Cursor Execute(const operations::Aggregate&);
   void Execute(const operations::Drop&);
+  ChangeStream Execute(const operations::Watch&) const;
   /// @}
  private:
   std::shared_ptr<impl::CollectionImpl> impl_;
@@ -304,6 +311,14 @@ Cursor Collection::Aggregate(formats::bson::Value pipeline,
   return Execute(aggregate);
 }
 
+template <typename... Options>
+ChangeStream Collection::Watch(formats::bson::Value pipeline,
+                               Options&&... options) const {
+  operations::Watch watch(std::move(pipeline));
+  (watch.SetOption(std::forward<Options>(options)), ...);
+  return Execute(watch);
+}
+
 }  // namespace storages::mongo
 
 USERVER_NAMESPACE_END
@@ -61,6 +61,9 @@ namespace components {
 /// maintenance_period | pool maintenance period (idle connections pruning etc.) | 15s
 /// stats_verbosity | changes the granularity of reported metrics | 'terse'
 /// dns_resolver | server hostname resolver type (getaddrinfo or async) | 'async'
+/// congestion_control.fake-mode | whether congestion control only computes the limit without applying it | false
+/// congestion_control.enabled | whether congestion control is enabled for the database | true
+/// congestion_control.algorithm | how to compute the limit: `linear` (congestion_control::v2::LinearController) or `gradient` (congestion_control::v2::GradientController) | linear
 ///
 /// `stats_verbosity` accepts one of the following values:
 /// Value | Description
@@ -157,6 +160,9 @@ inline constexpr bool kHasValidate<Mongo> = true;
 /// max_replication_lag | replication lag limit for usable secondaries, min. 90s | -
 /// stats_verbosity | changes the granularity of reported metrics | 'terse'
 /// dns_resolver | server hostname resolver type (getaddrinfo or async) | 'async'
+/// congestion_control.fake-mode | whether congestion control only computes the limit without applying it | false
+/// congestion_control.enabled | whether congestion control is enabled for the database | true
+/// congestion_control.algorithm | how to compute the limit: `linear` (congestion_control::v2::LinearController) or `gradient` (congestion_control::v2::GradientController) | linear
 ///
 /// `stats_verbosity` accepts one of the following values:
 /// Value | Description
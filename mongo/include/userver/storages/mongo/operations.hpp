@@ -362,6 +362,35 @@ class Drop {
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
 };
 
+/// @brief Opens a change stream on the collection
+/// @see https://www.mongodb.com/docs/manual/changeStreams/
+class Watch {
+ public:
+  Watch();
+  /// @param pipeline an array of aggregation stages applied to change events
+  explicit Watch(formats::bson::Value pipeline);
+  ~Watch();
+
+  Watch(const Watch&);
+  Watch(Watch&&) noexcept;
+  Watch& operator=(const Watch&);
+  Watch& operator=(Watch&&) noexcept;
+
+  void SetOption(const options::ReadPreference&);
+  void SetOption(options::ReadPreference::Mode);
+  void SetOption(const options::ResumeAfter&);
+  void SetOption(options::FullDocumentLookup);
+  void SetOption(const options::MaxAwaitTime&);
+
+ private:
+  friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
+
+  class Impl;
+  static constexpr size_t kSize = 120;
+  static constexpr size_t kAlignment = 8;
+  utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
+};
+
 }  // namespace storages::mongo::operations
 
 USERVER_NAMESPACE_END
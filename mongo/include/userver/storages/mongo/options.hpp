@@ -300,6 +300,36 @@ class MaxServerTime {
   std::chrono::milliseconds value_;
 };
 
+/// @brief Resumes a change stream after the event with the specified token
+/// @see storages::mongo::ChangeStream::GetResumeToken
+class ResumeAfter {
+ public:
+  explicit ResumeAfter(formats::bson::Document token);
+
+  const formats::bson::Document& Value() const;
+
+ private:
+  formats::bson::Document value_;
+};
+
+/// @brief Makes change stream events for updates contain the current
+/// majority-committed version of the document in the `fullDocument` field
+class FullDocumentLookup {};
+
+/// @brief Specifies the server-side time limit to wait for new change stream
+/// events before returning an empty batch
+/// @warning Must be less than the socket timeout of the pool.
+class MaxAwaitTime {
+ public:
+  explicit MaxAwaitTime(const std::chrono::milliseconds& value)
+      : value_(value) {}
+
+  const std::chrono::milliseconds& Value() const { return value_; }
+
+ private:
+  std::chrono::milliseconds value_;
+};
+
 }  // namespace storages::mongo::options
 
 USERVER_NAMESPACE_END
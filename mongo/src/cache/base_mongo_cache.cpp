@@ -1,17 +1,186 @@
 #include <userver/cache/base_mongo_cache.hpp>
 
+#include <stdexcept>
+
 #include <userver/components/component_config.hpp>
+#include <userver/formats/bson/serialize.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
+#include <userver/storages/mongo/exception.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace components::impl {
 
+namespace {
+
+// Server error codes meaning that the change stream cannot be resumed
+constexpr int kCappedPositionLost = 136;
+constexpr int kInvalidResumeToken = 260;
+constexpr int kChangeStreamFatalError = 280;
+constexpr int kChangeStreamHistoryLost = 286;
+
+// More samples give more even partitions at the cost of a slower $sample
+constexpr std::size_t kSamplesPerPartition = 16;
+
+}  // namespace
+
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(
     const ComponentConfig& config) {
   return config["update-correction"].As<std::chrono::milliseconds>(0);
 }
 
+bool IsMongoCacheChangeStreamEnabled(const ComponentConfig& config) {
+  return config["change-stream-enabled"].As<bool>(false);
+}
+
+storages::mongo::operations::Watch MakeMongoCacheWatchOperation(
+    const std::optional<formats::bson::Document>& resume_token,
+    bool is_secondary_preferred) {
+  namespace sm = storages::mongo;
+
+  sm::operations::Watch watch_op;
+  watch_op.SetOption(sm::options::FullDocumentLookup{});
+  watch_op.SetOption(sm::options::MaxAwaitTime{kChangeStreamMaxAwaitTime});
+  if (resume_token) {
+    watch_op.SetOption(sm::options::ResumeAfter{*resume_token});
+  }
+  if (is_secondary_preferred) {
+    watch_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+  return watch_op;
+}
+
+MongoCacheChangeType GetMongoCacheChangeType(
+    const formats::bson::Document& event) {
+  const auto operation_type = event["operationType"].As<std::string>();
+  if (operation_type == "insert" || operation_type == "update" ||
+      operation_type == "replace") {
+    // fullDocument is null if the document was deleted after the update
+    return event["fullDocument"].IsDocument() ? MongoCacheChangeType::kUpsert
+                                              : MongoCacheChangeType::kDelete;
+  }
+  if (operation_type == "delete") return MongoCacheChangeType::kDelete;
+  if (operation_type == "invalidate") return MongoCacheChangeType::kInvalidate;
+  return MongoCacheChangeType::kIgnore;
+}
+
+std::string GetMongoCacheDocumentId(const formats::bson::Value& id) {
+  // Canonical representation keeps ids of different types apart
+  return formats::bson::ToCanonicalJsonString(
+             formats::bson::MakeDoc("_id", id))
+      .ToString();
+}
+
+bool IsMongoCacheChangeStreamLost(const std::exception& ex) {
+  const auto* server_ex =
+      dynamic_cast<const storages::mongo::ServerException*>(&ex);
+  if (!server_ex) return false;
+
+  switch (server_ex->Code()) {
+    case kCappedPositionLost:
+    case kInvalidResumeToken:
+    case kChangeStreamFatalError:
+    case kChangeStreamHistoryLost:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::optional<formats::bson::Document> GetMongoCacheResumeToken(
+    const storages::mongo::Collection& collection,
+    bool is_secondary_preferred) {
+  // The token of a new stream points to the current time
+  return collection
+      .Execute(MakeMongoCacheWatchOperation(std::nullopt,
+                                            is_secondary_preferred))
+      .GetResumeToken();
+}
+
+MongoCacheChanges ReadMongoCacheChanges(
+    const storages::mongo::Collection& collection,
+    const formats::bson::Document& resume_token, bool is_secondary_preferred) {
+  auto stream = collection.Execute(
+      MakeMongoCacheWatchOperation(resume_token, is_secondary_preferred));
+
+  MongoCacheChanges changes;
+  while (changes.events.size() < kChangeStreamMaxEvents) {
+    auto event = stream.Next();
+    if (!event) break;
+    if (GetMongoCacheChangeType(*event) == MongoCacheChangeType::kInvalidate) {
+      changes.is_invalidated = true;
+      break;
+    }
+    changes.events.push_back(std::move(*event));
+  }
+  changes.resume_token = stream.GetResumeToken();
+  return changes;
+}
+
+std::size_t GetMongoCacheFullUpdatePartitions(const ComponentConfig& config) {
+  const auto partitions = config["full-update-partitions"].As<std::size_t>(1);
+  if (partitions == 0) {
+    throw std::logic_error(
+        "Invalid full-update-partitions value in config of '" +
+        components::GetCurrentComponentName(config) + "' cache");
+  }
+  return partitions;
+}
+
+std::vector<formats::bson::Document> GetMongoCachePartitionFilters(
+    storages::mongo::Collection collection, std::size_t partitions,
+    bool is_secondary_preferred) {
+  namespace bson = formats::bson;
+  namespace sm = storages::mongo;
+
+  sm::operations::Aggregate sample_op(bson::MakeArray(
+      bson::MakeDoc("$sample",
+                    bson::MakeDoc("size", static_cast<int64_t>(
+                                              partitions *
+                                              kSamplesPerPartition))),
+      bson::MakeDoc("$project", bson::MakeDoc("_id", 1)),
+      bson::MakeDoc("$sort", bson::MakeDoc("_id", 1))));
+  if (is_secondary_preferred) {
+    sample_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+
+  std::vector<bson::Value> samples;
+  for (const auto& doc : collection.Execute(sample_op)) {
+    samples.push_back(doc["_id"]);
+  }
+  return MakeMongoCachePartitionFilters(samples, partitions);
+}
+
+std::vector<formats::bson::Document> MakeMongoCachePartitionFilters(
+    const std::vector<formats::bson::Value>& samples, std::size_t partitions) {
+  namespace bson = formats::bson;
+
+  std::vector<bson::Value> split_points;
+  for (std::size_t i = 1; i < partitions && !samples.empty(); ++i) {
+    auto split_point = samples[i * samples.size() / partitions];
+    if (!split_points.empty() && split_points.back() == split_point) continue;
+    split_points.push_back(std::move(split_point));
+  }
+  if (split_points.empty()) return {bson::Document{}};
+
+  // Comparisons of _id only match values of the same BSON type, so ranges are
+  // built as differences of {$gte: split_point} sets. This way documents
+  // with _id types missing from the sample still belong to exactly one
+  // partition.
+  std::vector<bson::Document> filters;
+  filters.reserve(split_points.size() + 1);
+  for (std::size_t i = 0; i <= split_points.size(); ++i) {
+    bson::ValueBuilder range(bson::ValueBuilder::Type::kObject);
+    if (i > 0) range["$gte"] = split_points[i - 1];
+    if (i < split_points.size()) {
+      range["$not"] = bson::MakeDoc("$gte", split_points[i]);
+    }
+    filters.push_back(bson::MakeDoc("_id", range.ExtractValue()));
+  }
+  return filters;
+}
+
 std::string GetMongoCacheSchema() {
   return R"(
 type: object
@@ -22,6 +191,15 @@ properties:
         type: string
         description: adjusts incremental updates window to overlap with previous update
         defaultDescription: 0
+    change-stream-enabled:
+        type: boolean
+        description: apply changes from a MongoDB change stream instead of polling for incremental updates
+        defaultDescription: false
+    full-update-partitions:
+        type: integer
+        description: number of _id ranges fetched and parsed in parallel on full updates
+        defaultDescription: 1
+        minimum: 1
 )";
 }
 
@@ -0,0 +1,81 @@
+#include <userver/cache/base_mongo_cache.hpp>
+
+#include <utility>
+
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/pool.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <storages/mongo/util_mongotest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using formats::bson::MakeDoc;
+namespace impl = components::impl;
+
+class MongoCacheChangeStream : public MongoPoolFixture {};
+
+}  // namespace
+
+UTEST_F(MongoCacheChangeStream, WatchOperation) {
+  auto coll = GetDefaultPool().GetCollection("cache_watch");
+  coll.InsertOne(MakeDoc("_id", 0));
+
+  auto stream = coll.Execute(impl::MakeMongoCacheWatchOperation(
+      std::nullopt, /*is_secondary_preferred=*/false));
+  EXPECT_FALSE(stream.Next());
+  const auto resume_token = stream.GetResumeToken();
+  ASSERT_TRUE(resume_token);
+
+  coll.InsertOne(MakeDoc("_id", 1, "x", 1));
+  coll.UpdateOne(MakeDoc("_id", 1), MakeDoc("$set", MakeDoc("x", 2)));
+
+  // Full documents are looked up for updates, the stream resumes after
+  // the token. Inserts carry the inserted document.
+  auto resumed = coll.Execute(impl::MakeMongoCacheWatchOperation(
+      resume_token, /*is_secondary_preferred=*/true));
+  const std::pair<const char*, int> kExpectedEvents[] = {{"insert", 1},
+                                                         {"update", 2}};
+  for (const auto& [operation_type, x] : kExpectedEvents) {
+    const auto event = resumed.Next();
+    ASSERT_TRUE(event) << operation_type;
+    EXPECT_EQ((*event)["operationType"].As<std::string>(), operation_type);
+    EXPECT_EQ((*event)["fullDocument"]["x"].As<int>(), x) << operation_type;
+  }
+  EXPECT_FALSE(resumed.Next());
+}
+
+UTEST_F(MongoCacheChangeStream, ReadChanges) {
+  auto coll = GetDefaultPool().GetCollection("cache_changes");
+  coll.InsertOne(MakeDoc("_id", 0));
+
+  const auto resume_token = impl::GetMongoCacheResumeToken(coll, false);
+  ASSERT_TRUE(resume_token);
+
+  auto changes = impl::ReadMongoCacheChanges(coll, *resume_token, false);
+  EXPECT_TRUE(changes.events.empty());
+  EXPECT_FALSE(changes.is_invalidated);
+  ASSERT_TRUE(changes.resume_token);
+
+  coll.InsertOne(MakeDoc("_id", 1));
+  coll.DeleteOne(MakeDoc("_id", 0));
+
+  changes = impl::ReadMongoCacheChanges(coll, *changes.resume_token, false);
+  ASSERT_EQ(changes.events.size(), 2);
+  EXPECT_EQ(impl::GetMongoCacheChangeType(changes.events[0]),
+            impl::MongoCacheChangeType::kUpsert);
+  EXPECT_EQ(impl::GetMongoCacheChangeType(changes.events[1]),
+            impl::MongoCacheChangeType::kDelete);
+  EXPECT_FALSE(changes.is_invalidated);
+  ASSERT_TRUE(changes.resume_token);
+
+  // The next read starts after the returned events
+  coll.Drop();
+  changes = impl::ReadMongoCacheChanges(coll, *changes.resume_token, false);
+  EXPECT_TRUE(changes.is_invalidated);
+}
+
+USERVER_NAMESPACE_END
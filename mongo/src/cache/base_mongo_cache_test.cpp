@@ -0,0 +1,242 @@
+#include <userver/cache/base_mongo_cache.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo/exception.hpp>
+#include <userver/utils/cpu_relax.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using components::impl::GetMongoCacheChangeType;
+using components::impl::GetMongoCacheDocumentId;
+using components::impl::MongoCacheChangeType;
+using formats::bson::MakeDoc;
+
+struct MergeTraits {
+  struct Object {
+    int key;
+    std::string value;
+  };
+
+  static constexpr std::string_view kName = "merge-test";
+  using ObjectType = Object;
+  static constexpr auto kKeyField = &Object::key;
+  using DataType = std::unordered_map<int, Object>;
+};
+
+using Partition = components::impl::MongoCachePartition<MergeTraits::Object>;
+
+struct GenericParseObject {
+  int x{0};
+  bool parsed_by_stream{false};
+};
+
+// Matches `Parse(formats::bson::StreamReader&, To<GenericParseObject>)` too
+template <class Value>
+GenericParseObject Parse(const Value& value,
+                         formats::parse::To<GenericParseObject>) {
+  return {value["x"].template As<int>()};
+}
+
+struct GenericParseTraits {
+  using ObjectType = GenericParseObject;
+  static constexpr bool kUseDefaultDeserializeObject = true;
+};
+
+struct StreamParseObject {
+  int x{0};
+  bool parsed_by_stream{false};
+};
+
+StreamParseObject Parse(formats::bson::StreamReader& fields,
+                        formats::parse::To<StreamParseObject>) {
+  StreamParseObject object{0, true};
+  while (fields.Next()) {
+    if (fields.GetName() == "x") object.x = fields.As<int>();
+  }
+  return object;
+}
+
+StreamParseObject Parse(const formats::bson::Value& value,
+                        formats::parse::To<StreamParseObject>) {
+  return {value["x"].As<int>()};
+}
+
+struct StreamParseTraits {
+  using ObjectType = StreamParseObject;
+  static constexpr bool kUseDefaultDeserializeObject = true;
+  static constexpr bool kUseStreamParse = true;
+};
+
+struct StreamParseDisabledTraits {
+  using ObjectType = StreamParseObject;
+  static constexpr bool kUseDefaultDeserializeObject = true;
+  static constexpr bool kUseStreamParse = false;
+};
+
+std::vector<formats::bson::Value> MakeSamples(std::vector<int> ids) {
+  std::vector<formats::bson::Value> samples;
+  for (const auto id : ids) samples.push_back(MakeDoc("_id", id)["_id"]);
+  return samples;
+}
+
+}  // namespace
+
+TEST(MongoCacheChangeStream, ChangeType) {
+  const auto document = MakeDoc("_id", 1, "x", 2);
+
+  for (const auto* operation_type : {"insert", "update", "replace"}) {
+    EXPECT_EQ(GetMongoCacheChangeType(MakeDoc("operationType", operation_type,
+                                              "fullDocument", document)),
+              MongoCacheChangeType::kUpsert)
+        << operation_type;
+  }
+
+  // The document was deleted before the update was looked up
+  EXPECT_EQ(GetMongoCacheChangeType(MakeDoc("operationType", "update",
+                                            "fullDocument", nullptr)),
+            MongoCacheChangeType::kDelete);
+  EXPECT_EQ(GetMongoCacheChangeType(MakeDoc("operationType", "delete")),
+            MongoCacheChangeType::kDelete);
+
+  EXPECT_EQ(GetMongoCacheChangeType(MakeDoc("operationType", "invalidate")),
+            MongoCacheChangeType::kInvalidate);
+  EXPECT_EQ(GetMongoCacheChangeType(MakeDoc("operationType", "drop")),
+            MongoCacheChangeType::kIgnore);
+  EXPECT_EQ(GetMongoCacheChangeType(MakeDoc("operationType", "rename")),
+            MongoCacheChangeType::kIgnore);
+}
+
+TEST(MongoCacheChangeStream, DocumentId) {
+  const auto ids = MakeDoc("int", 1, "int_again", 1, "string", "1", "oid",
+                           formats::bson::Oid{});
+
+  EXPECT_EQ(GetMongoCacheDocumentId(ids["int"]),
+            GetMongoCacheDocumentId(ids["int_again"]));
+  EXPECT_NE(GetMongoCacheDocumentId(ids["int"]),
+            GetMongoCacheDocumentId(ids["string"]));
+  EXPECT_NE(GetMongoCacheDocumentId(ids["oid"]),
+            GetMongoCacheDocumentId(ids["string"]));
+
+  // Compound _id values are compared by value
+  EXPECT_EQ(GetMongoCacheDocumentId(MakeDoc("id", MakeDoc("a", 1))["id"]),
+            GetMongoCacheDocumentId(MakeDoc("id", MakeDoc("a", 1))["id"]));
+  EXPECT_NE(GetMongoCacheDocumentId(MakeDoc("id", MakeDoc("a", 1))["id"]),
+            GetMongoCacheDocumentId(MakeDoc("id", MakeDoc("a", 2))["id"]));
+}
+
+TEST(MongoCacheChangeStream, StreamLost) {
+  using components::impl::IsMongoCacheChangeStreamLost;
+  namespace sm = storages::mongo;
+
+  // ChangeStreamHistoryLost, InvalidResumeToken
+  EXPECT_TRUE(IsMongoCacheChangeStreamLost(sm::ServerException{286}));
+  EXPECT_TRUE(IsMongoCacheChangeStreamLost(sm::ServerException{260}));
+
+  // DuplicateKey, network errors and others may be retried
+  EXPECT_FALSE(IsMongoCacheChangeStreamLost(sm::ServerException{11000}));
+  EXPECT_FALSE(IsMongoCacheChangeStreamLost(sm::NetworkException{}));
+  EXPECT_FALSE(IsMongoCacheChangeStreamLost(std::runtime_error{"error"}));
+}
+
+TEST(MongoCacheDeserialize, TemplatedParse) {
+  using components::impl::DeserializeMongoCacheObject;
+
+  const auto object =
+      DeserializeMongoCacheObject<GenericParseTraits>(MakeDoc("x", 1));
+  EXPECT_EQ(object.x, 1);
+  EXPECT_FALSE(object.parsed_by_stream);
+}
+
+TEST(MongoCacheDeserialize, StreamParseOptIn) {
+  using components::impl::DeserializeMongoCacheObject;
+
+  const auto stream =
+      DeserializeMongoCacheObject<StreamParseTraits>(MakeDoc("x", 1));
+  EXPECT_EQ(stream.x, 1);
+  EXPECT_TRUE(stream.parsed_by_stream);
+
+  const auto value =
+      DeserializeMongoCacheObject<StreamParseDisabledTraits>(MakeDoc("x", 2));
+  EXPECT_EQ(value.x, 2);
+  EXPECT_FALSE(value.parsed_by_stream);
+}
+
+TEST(MongoCachePartitions, Filters) {
+  using components::impl::MakeMongoCachePartitionFilters;
+
+  std::vector<int> ids;
+  for (int i = 0; i < 100; ++i) ids.push_back(i);
+
+  const auto filters = MakeMongoCachePartitionFilters(MakeSamples(ids), 4);
+  ASSERT_EQ(filters.size(), 4);
+  EXPECT_EQ(filters[0],
+            MakeDoc("_id", MakeDoc("$not", MakeDoc("$gte", 25))));
+  EXPECT_EQ(filters[1], MakeDoc("_id", MakeDoc("$gte", 25, "$not",
+                                               MakeDoc("$gte", 50))));
+  EXPECT_EQ(filters[2], MakeDoc("_id", MakeDoc("$gte", 50, "$not",
+                                               MakeDoc("$gte", 75))));
+  EXPECT_EQ(filters[3], MakeDoc("_id", MakeDoc("$gte", 75)));
+}
+
+TEST(MongoCachePartitions, FiltersFallback) {
+  using components::impl::MakeMongoCachePartitionFilters;
+
+  // Equal split points are merged
+  EXPECT_EQ(MakeMongoCachePartitionFilters(MakeSamples({1, 1, 1, 1}), 4)
+                .size(),
+            2);
+
+  // The whole collection is read by a single cursor
+  const std::vector<formats::bson::Document> single_filter{{}};
+  EXPECT_EQ(MakeMongoCachePartitionFilters({}, 4), single_filter);
+  EXPECT_EQ(MakeMongoCachePartitionFilters(MakeSamples({1, 2, 3}), 1),
+            single_filter);
+}
+
+TEST(MongoCachePartitions, Merge) {
+  std::vector<Partition> partitions(2);
+  partitions[0].items.push_back({"a", {1, "a"}});
+  partitions[0].items.push_back({"b", {2, "b"}});
+  partitions[1].items.push_back({"c", {2, "c"}});
+  partitions[1].items.push_back({"d", {3, "d"}});
+
+  MergeTraits::DataType data;
+  std::unordered_map<std::string, int> document_keys;
+  utils::CpuRelax relax{0, nullptr};
+  components::impl::MergeMongoCachePartitions<MergeTraits>(
+      partitions, data, &document_keys, relax);
+
+  ASSERT_EQ(data.size(), 3);
+  // The first of the duplicates is kept
+  EXPECT_EQ(data.at(2).value, "b");
+  EXPECT_EQ(data.at(3).value, "d");
+  EXPECT_EQ(document_keys, (std::unordered_map<std::string, int>{
+                               {"a", 1}, {"b", 2}, {"d", 3}}));
+  for (const auto& partition : partitions) {
+    EXPECT_TRUE(partition.items.empty());
+  }
+}
+
+TEST(MongoCachePartitions, MergeWithoutDocumentKeys) {
+  std::vector<Partition> partitions(1);
+  partitions[0].items.push_back({"", {1, "a"}});
+
+  MergeTraits::DataType data;
+  utils::CpuRelax relax{0, nullptr};
+  components::impl::MergeMongoCachePartitions<MergeTraits>(partitions, data,
+                                                           nullptr, relax);
+  ASSERT_EQ(data.size(), 1);
+  EXPECT_EQ(data.at(1).value, "a");
+}
+
+USERVER_NAMESPACE_END
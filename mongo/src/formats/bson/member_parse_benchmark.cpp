@@ -2,6 +2,7 @@
 
 #include <userver/formats/bson.hpp>
 #include <userver/formats/bson/serialize.hpp>
+#include <userver/formats/bson/stream_reader.hpp>
 #include <userver/formats/json.hpp>
 
 #include <array>
@@ -202,6 +203,107 @@ models::Profile Parse(const formats::bson::Value& val, To<models::Profile>) {
   return profile;
 }
 
+// Single pass parsers with formats::bson::StreamReader
+
+models::ProfileCar Parse(formats::bson::StreamReader& fields,
+                         To<models::ProfileCar>) {
+  models::ProfileCar car;
+  while (fields.Next()) {
+    const auto name = fields.GetName();
+    if (name == names::car::kNumber) {
+      car.number = fields.As<std::string>();
+    } else if (name == names::car::kModel) {
+      car.model = fields.As<std::string>(std::string{});
+    } else if (name == names::car::kMarkCode) {
+      car.mark_code = fields.As<std::string>(std::string{});
+    } else if (name == names::car::kAge) {
+      car.age = fields.As<short>(0);
+    } else if (name == names::car::kPrice) {
+      car.price = fields.As<double>(0);
+    }
+  }
+  return car;
+}
+
+models::Requirements::ChildSeats Parse(
+    formats::bson::StreamReader& elements,
+    To<models::Requirements::ChildSeats>) {
+  models::Requirements::ChildSeats seats;
+  while (elements.Next()) {
+    if (!elements.IsArray()) return seats;
+
+    models::Requirements::ChildSeat seat;
+    for (auto chair_classes = elements.Enter(); chair_classes.Next();) {
+      if (!chair_classes.IsInt64()) return seats;
+      seat.push_back(chair_classes.As<short>());
+    }
+
+    std::sort(seat.begin(), seat.end());
+    seats.push_back(std::move(seat));
+  }
+  return seats;
+}
+
+models::Requirements Parse(formats::bson::StreamReader& fields,
+                           To<models::Requirements>) {
+  models::Requirements result;
+  while (fields.Next()) {
+    const std::string name{fields.GetName()};
+
+    if (name == names::requirements::kChildSeats) {
+      result.Add(name, fields.IsArray()
+                           ? fields.As<models::Requirements::ChildSeats>()
+                           : models::Requirements::ChildSeats{});
+    } else if (fields.IsBool()) {
+      result.Add(name, fields.As<bool>());
+    } else if (fields.IsInt64()) {
+      result.Add(name, fields.As<short>());
+    }
+  }
+  return result;
+}
+
+models::ClassesGrade Parse(formats::bson::StreamReader& elements,
+                           To<models::ClassesGrade>) {
+  models::ClassesGrade ret;
+  while (elements.Next()) {
+    std::string class_name;
+    models::ClassesGrade::value_t value{};
+    for (auto fields = elements.Enter(); fields.Next();) {
+      if (fields.GetName() == names::kGradeClass) {
+        class_name = fields.As<std::string>();
+      } else if (fields.GetName() == names::kGradeValue) {
+        value = fields.As<models::ClassesGrade::value_t>();
+      }
+    }
+    ret.Set(class_name, value);
+  }
+  return ret;
+}
+
+models::Profile Parse(formats::bson::StreamReader& fields,
+                      To<models::Profile>) {
+  models::Profile profile;
+  while (fields.Next()) {
+    const auto name = fields.GetName();
+    if (name == names::kUuid) {
+      profile.driver_id.uuid = fields.As<std::string>();
+      profile.driver_id.dbid = profile.driver_id.uuid;  // changed
+    } else if (name == names::kCar) {
+      profile.car = fields.As<models::ProfileCar>();
+    } else if (name == names::kLicense) {
+      profile.license = fields.As<std::string>();
+    } else if (name == names::kRequirements) {
+      profile.available_requirements =
+          fields.As<models::Requirements>(models::Requirements{});
+    } else if (name == names::kGrades) {
+      profile.grades =
+          fields.As<models::ClassesGrade>(models::ClassesGrade{});
+    }
+  }
+  return profile;
+}
+
 }  // namespace models
 
 }  // anonymous namespace
@@ -233,4 +335,16 @@ void bson_parse_access(benchmark::State& state) {
 }
 BENCHMARK(bson_parse_access);
 
+void bson_parse_stream(benchmark::State& state) {
+  static unsigned i = 0;
+
+  for (auto _ : state) {
+    auto bson = formats::bson::Document(bench_bson_data[++i % kBenchRows]);
+
+    const auto res = formats::bson::StreamParse<models::Profile>(bson);
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(bson_parse_stream);
+
 USERVER_NAMESPACE_END
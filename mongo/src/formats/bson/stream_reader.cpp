@@ -0,0 +1,201 @@
+#include <userver/formats/bson/stream_reader.hpp>
+
+#include <cmath>
+
+#include <formats/bson/wrappers.hpp>
+#include <userver/formats/common/path.hpp>
+#include <userver/utils/algo.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+namespace {
+
+constexpr std::int64_t kMaxIntDouble{std::int64_t{1}
+                                     << std::numeric_limits<double>::digits};
+
+}  // namespace
+
+StreamReader::StreamReader(const Document& doc) {
+  if (!bson_iter_init(&iter_, doc.GetBson().get())) {
+    throw ParseException("Invalid BSON document");
+  }
+}
+
+StreamReader::StreamReader(const StreamReader& parent, const bson_iter_t& iter)
+    : parent_(&parent), is_array_(parent.IsArray()) {
+  if (!bson_iter_recurse(&iter, &iter_)) {
+    throw ParseException("Invalid BSON subdocument at '" + parent.GetPath() +
+                         '\'');
+  }
+}
+
+bool StreamReader::Next() {
+  has_current_ = bson_iter_next(&iter_);
+  if (has_current_) ++index_;
+  return has_current_;
+}
+
+std::string_view StreamReader::GetName() const {
+  UASSERT(has_current_);
+  return bson_iter_key(&iter_);
+}
+
+bson_type_t StreamReader::Type() const {
+  UASSERT_MSG(has_current_, "Next() must be called before reading a value");
+  return has_current_ ? bson_iter_type(&iter_) : BSON_TYPE_EOD;
+}
+
+bool StreamReader::IsNull() const { return Type() == BSON_TYPE_NULL; }
+
+bool StreamReader::IsBool() const { return Type() == BSON_TYPE_BOOL; }
+
+bool StreamReader::IsInt32() const { return Type() == BSON_TYPE_INT32; }
+
+bool StreamReader::IsInt64() const {
+  return Type() == BSON_TYPE_INT64 || IsInt32();
+}
+
+bool StreamReader::IsDouble() const {
+  return Type() == BSON_TYPE_DOUBLE || IsInt64();
+}
+
+bool StreamReader::IsString() const { return Type() == BSON_TYPE_UTF8; }
+
+bool StreamReader::IsDateTime() const { return Type() == BSON_TYPE_DATE_TIME; }
+
+bool StreamReader::IsOid() const { return Type() == BSON_TYPE_OID; }
+
+bool StreamReader::IsArray() const { return Type() == BSON_TYPE_ARRAY; }
+
+bool StreamReader::IsDocument() const { return Type() == BSON_TYPE_DOCUMENT; }
+
+StreamReader StreamReader::Enter() const {
+  if (!IsDocument() && !IsArray()) ThrowTypeMismatch(BSON_TYPE_DOCUMENT);
+  return StreamReader{*this, iter_};
+}
+
+std::string StreamReader::GetPath() const {
+  std::string path = parent_ ? parent_->GetPath() : std::string{};
+  if (path == common::kPathRoot) path.clear();
+
+  if (!has_current_) return path.empty() ? common::kPathRoot : path;
+  if (is_array_) {
+    common::AppendPath(path, index_ - 1);
+  } else {
+    common::AppendPath(path, GetName());
+  }
+  return path;
+}
+
+bool StreamReader::AsBool() const {
+  if (!IsBool()) ThrowTypeMismatch(BSON_TYPE_BOOL);
+  return bson_iter_bool(&iter_);
+}
+
+int64_t StreamReader::AsInt64() const {
+  switch (Type()) {
+    case BSON_TYPE_INT32:
+      return bson_iter_int32(&iter_);
+    case BSON_TYPE_INT64:
+      return bson_iter_int64(&iter_);
+    case BSON_TYPE_DOUBLE: {
+      const auto as_double = bson_iter_double(&iter_);
+      double int_part = 0.0;
+      const auto frac_part = std::modf(as_double, &int_part);
+      if (frac_part || std::abs(as_double) >= kMaxIntDouble) {
+        throw ConversionException(
+            utils::StrCat("Conversion ", std::to_string(as_double),
+                          " to integer causes precision change"),
+            GetPath());
+      }
+      return static_cast<int64_t>(as_double);
+    }
+    default:
+      ThrowTypeMismatch(BSON_TYPE_INT64);
+  }
+}
+
+uint64_t StreamReader::AsUint64() const {
+  const auto value = AsInt64();
+  if (value <= -1) {
+    throw ConversionException(
+        utils::StrCat("Cannot convert to unsigned value from negative value ",
+                      std::to_string(value)),
+        GetPath());
+  }
+  return static_cast<uint64_t>(value);
+}
+
+double StreamReader::AsDouble() const {
+  switch (Type()) {
+    case BSON_TYPE_DOUBLE:
+      return bson_iter_double(&iter_);
+    case BSON_TYPE_INT32:
+      return bson_iter_int32(&iter_);
+    case BSON_TYPE_INT64: {
+      const auto as_int = bson_iter_int64(&iter_);
+      if (as_int == std::numeric_limits<int64_t>::min() ||
+          std::abs(as_int) > kMaxIntDouble) {
+        throw ConversionException(
+            utils::StrCat("Conversion of ", std::to_string(as_int),
+                          " to double causes precision loss"),
+            GetPath());
+      }
+      return static_cast<double>(as_int);
+    }
+    default:
+      ThrowTypeMismatch(BSON_TYPE_DOUBLE);
+  }
+}
+
+std::string_view StreamReader::AsStringView() const {
+  if (!IsString()) ThrowTypeMismatch(BSON_TYPE_UTF8);
+  uint32_t length = 0;
+  const char* data = bson_iter_utf8(&iter_, &length);
+  return {data, length};
+}
+
+std::chrono::system_clock::time_point StreamReader::AsDateTime() const {
+  if (!IsDateTime()) ThrowTypeMismatch(BSON_TYPE_DATE_TIME);
+  return std::chrono::system_clock::time_point(
+      std::chrono::milliseconds(bson_iter_date_time(&iter_)));
+}
+
+Oid StreamReader::AsOid() const {
+  if (!IsOid()) ThrowTypeMismatch(BSON_TYPE_OID);
+  return *bson_iter_oid(&iter_);
+}
+
+Binary StreamReader::AsBinary() const {
+  if (Type() != BSON_TYPE_BINARY) ThrowTypeMismatch(BSON_TYPE_BINARY);
+  bson_subtype_t subtype{};
+  uint32_t length = 0;
+  const uint8_t* data = nullptr;
+  bson_iter_binary(&iter_, &subtype, &length, &data);
+  return Binary(std::string(reinterpret_cast<const char*>(data), length));
+}
+
+Decimal128 StreamReader::AsDecimal128() const {
+  if (Type() != BSON_TYPE_DECIMAL128) ThrowTypeMismatch(BSON_TYPE_DECIMAL128);
+  bson_decimal128_t value{};
+  bson_iter_decimal128(&iter_, &value);
+  return value;
+}
+
+Document StreamReader::AsDocument() const {
+  if (!IsDocument()) ThrowTypeMismatch(BSON_TYPE_DOCUMENT);
+  uint32_t length = 0;
+  const uint8_t* data = nullptr;
+  bson_iter_document(&iter_, &length, &data);
+  return Document(impl::MutableBson(data, length).Extract());
+}
+
+void StreamReader::ThrowTypeMismatch(bson_type_t expected) const {
+  throw TypeMismatchException(Type(), expected, GetPath());
+}
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <userver/formats/bson.hpp>
+#include <userver/formats/bson/stream_reader.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fb = formats::bson;
+
+/// [Sample formats::bson::StreamReader usage]
+namespace my_namespace {
+
+struct Car {
+  std::string model;
+  int age = 0;
+};
+
+struct Driver {
+  std::string name;
+  std::optional<Car> car;
+  std::vector<std::string> classes;
+};
+
+Car Parse(fb::StreamReader& fields, formats::parse::To<Car>) {
+  Car car;
+  while (fields.Next()) {
+    const auto name = fields.GetName();
+    if (name == "model") {
+      car.model = fields.As<std::string>();
+    } else if (name == "age") {
+      car.age = fields.As<int>(0);
+    }
+  }
+  return car;
+}
+
+Driver Parse(fb::StreamReader& fields, formats::parse::To<Driver>) {
+  Driver driver;
+  while (fields.Next()) {
+    const auto name = fields.GetName();
+    if (name == "name") {
+      driver.name = fields.As<std::string>();
+    } else if (name == "car") {
+      driver.car = fields.As<std::optional<Car>>();
+    } else if (name == "classes") {
+      driver.classes = fields.As<std::vector<std::string>>();
+    }
+  }
+  return driver;
+}
+
+}  // namespace my_namespace
+
+TEST(BsonStreamReader, Example) {
+  const auto doc = fb::MakeDoc(
+      "name", "John", "car", fb::MakeDoc("model", "Caddy", "age", 2014),
+      "classes", fb::MakeArray("econom", "minivan"), "ignored", 1.5);
+
+  const auto driver = fb::StreamParse<my_namespace::Driver>(doc);
+  EXPECT_EQ(driver.name, "John");
+  ASSERT_TRUE(driver.car);
+  EXPECT_EQ(driver.car->model, "Caddy");
+  EXPECT_EQ(driver.car->age, 2014);
+  EXPECT_EQ(driver.classes,
+            (std::vector<std::string>{"econom", "minivan"}));
+}
+/// [Sample formats::bson::StreamReader usage]
+
+TEST(BsonStreamReader, Fields) {
+  const auto doc = fb::MakeDoc("null", nullptr, "bool", true, "int", 42,
+                               "double", 1.5, "str", "text");
+
+  fb::StreamReader reader{doc};
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.GetName(), "null");
+  EXPECT_TRUE(reader.IsNull());
+  EXPECT_EQ(reader.As<std::optional<int>>(), std::nullopt);
+  EXPECT_EQ(reader.As<int>(5), 5);
+
+  ASSERT_TRUE(reader.Next());
+  EXPECT_TRUE(reader.As<bool>());
+
+  ASSERT_TRUE(reader.Next());
+  EXPECT_TRUE(reader.IsInt64());
+  EXPECT_EQ(reader.As<int64_t>(), 42);
+  EXPECT_EQ(reader.As<short>(), 42);
+  EXPECT_EQ(reader.As<double>(), 42.0);
+  UEXPECT_THROW(reader.As<std::string>(), fb::TypeMismatchException);
+
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.As<double>(), 1.5);
+  UEXPECT_THROW(reader.As<int>(), fb::ConversionException);
+
+  ASSERT_TRUE(reader.Next());
+  EXPECT_EQ(reader.As<std::string_view>(), "text");
+
+  EXPECT_FALSE(reader.Next());
+}
+
+TEST(BsonStreamReader, Nested) {
+  const auto doc = fb::MakeDoc(
+      "doc", fb::MakeDoc("arr", fb::MakeArray(1, fb::MakeArray(2, 3))));
+
+  fb::StreamReader reader{doc};
+  ASSERT_TRUE(reader.Next());
+  UEXPECT_THROW(reader.As<std::vector<int>>(), fb::TypeMismatchException);
+
+  auto fields = reader.Enter();
+  ASSERT_TRUE(fields.Next());
+  EXPECT_TRUE(fields.IsArray());
+
+  auto elements = fields.Enter();
+  ASSERT_TRUE(elements.Next());
+  EXPECT_EQ(elements.GetName(), "0");
+  EXPECT_EQ(elements.As<int>(), 1);
+  ASSERT_TRUE(elements.Next());
+  EXPECT_EQ(elements.As<std::vector<int>>(), (std::vector<int>{2, 3}));
+  EXPECT_EQ(elements.GetPath(), "doc.arr[1]");
+  EXPECT_FALSE(elements.Next());
+
+  EXPECT_FALSE(fields.Next());
+  EXPECT_FALSE(reader.Next());
+}
+
+TEST(BsonStreamReader, Errors) {
+  const auto doc = fb::MakeDoc("doc", fb::MakeDoc("value", -1));
+
+  fb::StreamReader reader{doc};
+  ASSERT_TRUE(reader.Next());
+  auto fields = reader.Enter();
+  ASSERT_TRUE(fields.Next());
+  UEXPECT_THROW(fields.As<unsigned>(), fb::ConversionException);
+  UEXPECT_THROW(fields.Enter(), fb::TypeMismatchException);
+
+  try {
+    fields.As<bool>();
+    FAIL() << "Exception expected";
+  } catch (const fb::TypeMismatchException& ex) {
+    EXPECT_EQ(ex.GetPath(), "doc.value");
+  }
+}
+
+USERVER_NAMESPACE_END
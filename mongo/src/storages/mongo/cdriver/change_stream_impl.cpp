@@ -0,0 +1,70 @@
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
+
+#include <bson/bson.h>
+#include <mongoc/mongoc.h>
+
+#include <userver/storages/mongo/mongo_error.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::cdriver {
+namespace {
+
+formats::bson::Document CopyDocument(const bson_t* native) {
+  return formats::bson::Document(
+      formats::bson::impl::MutableBson::CopyNative(native).Extract());
+}
+
+}  // namespace
+
+CDriverChangeStreamImpl::CDriverChangeStreamImpl(
+    cdriver::CDriverPoolImpl::BoundClientPtr client,
+    cdriver::ChangeStreamPtr stream,
+    std::shared_ptr<stats::OperationStatisticsItem> watch_stats)
+    : client_(std::move(client)),
+      stream_(std::move(stream)),
+      watch_stats_(std::move(watch_stats)) {
+  UASSERT(client_ && stream_);
+
+  // The initial aggregate is sent on stream creation
+  stats::OperationStopwatch stopwatch(watch_stats_, "watch");
+  MongoError error;
+  if (mongoc_change_stream_error_document(stream_.get(), error.GetNative(),
+                                          nullptr)) {
+    stopwatch.AccountError(error.GetKind());
+    error.Throw("Error opening change stream");
+  }
+  stopwatch.AccountSuccess();
+}
+
+std::optional<formats::bson::Document> CDriverChangeStreamImpl::Next() {
+  stats::OperationStopwatch stopwatch(watch_stats_, "watch");
+  const bson_t* event_bson = nullptr;
+  const bool has_event = mongoc_change_stream_next(stream_.get(), &event_bson);
+
+  MongoError error;
+  if (!has_event && mongoc_change_stream_error_document(
+                        stream_.get(), error.GetNative(), nullptr)) {
+    stopwatch.AccountError(error.GetKind());
+    error.Throw("Error reading change stream");
+  }
+  // Only errors are accounted, empty awaits would distort the timings
+  stopwatch.Discard();
+
+  if (!has_event) return std::nullopt;
+  return CopyDocument(event_bson);
+}
+
+std::optional<formats::bson::Document>
+CDriverChangeStreamImpl::GetResumeToken() const {
+  const bson_t* token = mongoc_change_stream_get_resume_token(stream_.get());
+  if (!token) return std::nullopt;
+  return CopyDocument(token);
+}
+
+}  // namespace storages::mongo::impl::cdriver
+
+USERVER_NAMESPACE_END
@@ -15,6 +15,7 @@
 #include <userver/utils/text.hpp>
 
 #include <formats/bson/wrappers.hpp>
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
@@ -553,6 +554,25 @@ void CDriverCollectionImpl::Execute(const operations::Drop& operation) {
   }
 }
 
+ChangeStream CDriverCollectionImpl::Execute(
+    const operations::Watch& operation) const {
+  auto context = MakeRequestContext("mongo_watch", operation);
+
+  // Change streams inherit read preference from the collection
+  if (operation.impl_->read_prefs) {
+    mongoc_collection_set_read_prefs(context.collection.get(),
+                                     operation.impl_->read_prefs.Get());
+  }
+
+  auto pipeline_doc = operation.impl_->pipeline.GetInternalArrayDocument();
+  impl::cdriver::ChangeStreamPtr cdriver_stream(mongoc_collection_watch(
+      context.collection.get(), pipeline_doc.GetBson().get(),
+      impl::GetNative(operation.impl_->options)));
+  return ChangeStream(std::make_unique<impl::cdriver::CDriverChangeStreamImpl>(
+      std::move(context.client), std::move(cdriver_stream),
+      std::move(context.stats)));
+}
+
 cdriver::CDriverPoolImpl::BoundClientPtr CDriverCollectionImpl::GetClient(
     stats::OperationStatisticsItem& stats) const {
   try {
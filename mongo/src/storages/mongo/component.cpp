@@ -199,6 +199,13 @@ properties:
                 type: boolean
                 description: whether CC is enabled for the database
                 defaultDescription: true
+            algorithm:
+                type: string
+                description: how to compute the limit
+                defaultDescription: linear
+                enum:
+                  - linear
+                  - gradient
 )");
 }
 
@@ -1,8 +1,11 @@
 #include <userver/storages/mongo/operations.hpp>
 
+#include <limits>
+
 #include <mongoc/mongoc.h>
 
 #include <userver/formats/bson/bson_builder.hpp>
+#include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/utils/assert.hpp>
@@ -663,6 +666,51 @@ void Drop::SetOption(const options::WriteConcern& write_concern) {
   AppendWriteConcern(impl::EnsureBuilder(impl_->options), write_concern);
 }
 
+Watch::Watch() : Watch(formats::bson::MakeArray()) {}
+
+Watch::Watch(formats::bson::Value pipeline) : impl_(std::move(pipeline)) {
+  if (!impl_->pipeline.IsArray()) {
+    throw InvalidQueryArgumentException(
+        "Change stream pipeline is not an array");
+  }
+}
+
+Watch::~Watch() = default;
+
+Watch::Watch(const Watch& other) = default;
+Watch::Watch(Watch&&) noexcept = default;
+Watch& Watch::operator=(const Watch& rhs) = default;
+Watch& Watch::operator=(Watch&&) noexcept = default;
+
+void Watch::SetOption(const options::ReadPreference& read_prefs) {
+  impl_->read_prefs = MakeCDriverReadPrefs(read_prefs);
+}
+
+void Watch::SetOption(options::ReadPreference::Mode mode) {
+  impl_->read_prefs = MakeCDriverReadPrefs(mode);
+}
+
+void Watch::SetOption(const options::ResumeAfter& resume_after) {
+  static const std::string kOptionName = "resumeAfter";
+  impl::EnsureBuilder(impl_->options).Append(kOptionName, resume_after.Value());
+}
+
+void Watch::SetOption(options::FullDocumentLookup) {
+  static const std::string kOptionName = "fullDocument";
+  impl::EnsureBuilder(impl_->options).Append(kOptionName, "updateLookup");
+}
+
+void Watch::SetOption(const options::MaxAwaitTime& max_await_time) {
+  static const std::string kOptionName = "maxAwaitTimeMS";
+  const auto value = max_await_time.Value().count();
+  if (value < 0 || value > std::numeric_limits<uint32_t>::max()) {
+    throw InvalidQueryArgumentException("Value ")
+        << value << " of MaxAwaitTime is out of range";
+  }
+  impl::EnsureBuilder(impl_->options)
+      .Append(kOptionName, static_cast<int64_t>(value));
+}
+
 }  // namespace storages::mongo::operations
 
 USERVER_NAMESPACE_END
@@ -174,6 +174,17 @@ class Drop::Impl {
   stats::OperationKey op_key{stats::OpType::kDrop};
 };
 
+class Watch::Impl {
+ public:
+  explicit Impl(formats::bson::Value pipeline_)
+      : pipeline(std::move(pipeline_)) {}
+
+  formats::bson::Value pipeline;
+  impl::cdriver::ReadPrefsPtr read_prefs;
+  stats::OperationKey op_key{stats::OpType::kWatch};
+  std::optional<formats::bson::impl::BsonBuilder> options;
+};
+
 void AppendComment(formats::bson::impl::BsonBuilder& builder,
                    bool& has_comment_option, const options::Comment& comment);
 
@@ -15,21 +15,22 @@ PoolImpl::PoolImpl(std::string&& id, const PoolConfig& static_config,
       config_source_(config_source),
       cc_sensor_(*this),
       cc_limiter_(*this),
-      cc_controller_(id_, cc_sensor_, cc_limiter_,
-                     statistics_.congestion_control, static_config.cc_config,
-                     config_source, [](const dynamic_config::Snapshot& config) {
-                       return config[kCcConfig];
-                     }) {
+      cc_controller_(congestion_control::v2::MakeController(
+          id_, cc_sensor_, cc_limiter_, statistics_.congestion_control,
+          static_config.cc_config, config_source,
+          [](const dynamic_config::Snapshot& config) {
+            return config[kCcConfig];
+          })) {
   config_subscriber_ = config_source_.UpdateAndListen(
       this, "mongo_pool", &PoolImpl::OnConfigUpdate);
 }
 
-void PoolImpl::Start() { cc_controller_.Start(); }
+void PoolImpl::Start() { cc_controller_->Start(); }
 
-void PoolImpl::Stop() { cc_controller_.Stop(); }
+void PoolImpl::Stop() { cc_controller_->Stop(); }
 
 void PoolImpl::OnConfigUpdate(const dynamic_config::Snapshot& config) {
-  cc_controller_.SetEnabled(config[kCongestionControlEnabled]);
+  cc_controller_->SetEnabled(config[kCongestionControlEnabled]);
 }
 
 const std::string& PoolImpl::Id() const { return id_; }
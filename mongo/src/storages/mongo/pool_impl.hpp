@@ -9,7 +9,7 @@
 #include <storages/mongo/congestion_control/sensor.hpp>
 #include <storages/mongo/stats.hpp>
 
-#include <userver/congestion_control/controllers/linear.hpp>
+#include <userver/congestion_control/controllers/factory.hpp>
 #include <userver/storages/mongo/pool_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -53,7 +53,7 @@ class PoolImpl {
   // congestion control stuff
   cc::Sensor cc_sensor_;
   cc::Limiter cc_limiter_;
-  congestion_control::v2::LinearController cc_controller_;
+  std::unique_ptr<congestion_control::v2::Controller> cc_controller_;
 
   // Must be the last field due to fields' RAII destruction order
   concurrent::AsyncEventSubscriberScope config_subscriber_;
@@ -128,13 +128,18 @@ namespace components {
 /// ignore_unused_query_params| disable check for not-NULL query params that are not used in query          | false
 /// monitoring-dbalias      | name of the database for monitorings                                          | calculated from dbalias or dbconnection options
 /// max_prepared_cache_size | prepared statements cache size limit                                          | 200
+/// prepared_statements_warmup | number of the most used statements to prepare on a new connection (0 - disabled) | 0
 /// max_statement_metrics   | limit of exported metrics for named statements                                | 0
 /// min_pool_size           | number of connections created initially                                       | 4
 /// max_pool_size           | maximum number of created connections for "connlimit_mode: manual"            | 15
 /// max_queue_size          | maximum number of clients waiting for a connection                            | 200
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
+/// adaptive_sizing         | grow and shrink the pool between min_pool_size and max_pool_size depending on the acquire and query times | false
 /// connlimit_mode          | max_connections setup mode (manual or auto), also see @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md | auto
 /// error-injection         | artificial error injection settings, error_injection::Settings                | --
+/// congestion_control.fake-mode | whether congestion control only computes the limit without applying it | false
+/// congestion_control.enabled   | whether congestion control is enabled for the database                  | true
+/// congestion_control.algorithm | how to compute the limit: `linear` (congestion_control::v2::LinearController) or `gradient` (congestion_control::v2::GradientController) | linear
 
 // clang-format on
 
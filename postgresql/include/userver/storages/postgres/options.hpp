@@ -187,10 +187,15 @@ struct PoolSettings {
   /// Limits number of concurrent establishing connections (0 - unlimited)
   std::size_t connecting_limit{kDefaultConnectingLimit};
 
+  /// Grow and shrink the pool between min_size and max_size depending on the
+  /// observed acquire and query times
+  bool adaptive_sizing{false};
+
   bool operator==(const PoolSettings& rhs) const {
     return min_size == rhs.min_size && max_size == rhs.max_size &&
            max_queue_size == rhs.max_queue_size &&
-           connecting_limit == rhs.connecting_limit;
+           connecting_limit == rhs.connecting_limit &&
+           adaptive_sizing == rhs.adaptive_sizing;
   }
 };
 
@@ -243,6 +248,10 @@ struct ConnectionSettings {
   /// Limits the size or prepared statements cache
   std::size_t max_prepared_cache_size = kDefaultMaxPreparedCacheSize;
 
+  /// Number of the pool's most used statements to prepare on a new connection
+  /// (0 - disabled)
+  std::size_t prepared_statements_warmup = 0;
+
   /// Turns on connection pipeline mode
   PipelineMode pipeline_mode = PipelineMode::kDisabled;
 
@@ -264,7 +273,8 @@ struct ConnectionSettings {
 
   bool operator==(const ConnectionSettings& rhs) const {
     return !RequiresConnectionReset(rhs) &&
-           recent_errors_threshold == rhs.recent_errors_threshold;
+           recent_errors_threshold == rhs.recent_errors_threshold &&
+           prepared_statements_warmup == rhs.prepared_statements_warmup;
   }
 
   bool operator!=(const ConnectionSettings& rhs) const {
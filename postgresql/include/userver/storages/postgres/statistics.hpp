@@ -3,6 +3,7 @@
 /// @file userver/storages/postgres/statistics.hpp
 /// @brief Statistics helpers
 
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 
@@ -133,6 +134,14 @@ using InstanceStatistics = InstanceStatisticsTemplate<
     USERVER_NAMESPACE::utils::statistics::RecentPeriod<
         MinMaxAvg, MinMaxAvg, detail::SteadyCoarseClock>>;
 
+/// @brief Prepared statements cache usage of a named query
+struct PreparedStatementCacheStatistics {
+  /// Executions of the statement already prepared on the connection
+  std::uint64_t hits{0};
+  /// Executions that had to prepare the statement
+  std::uint64_t misses{0};
+};
+
 using InstanceStatisticsNonatomicBase =
     InstanceStatisticsTemplate<uint32_t, Percentile, MinMaxAvg>;
 
@@ -208,7 +217,21 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     return *this;
   }
 
+  InstanceStatisticsNonatomic& Add(
+      const std::unordered_map<std::string, PreparedStatementCacheStatistics>&
+          prepared_cache) {
+    for (const auto& [name, cache_stats] : prepared_cache) {
+      auto& total = prepared_statements_cache[name];
+      total.hits += cache_stats.hits;
+      total.misses += cache_stats.misses;
+    }
+
+    return *this;
+  }
+
   std::unordered_map<std::string, Percentile> statement_timings;
+  std::unordered_map<std::string, PreparedStatementCacheStatistics>
+      prepared_statements_cache;
 };
 
 /// @brief Instance statistics with description
@@ -231,6 +254,11 @@ struct ClusterStatistics {
   std::vector<InstanceStatsDescriptor> unknown;
 };
 
+/// @brief PreparedStatementCacheStatistics values support for
+/// utils::statistics::Writer
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const PreparedStatementCacheStatistics& value);
+
 // InstanceStatisticsNonatomic values support for utils::statistics::Writer
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                 const InstanceStatisticsNonatomic& stats);
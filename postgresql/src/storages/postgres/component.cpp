@@ -89,6 +89,9 @@ Postgres::Postgres(const ComponentConfig& config,
   initial_settings_.db_name = db_name_;
   initial_settings_.connlimit_mode =
       ParseConnlimitMode(config["connlimit_mode"].As<std::string>("auto"));
+  initial_settings_.cc_config =
+      config["congestion_control"]
+          .As<congestion_control::v2::LinearController::StaticConfig>();
 
   initial_settings_.topology_settings.max_replication_lag =
       config["max_replication_lag"].As<std::chrono::milliseconds>(
@@ -281,6 +284,10 @@ properties:
         type: integer
         description: prepared statements cache size limit
         defaultDescription: 5000
+    prepared_statements_warmup:
+        type: integer
+        description: number of the most used statements to prepare on a new connection (0 - disabled)
+        defaultDescription: 0
     max_statement_metrics:
         type: integer
         description: limit of exported metrics for named statements
@@ -322,12 +329,36 @@ properties:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
         defaultDescription: 0
+    adaptive_sizing:
+        type: boolean
+        description: grow and shrink the pool between min_pool_size and max_pool_size depending on the acquire and query times
+        defaultDescription: false
     connlimit_mode:
         type: string
         enum:
          - auto
          - manual
         description: how to learn the `max_pool_size`
+    congestion_control:
+        description: congestion control settings
+        type: object
+        additionalProperties: false
+        properties:
+            fake-mode:
+                type: boolean
+                description: whether CC limiter is actually working
+                defaultDescription: false
+            enabled:
+                type: boolean
+                description: whether CC is enabled for the database
+                defaultDescription: true
+            algorithm:
+                type: string
+                description: how to compute the limit
+                defaultDescription: linear
+                enum:
+                  - linear
+                  - gradient
 )");
 }
 
@@ -1,11 +1,17 @@
 #include <storages/postgres/congestion_control/sensor.hpp>
 
+#include <chrono>
+
 #include <storages/postgres/detail/pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres::cc {
 
+namespace {
+constexpr std::chrono::seconds kTimingsPeriod{1};
+}  // namespace
+
 Sensor::Sensor(detail::ConnectionPool& pool) : pool_(pool) {}
 
 Sensor::Data Sensor::GetCurrent() {
@@ -23,8 +29,14 @@ Sensor::Data Sensor::GetCurrent() {
   auto timeout_rate = static_cast<double>(diff_timeouts) / diff_total;
   LOG_DEBUG() << "timeout rate = " << timeout_rate;
 
-  auto current_limit = stats.connection.maximum;
-  return {diff_total, diff_timeouts, current_limit};
+  // Median is more stable than an average against rare long transactions
+  const auto timings_ms = stats.transaction.busy_percentile
+                              .GetStatsForPeriod(kTimingsPeriod, true)
+                              .GetPercentile(50);
+  LOG_DEBUG() << "timings median = " << timings_ms << "ms";
+
+  const auto current_load = stats.connection.used.Load();
+  return {diff_total, diff_timeouts, timings_ms, current_load};
 }
 
 }  // namespace storages::postgres::cc
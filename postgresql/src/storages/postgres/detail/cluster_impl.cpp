@@ -145,6 +145,9 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     cluster_stats->master.stats.Add(host_pools_[dsn_index]
                                         ->GetStatementTimingsStorage()
                                         .GetTimingsPercentiles());
+    cluster_stats->master.stats.Add(host_pools_[dsn_index]
+                                        ->GetPreparedStatementsRegistry()
+                                        .GetStatistics());
     is_host_pool_seen[dsn_index] = 1;
   }
 
@@ -162,6 +165,9 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     cluster_stats->sync_slave.stats.Add(host_pools_[dsn_index]
                                             ->GetStatementTimingsStorage()
                                             .GetTimingsPercentiles());
+    cluster_stats->sync_slave.stats.Add(host_pools_[dsn_index]
+                                            ->GetPreparedStatementsRegistry()
+                                            .GetStatistics());
     is_host_pool_seen[dsn_index] = 1;
   }
 
@@ -183,6 +189,9 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
       slave_desc.stats.Add(host_pools_[dsn_index]
                                ->GetStatementTimingsStorage()
                                .GetTimingsPercentiles());
+      slave_desc.stats.Add(host_pools_[dsn_index]
+                               ->GetPreparedStatementsRegistry()
+                               .GetStatistics());
       is_host_pool_seen[dsn_index] = 1;
     }
   }
@@ -197,6 +206,8 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
     desc.stats.Add(host_pools_[i]->GetStatistics(), dsn_stats[i]);
     desc.stats.Add(
         host_pools_[i]->GetStatementTimingsStorage().GetTimingsPercentiles());
+    desc.stats.Add(
+        host_pools_[i]->GetPreparedStatementsRegistry().GetStatistics());
 
     cluster_stats->unknown.push_back(std::move(desc));
   }
@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <string>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -38,6 +39,7 @@ enum class ConnectionState {
 namespace detail {
 
 class ConnectionImpl;
+class PreparedStatementsRegistry;
 
 /// @brief PostreSQL connection class
 /// Handles connecting to Postgres, sending commands, processing command results
@@ -130,6 +132,7 @@ class Connection {
   /// @param testsuite_pg_ctl operation parameters customizer for testsuite
   /// @param ei_settings error injection settings
   /// @param size_guard structure to track the size of owning connection pool
+  /// @param prepared_registry pool-wide registry of the most used statements
   /// @throws ConnectionFailed, ConnectionTimeoutError
   // clang-format on
   static std::unique_ptr<Connection> Connect(
@@ -140,7 +143,8 @@ class Connection {
       const DefaultCommandControls& default_cmd_ctls,
       const testsuite::PostgresControl& testsuite_pg_ctl,
       const error_injection::Settings& ei_settings,
-      engine::SemaphoreLock&& size_lock = engine::SemaphoreLock{});
+      engine::SemaphoreLock&& size_lock = engine::SemaphoreLock{},
+      std::shared_ptr<PreparedStatementsRegistry> prepared_registry = {});
 
   /// Close the connection
   /// TODO When called from another thread/coroutine will wait for current
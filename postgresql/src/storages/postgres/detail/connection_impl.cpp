@@ -37,6 +37,8 @@ constexpr std::string_view kStatementVacuum = "vacuum";
 constexpr std::string_view kStatementListen = "listen {}";
 constexpr std::string_view kStatementUnlisten = "unlisten {}";
 
+constexpr std::chrono::seconds kPreparedStatementsUsageFlushInterval{1};
+
 const Query kSetConfigQuery{fmt::format("SELECT set_config($1, $2, $3) as {}",
                                         kSetConfigQueryResultName)};
 
@@ -51,6 +53,11 @@ std::size_t QueryHash(const std::string& statement,
   return res;
 }
 
+std::string MakeStatementName(std::size_t query_hash,
+                              const std::string& connection_uuid) {
+  return "q" + std::to_string(query_hash) + "_" + connection_uuid;
+}
+
 class CountExecute {
  public:
   CountExecute(Connection::Statistics& stats) : stats_(stats) {
@@ -186,11 +193,13 @@ ConnectionImpl::ConnectionImpl(
     ConnectionSettings settings, const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     const error_injection::Settings& ei_settings,
-    engine::SemaphoreLock&& size_lock)
+    engine::SemaphoreLock&& size_lock,
+    std::shared_ptr<PreparedStatementsRegistry> prepared_registry)
     : uuid_{USERVER_NAMESPACE::utils::generators::GenerateUuid()},
       conn_wrapper_{bg_task_processor, bg_task_storage, id,
                     std::move(size_lock)},
       prepared_{settings.max_prepared_cache_size},
+      prepared_registry_{std::move(prepared_registry)},
       settings_{settings},
       default_cmd_ctls_(default_cmd_ctls),
       testsuite_pg_ctl_{testsuite_pg_ctl},
@@ -217,6 +226,8 @@ ConnectionImpl::ConnectionImpl(
   }
 }
 
+ConnectionImpl::~ConnectionImpl() { FlushPreparedStatementsUsage(); }
+
 void ConnectionImpl::AsyncConnect(const Dsn& dsn, engine::Deadline deadline) {
   tracing::Span span{scopes::kConnect};
   auto scope = span.CreateScopeTime();
@@ -240,6 +251,7 @@ void ConnectionImpl::AsyncConnect(const Dsn& dsn, engine::Deadline deadline) {
   if (settings_.user_types != ConnectionSettings::kPredefinedTypesOnly) {
     LoadUserTypes(deadline);
   }
+  WarmupPreparedStatements(deadline);
   if (settings_.pipeline_mode == PipelineMode::kEnabled) {
     conn_wrapper_.EnterPipelineMode();
   }
@@ -356,6 +368,12 @@ Connection::Statistics ConnectionImpl::GetStatsAndReset() {
   UASSERT_MSG(!IsInTransaction(),
               "GetStatsAndReset should be called outside of transaction");
   stats_.prepared_statements_current = prepared_.GetSize();
+  // The registry is shared by the pool connections, so the executions are
+  // added to it in batches rather than on every query
+  if (SteadyNow() - prepared_usage_flushed_at_ >=
+      kPreparedStatementsUsageFlushInterval) {
+    FlushPreparedStatementsUsage();
+  }
   return std::exchange(stats_, Connection::Statistics{});
 }
 
@@ -745,8 +763,7 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
   scope.Reset(scopes::kPrepare);
   LOG_TRACE() << "Query " << statement << " is not yet prepared";
 
-  const std::string statement_name =
-      "q" + std::to_string(query_hash) + "_" + uuid_;
+  const std::string statement_name = MakeStatementName(query_hash, uuid_);
   bool should_prepare = !statement_info;
   if (should_prepare) {
     conn_wrapper_.SendPrepare(statement_name, statement, params, scope);
@@ -801,6 +818,97 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
   return *statement_info;
 }
 
+void ConnectionImpl::WarmupPreparedStatements(engine::Deadline deadline) {
+  if (!prepared_registry_ || !ArePreparedStatementsEnabled()) return;
+
+  const auto statements = prepared_registry_->GetHotStatements(std::min(
+      settings_.prepared_statements_warmup, settings_.max_prepared_cache_size));
+  if (statements.empty()) return;
+
+  LOG_DEBUG() << "Preparing " << statements.size() << " most used statements";
+  tracing::Span span{scopes::kPrepareWarmup};
+  auto scope = span.CreateScopeTime();
+
+#if LIBPQ_HAS_PIPELINING
+  // Pipelining may be disabled at runtime, e.g. for a pooler in front of the
+  // server that does not support it
+  if (settings_.pipeline_mode == PipelineMode::kEnabled) {
+    WarmupPreparedStatementsPipelined(statements, deadline, scope);
+    return;
+  }
+#endif
+  for (const auto& statement : statements) {
+    try {
+      DoPrepareStatement(statement->GetStatement(), QueryParameters{*statement},
+                         deadline, span, scope);
+    } catch (const std::exception& e) {
+      if (IsBroken() || !IsConnected()) throw;
+      LOG_LIMITED_WARNING() << "Failed to prepare statement: " << e;
+    }
+  }
+}
+
+#if LIBPQ_HAS_PIPELINING
+void ConnectionImpl::WarmupPreparedStatementsPipelined(
+    const std::vector<PreparedStatementsRegistry::StatementPtr>& statements,
+    engine::Deadline deadline, tracing::ScopeTime& scope) {
+  std::vector<PGConnectionWrapper::PrepareRequest> requests;
+  std::vector<std::size_t> hashes;
+  requests.reserve(statements.size());
+  hashes.reserve(statements.size());
+  for (const auto& statement : statements) {
+    const QueryParameters params{*statement};
+    hashes.push_back(QueryHash(statement->GetStatement(), params));
+    requests.push_back({MakeStatementName(hashes.back(), uuid_),
+                        statement->GetStatement(), params});
+  }
+
+  auto descriptions = conn_wrapper_.PrepareBatch(requests, deadline, scope);
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    auto& description = descriptions[i];
+    if (!description.pimpl_) continue;
+    try {
+      FillBufferCategories(description);
+      description.GetRowDescription().CheckBinaryFormat(db_types_);
+    } catch (const std::exception& e) {
+      // Will be described again on the first use
+      LOG_LIMITED_WARNING() << "Failed to describe prepared statement: " << e;
+      continue;
+    }
+    const Connection::StatementId query_id{hashes[i]};
+    prepared_.Put(query_id, {query_id, requests[i].statement,
+                             std::move(requests[i].name),
+                             std::move(description)});
+    ++stats_.parse_total;
+  }
+}
+#endif
+
+void ConnectionImpl::AccountPreparedStatement(const Query& query,
+                                              const QueryParameters& params,
+                                              const PreparedStatementInfo& info,
+                                              bool cache_hit) {
+  if (!prepared_registry_) return;
+  const auto query_hash = info.id.GetUnderlying();
+  auto it = prepared_usage_.find(query_hash);
+  if (it == prepared_usage_.end()) {
+    auto entry = prepared_registry_->GetOrRegister(
+        query_hash, query.Statement(), params, query.GetName());
+    if (!entry) return;
+    it = prepared_usage_.emplace(query_hash, PreparedStatementUsage{entry})
+             .first;
+  }
+  ++(cache_hit ? it->second.hits : it->second.misses);
+}
+
+void ConnectionImpl::FlushPreparedStatementsUsage() {
+  for (auto& [query_hash, usage] : prepared_usage_) {
+    usage.entry->Account(std::exchange(usage.hits, 0),
+                         std::exchange(usage.misses, 0));
+  }
+  prepared_usage_flushed_at_ = SteadyNow();
+}
+
 void ConnectionImpl::DiscardOldPreparedStatements(engine::Deadline deadline) {
   // do not try to do anything in transaction as it may already be broken
   if (is_discard_prepared_pending_ && !IsInTransaction()) {
@@ -850,8 +958,11 @@ ResultSet ConnectionImpl::ExecuteCommand(const Query& query,
   auto scope = span.CreateScopeTime();
   CountExecute count_execute(stats_);
 
+  const auto parse_total = stats_.parse_total;
   auto const& prepared_info =
       DoPrepareStatement(statement, params, deadline, span, scope);
+  AccountPreparedStatement(query, params, prepared_info,
+                           parse_total == stats_.parse_total);
 
   const ResultSet* description_ptr_to_read = nullptr;
   PGresult* description_ptr_to_send = nullptr;
@@ -880,7 +991,12 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::PrepareStatement(
   span.AddTag(tracing::kDatabaseStatement, statement);
 
   auto scope = span.CreateScopeTime();
-  return DoPrepareStatement(statement, params, deadline, span, scope);
+  const auto parse_total = stats_.parse_total;
+  const auto& prepared_info =
+      DoPrepareStatement(statement, params, deadline, span, scope);
+  AccountPreparedStatement(query, params, prepared_info,
+                           parse_total == stats_.parse_total);
+  return prepared_info;
 }
 
 void ConnectionImpl::AddIntoPipeline(CommandControl cc,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -20,6 +21,7 @@
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_connection_wrapper.hpp>
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/options.hpp>
@@ -45,7 +47,9 @@ class ConnectionImpl {
                  const DefaultCommandControls& default_cmd_ctls,
                  const testsuite::PostgresControl& testsuite_pg_ctl,
                  const error_injection::Settings& ei_settings,
-                 engine::SemaphoreLock&& size_lock);
+                 engine::SemaphoreLock&& size_lock,
+                 std::shared_ptr<PreparedStatementsRegistry> prepared_registry);
+  ~ConnectionImpl();
 
   void AsyncConnect(const Dsn& dsn, engine::Deadline deadline);
   void Close();
@@ -154,6 +158,15 @@ class ConnectionImpl {
       const std::string& statement, const detail::QueryParameters& params,
       engine::Deadline deadline, tracing::Span& span,
       tracing::ScopeTime& scope);
+  void WarmupPreparedStatements(engine::Deadline deadline);
+  void WarmupPreparedStatementsPipelined(
+      const std::vector<PreparedStatementsRegistry::StatementPtr>& statements,
+      engine::Deadline deadline, tracing::ScopeTime& scope);
+  void AccountPreparedStatement(const Query& query,
+                                const detail::QueryParameters& params,
+                                const PreparedStatementInfo& info,
+                                bool cache_hit);
+  void FlushPreparedStatementsUsage();
   void DiscardOldPreparedStatements(engine::Deadline deadline);
   void DiscardPreparedStatement(const PreparedStatementInfo& info,
                                 engine::Deadline deadline);
@@ -199,6 +212,15 @@ class ConnectionImpl {
   Connection::Statistics stats_;
   PGConnectionWrapper conn_wrapper_;
   PreparedStatements prepared_;
+  std::shared_ptr<PreparedStatementsRegistry> prepared_registry_;
+  // Executions of the registered statements not yet added to the registry
+  struct PreparedStatementUsage {
+    PreparedStatementsRegistry::EntryPtr entry;
+    std::uint64_t hits{0};
+    std::uint64_t misses{0};
+  };
+  std::unordered_map<std::size_t, PreparedStatementUsage> prepared_usage_;
+  std::chrono::steady_clock::time_point prepared_usage_flushed_at_;
   UserTypes db_types_;
   bool is_in_recovery_ = true;
   bool is_read_only_ = true;
@@ -647,6 +647,80 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
 #endif
 }
 
+std::vector<ResultSet> PGConnectionWrapper::PrepareBatch(
+    [[maybe_unused]] const std::vector<PrepareRequest>& requests,
+    [[maybe_unused]] Deadline deadline,
+    [[maybe_unused]] tracing::ScopeTime& scope) {
+#if !LIBPQ_HAS_PIPELINING
+  UINVARIANT(false, "Batch prepare requires pipelining to be enabled");
+#else
+  const auto enter_pipeline = !IsPipelineActive();
+  if (enter_pipeline) EnterPipelineMode();
+
+  for (const auto& request : requests) {
+    SendPrepare(request.name, request.statement, request.params, scope);
+    SendDescribePrepared(request.name, scope);
+    HandleSocketPostClose();
+    CheckError<CommandError>("PQpipelineSync", PQpipelineSync(conn_));
+    ++pipeline_sync_counter_;
+  }
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+
+  std::vector<ResultSet> result;
+  result.reserve(requests.size());
+  // Prepare result comes first and is overwritten by the description
+  auto description = MakeResultHandle(nullptr);
+  auto failed = false;
+  auto null_res_counter{0};
+  while (IsSyncingPipeline() && PQstatus(conn_) != CONNECTION_BAD) {
+    auto* pg_res = ReadResult(deadline, nullptr);
+    if (!pg_res) {
+      // Same issue as with WaitResult
+      if (++null_res_counter > 2) {
+        MarkAsBroken();
+        pipeline_sync_counter_ = 0;
+      }
+      continue;
+    }
+    null_res_counter = 0;
+
+    auto handle = MakeResultHandle(pg_res);
+    switch (PQresultStatus(pg_res)) {
+      case PGRES_PIPELINE_SYNC:
+        HandlePipelineSync();
+        // The last sync is put by Flush
+        if (result.size() < requests.size()) {
+          result.push_back(failed || !description
+                               ? ResultSet{nullptr}
+                               : MakeResult(std::move(description)));
+          description = MakeResultHandle(nullptr);
+          failed = false;
+        }
+        break;
+      case PGRES_PIPELINE_ABORTED:
+        break;
+      case PGRES_COMMAND_OK:
+        description = std::move(handle);
+        break;
+      default:
+        PGCW_LOG_LIMITED_WARNING()
+            << "Failed to prepare statement `"
+            << requests[std::min(result.size(), requests.size() - 1)].name
+            << "`: " << PQresultErrorMessage(pg_res);
+        failed = true;
+        break;
+    }
+  }
+
+  if (PQstatus(conn_) == CONNECTION_BAD || result.size() < requests.size()) {
+    throw ConnectionError{"Connection lost while preparing statements"};
+  }
+  if (enter_pipeline) ExitPipelineMode();
+  return result;
+#endif
+}
+
 void PGConnectionWrapper::DiscardInput(Deadline deadline) {
   Flush(deadline);
   auto handle = MakeResultHandle(nullptr);
@@ -31,6 +31,12 @@ class PGConnectionWrapper {
   using Duration = Deadline::TimePoint::clock::duration;
   using ResultHandle = detail::ResultWrapper::ResultHandle;
 
+  struct PrepareRequest {
+    std::string name;
+    const std::string& statement;
+    QueryParameters params;
+  };
+
   PGConnectionWrapper(engine::TaskProcessor& tp,
                       concurrent::BackgroundTaskStorageCore& bts, uint32_t id,
                       engine::SemaphoreLock&& pool_size_lock);
@@ -117,6 +123,18 @@ class PGConnectionWrapper {
   std::vector<ResultSet> GatherPipeline(
       Deadline deadline, const std::vector<const PGresult*>& descriptions);
 
+  /// @brief Prepares and describes the statements in a single pipeline.
+  ///
+  /// Every statement is followed by its own sync point, so a failed statement
+  /// does not abort the rest of the batch.
+  ///
+  /// Requires libpq >= 14.
+  /// @returns descriptions of the statements, null result sets for the
+  /// statements that failed to prepare
+  std::vector<ResultSet> PrepareBatch(
+      const std::vector<PrepareRequest>& requests, Deadline deadline,
+      tracing::ScopeTime&);
+
   /// Consume input from connection
   void ConsumeInput(Deadline deadline, const PGresult* description);
 
@@ -36,12 +36,24 @@ constexpr std::chrono::seconds kMaintainInterval{30};
 constexpr std::chrono::seconds kMaxIdleDuration{15};
 constexpr const char* kMaintainTaskName = "pg_maintain";
 
+constexpr std::chrono::seconds kAdaptiveInterval{1};
+constexpr std::chrono::seconds kAdaptiveStatsPeriod{5};
+constexpr const char* kAdaptiveTaskName = "pg_adaptive_size";
+// Percentile of acquire and query times the pool size is adjusted by
+constexpr double kAdaptivePercentile = 95;
+// Max idle connections above the target that can be closed in one run of
+// adaptive sizing task
+constexpr auto kAdaptiveDropLimit = 1;
+
 constexpr std::chrono::seconds kConnectingTimeout{2};
 constexpr auto kPendingConnectsMax{1};
 
 // Max idle connections that can be dropped in one run of maintenance task
 constexpr auto kIdleDropLimit = 1;
 
+// Max statements tracked for warmup and cache hit statistics
+constexpr std::size_t kMaxRegisteredStatements = 1000;
+
 // Practically unlimited number on concurrent establishing connections
 constexpr auto kUnlimitedConnecting = std::numeric_limits<std::size_t>::max();
 
@@ -95,16 +107,19 @@ ConnectionPool::ConnectionPool(
       cancel_limit_{std::max(std::size_t{1}, settings.max_size / kCancelRatio),
                     {1, kCancelPeriod}},
       sts_{statement_metrics_settings},
+      prepared_registry_{std::make_shared<PreparedStatementsRegistry>(
+          kMaxRegisteredStatements)},
       config_source_(config_source),
       cc_sensor_(*this),
       cc_limiter_(*this),
-      cc_controller_("postgres" + db_name, cc_sensor_, cc_limiter_,
-                     stats_.congestion_control, cc_config, config_source,
-                     [](const dynamic_config::Snapshot& config) {
-                       return config[kCcConfig];
-                     }) {
+      cc_controller_(congestion_control::v2::MakeController(
+          "postgres" + db_name, cc_sensor_, cc_limiter_,
+          stats_.congestion_control, cc_config, config_source,
+          [](const dynamic_config::Snapshot& config) {
+            return config[kCcConfig];
+          })) {
   if (kCcExperiment.IsEnabled()) {
-    cc_controller_.Start();
+    cc_controller_->Start();
   }
 }
 
@@ -357,10 +372,22 @@ void ConnectionPool::SetSettings(const PoolSettings& settings) {
                                           ? settings.connecting_limit
                                           : kUnlimitedConnecting);
 
+  const bool adaptive_sizing_changed =
+      reader->adaptive_sizing != settings.adaptive_sizing;
+
   auto writer = settings_.StartWrite();
   *writer = settings;
   writer->max_size = max_connections;
   writer.Commit();
+
+  // The maintenance tasks are started after the pool initialization
+  if (adaptive_sizing_changed && ping_task_.IsRunning()) {
+    if (settings.adaptive_sizing) {
+      StartAdaptiveTask();
+    } else {
+      StopAdaptiveTask();
+    }
+  }
 }
 
 void ConnectionPool::SetConnectionSettings(const ConnectionSettings& settings) {
@@ -417,7 +444,7 @@ bool ConnectionPool::DoConnect(engine::SemaphoreLock size_lock) {
     connection = Connection::Connect(
         dsn_, resolver_, bg_task_processor_, close_task_storage_, conn_id,
         *conn_settings, default_cmd_ctls_, testsuite_pg_ctl_, ei_settings_,
-        std::move(size_lock));
+        std::move(size_lock), prepared_registry_);
   } catch (const ConnectionTimeoutError&) {
     // No problem if it's connection error
     ++stats_.connection.error_timeout;
@@ -662,7 +689,8 @@ void ConnectionPool::MaintainConnections() {
         break;
       }
       stale_connection = conn->GetIdleDuration() >= kMaxIdleDuration;
-      if (count > settings->min_size && drop_left > 0) {
+      if (count > std::max(settings->min_size, adaptive_target_.load()) &&
+          drop_left > 0) {
         --drop_left;
         --stats_.connection.used;
         LOG_DEBUG() << "Drop idle connection to `" << DsnCutPassword(dsn_)
@@ -690,14 +718,95 @@ void ConnectionPool::MaintainConnections() {
   CheckMinPoolSizeUnderflow();
 }
 
+void ConnectionPool::AdaptPoolSize() {
+  auto settings = settings_.Read();
+  if (!settings->adaptive_sizing) {
+    adaptive_target_ = 0;
+    return;
+  }
+
+  PoolSizeController::Sample sample;
+  sample.used = stats_.connection.used.Load();
+  sample.waiting = wait_count_.load(std::memory_order_relaxed);
+  sample.acquire_time = std::chrono::milliseconds{
+      stats_.acquire_percentile.GetStatsForPeriod(kAdaptiveStatsPeriod, true)
+          .GetPercentile(kAdaptivePercentile)};
+  sample.query_time = std::chrono::milliseconds{
+      stats_.transaction.busy_percentile
+          .GetStatsForPeriod(kAdaptiveStatsPeriod, true)
+          .GetPercentile(kAdaptivePercentile)};
+
+  // settings->max_size is already limited by the server max_connections
+  const auto target =
+      size_controller_.Update(sample, settings->min_size, settings->max_size);
+  const auto prev_target = adaptive_target_.exchange(target);
+  if (target != prev_target) {
+    LOG_DEBUG() << "Adaptive pool size target for `" << DsnCutPassword(dsn_)
+                << "` changed from " << prev_target << " to " << target;
+  }
+
+  auto count = size_semaphore_.UsedApprox();
+  if (count < target) {
+    auto conn_settings = conn_settings_.Read();
+    if (recent_conn_errors_.GetStatsForPeriod(kRecentErrorPeriod, true) >=
+        conn_settings->recent_errors_threshold) {
+      LOG_DEBUG() << "Too many connection errors in recent period";
+      return;
+    }
+    // New connections queue up on connecting_semaphore_, so the growth
+    // does not turn into a connection storm
+    for (; count < target; ++count) {
+      engine::SemaphoreLock size_lock{size_semaphore_, std::try_to_lock};
+      if (!size_lock) break;
+      connect_task_storage_.Detach(Connect(std::move(size_lock)));
+    }
+    return;
+  }
+
+  // Close the surplus gradually, busy connections are left alone
+  for (auto drop_left = kAdaptiveDropLimit; count > target && drop_left > 0;
+       --count, --drop_left) {
+    Connection* connection = nullptr;
+    if (!queue_.pop(connection)) break;
+    LOG_DEBUG() << "Drop surplus idle connection to `" << DsnCutPassword(dsn_)
+                << '`';
+    try {
+      connection->Close();
+    } catch (const RuntimeError& e) {
+      LOG_LIMITED_WARNING() << "Exception while closing connection to `"
+                            << DsnCutPassword(dsn_) << "`: " << e;
+    }
+    DeleteConnection(connection);
+  }
+}
+
 void ConnectionPool::StartMaintainTask() {
   using Flags = USERVER_NAMESPACE::utils::PeriodicTask::Flags;
 
   ping_task_.Start(kMaintainTaskName, {kMaintainInterval, Flags::kStrong},
                    [this] { MaintainConnections(); });
+  const auto settings = settings_.Read();
+  if (settings->adaptive_sizing) StartAdaptiveTask();
 }
 
-void ConnectionPool::StopMaintainTask() { ping_task_.Stop(); }
+void ConnectionPool::StopMaintainTask() {
+  StopAdaptiveTask();
+  ping_task_.Stop();
+}
+
+void ConnectionPool::StartAdaptiveTask() {
+  using Flags = USERVER_NAMESPACE::utils::PeriodicTask::Flags;
+
+  // The task is not running, the state left from the previous run is stale
+  size_controller_ = {};
+  adaptive_task_.Start(kAdaptiveTaskName, {kAdaptiveInterval, Flags::kStrong},
+                       [this] { AdaptPoolSize(); });
+}
+
+void ConnectionPool::StopAdaptiveTask() {
+  adaptive_task_.Stop();
+  adaptive_target_ = 0;
+}
 
 void ConnectionPool::StopConnectTasks() {
   const auto task_count = connect_task_storage_.ActiveTasksApprox();
@@ -23,7 +23,7 @@
 #include <storages/postgres/congestion_control/limiter.hpp>
 #include <storages/postgres/congestion_control/sensor.hpp>
 #include <storages/postgres/default_command_controls.hpp>
-#include <userver/congestion_control/controllers/linear.hpp>
+#include <userver/congestion_control/controllers/factory.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/non_transaction.hpp>
 #include <userver/storages/postgres/notify.hpp>
@@ -33,6 +33,8 @@
 
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/pool_size_controller.hpp>
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
 #include <storages/postgres/detail/statement_timings_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -92,6 +94,10 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
     return sts_;
   }
 
+  const PreparedStatementsRegistry& GetPreparedStatementsRegistry() const {
+    return *prepared_registry_;
+  }
+
   void SetMaxConnectionsCc(std::size_t max_connections);
 
   dynamic_config::Source GetConfigSource() const;
@@ -124,8 +130,11 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 
   Connection* AcquireImmediate();
   void MaintainConnections();
+  void AdaptPoolSize();
   void StartMaintainTask();
   void StopMaintainTask();
+  void StartAdaptiveTask();
+  void StopAdaptiveTask();
   void StopConnectTasks();
 
   void CheckUserTypes();
@@ -143,6 +152,12 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   concurrent::BackgroundTaskStorageCore connect_task_storage_;
   concurrent::BackgroundTaskStorageCore close_task_storage_;
   USERVER_NAMESPACE::utils::PeriodicTask ping_task_;
+  // Runs only while adaptive sizing is enabled
+  USERVER_NAMESPACE::utils::PeriodicTask adaptive_task_;
+  // Accessed only from adaptive_task_
+  PoolSizeController size_controller_;
+  // Zero if adaptive sizing is disabled
+  std::atomic<std::size_t> adaptive_target_{0};
   engine::Mutex wait_mutex_;
   engine::ConditionVariable conn_available_;
   boost::lockfree::queue<Connection*> queue_;
@@ -155,12 +170,13 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   RecentCounter recent_conn_errors_;
   USERVER_NAMESPACE::utils::TokenBucket cancel_limit_;
   detail::StatementTimingsStorage sts_;
+  std::shared_ptr<PreparedStatementsRegistry> prepared_registry_;
   dynamic_config::Source config_source_;
 
   // Congestion control stuff
   cc::Sensor cc_sensor_;
   cc::Limiter cc_limiter_;
-  congestion_control::v2::LinearController cc_controller_;
+  std::unique_ptr<congestion_control::v2::Controller> cc_controller_;
   std::atomic<std::size_t> cc_max_connections_;
 };
 
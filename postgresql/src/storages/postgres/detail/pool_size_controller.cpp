@@ -0,0 +1,93 @@
+#include <storages/postgres/detail/pool_size_controller.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Acquire time that means the pool lacks connections
+constexpr std::chrono::milliseconds kGrowAcquireTime{5};
+
+// Growth step is 1/kGrowDivisor of the current target, but at least one
+constexpr std::size_t kGrowDivisor = 4;
+
+// The pool is underutilized if the demand is below 3/4 of the target
+constexpr std::size_t kUtilizationNumerator = 3;
+constexpr std::size_t kUtilizationDenominator = 4;
+
+// Shrink only after that many consecutive underutilized samples
+constexpr std::size_t kShrinkStreak = 10;
+
+// Shrink step is 1/kShrinkDivisor of the current target, but at least one
+constexpr std::size_t kShrinkDivisor = 8;
+
+// Queries are considered slow if they run kSaturationRatio times longer than
+// the baseline and longer than kSaturationMinQueryTime
+constexpr std::size_t kSaturationRatio = 3;
+constexpr std::chrono::milliseconds kSaturationMinQueryTime{10};
+
+// The baseline drops at once and rises by 1/kBaselineDecay of the difference
+constexpr std::chrono::milliseconds::rep kBaselineDecay = 16;
+
+std::size_t DivCeil(std::size_t value, std::size_t divisor) {
+  return (value + divisor - 1) / divisor;
+}
+
+}  // namespace
+
+std::size_t PoolSizeController::Update(const Sample& sample,
+                                       std::size_t min_size,
+                                       std::size_t max_size) {
+  max_size = std::max(min_size, max_size);
+  target_ = std::clamp(target_, min_size, max_size);
+
+  const auto saturated = IsSaturated(sample.query_time);
+  const auto demand = sample.used + sample.waiting;
+  const auto lacks_connections =
+      sample.waiting > 0 || sample.acquire_time >= kGrowAcquireTime;
+
+  if (lacks_connections) {
+    underutilized_streak_ = 0;
+    if (!saturated) {
+      const auto step = std::max<std::size_t>(1, target_ / kGrowDivisor);
+      target_ = std::min(max_size, std::max(demand, target_ + step));
+    }
+    return target_;
+  }
+
+  // Connections needed to serve the demand at the desired utilization
+  const auto needed = DivCeil(demand * kUtilizationDenominator,
+                              kUtilizationNumerator);
+  if (needed >= target_) {
+    underutilized_streak_ = 0;
+    return target_;
+  }
+
+  if (++underutilized_streak_ >= kShrinkStreak) {
+    underutilized_streak_ = 0;
+    const auto step = std::max<std::size_t>(1, target_ / kShrinkDivisor);
+    target_ = std::max({min_size, needed, target_ - step});
+  }
+  return target_;
+}
+
+bool PoolSizeController::IsSaturated(std::chrono::milliseconds query_time) {
+  if (query_time <= std::chrono::milliseconds::zero()) return false;
+
+  if (!baseline_query_time_ || query_time < *baseline_query_time_) {
+    baseline_query_time_ = query_time;
+    return false;
+  }
+
+  const auto baseline = *baseline_query_time_;
+  baseline_query_time_ = baseline + (query_time - baseline) / kBaselineDecay;
+  return query_time >= kSaturationMinQueryTime &&
+         query_time > baseline * kSaturationRatio;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
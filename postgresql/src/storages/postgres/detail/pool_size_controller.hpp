@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Computes the number of connections an adaptive pool should keep open.
+///
+/// The target grows at once when the requests wait for connections and
+/// shrinks only after the pool has been underutilized for a number of
+/// consecutive samples, so short pauses in the load do not close connections
+/// that would have to be reopened right away. The growth is suspended while
+/// the queries run much slower than usual: the server is saturated and more
+/// connections would only add contention.
+class PoolSizeController final {
+ public:
+  struct Sample {
+    /// Connections in use at the moment
+    std::size_t used{0};
+    /// Requests waiting for a connection at the moment
+    std::size_t waiting{0};
+    /// Recent connection acquire time
+    std::chrono::milliseconds acquire_time{0};
+    /// Recent query execution time per transaction
+    std::chrono::milliseconds query_time{0};
+  };
+
+  /// @returns the new target, clamped into [min_size, max_size]
+  std::size_t Update(const Sample& sample, std::size_t min_size,
+                     std::size_t max_size);
+
+  std::size_t GetTarget() const { return target_; }
+
+ private:
+  bool IsSaturated(std::chrono::milliseconds query_time);
+
+  std::size_t target_{0};
+  std::size_t underutilized_streak_{0};
+  std::optional<std::chrono::milliseconds> baseline_query_time_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
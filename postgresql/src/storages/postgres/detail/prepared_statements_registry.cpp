@@ -0,0 +1,81 @@
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+PreparedStatementsRegistry::Statement::Statement(std::string statement,
+                                                 const QueryParameters& params)
+    : statement_{std::move(statement)},
+      param_types_(params.ParamTypesBuffer(),
+                   params.ParamTypesBuffer() + params.Size()) {}
+
+PreparedStatementsRegistry::Entry::Entry(StatementPtr statement,
+                                         const std::optional<Query::Name>& name)
+    : statement{std::move(statement)},
+      name{name ? std::optional<std::string>{name->GetUnderlying()}
+                : std::nullopt} {}
+
+PreparedStatementsRegistry::PreparedStatementsRegistry(std::size_t max_size)
+    : max_size_{max_size} {}
+
+void PreparedStatementsRegistry::Entry::Account(std::uint64_t hits,
+                                                std::uint64_t misses) {
+  if (hits) this->hits.fetch_add(hits, std::memory_order_relaxed);
+  if (misses) this->misses.fetch_add(misses, std::memory_order_relaxed);
+}
+
+PreparedStatementsRegistry::EntryPtr PreparedStatementsRegistry::GetOrRegister(
+    std::size_t query_hash, const std::string& statement,
+    const QueryParameters& params, const std::optional<Query::Name>& name) {
+  auto entry = entries_.Get(query_hash);
+  if (entry) return entry;
+
+  // Statements beyond the limit are neither warmed up nor reported
+  if (entries_.SizeApprox() >= max_size_) return nullptr;
+  return entries_
+      .Emplace(query_hash, std::make_shared<const Statement>(statement, params),
+               name)
+      .value;
+}
+
+std::vector<PreparedStatementsRegistry::StatementPtr>
+PreparedStatementsRegistry::GetHotStatements(std::size_t limit) const {
+  std::vector<std::pair<std::uint64_t, StatementPtr>> usages;
+  for (const auto& [hash, entry] : entries_) {
+    usages.emplace_back(entry->hits.load(std::memory_order_relaxed) +
+                            entry->misses.load(std::memory_order_relaxed),
+                        entry->statement);
+  }
+
+  limit = std::min(limit, usages.size());
+  std::partial_sort(
+      usages.begin(), usages.begin() + limit, usages.end(),
+      [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+  std::vector<StatementPtr> result;
+  result.reserve(limit);
+  for (std::size_t i = 0; i < limit; ++i) {
+    result.push_back(std::move(usages[i].second));
+  }
+  return result;
+}
+
+std::unordered_map<std::string, PreparedStatementCacheStatistics>
+PreparedStatementsRegistry::GetStatistics() const {
+  std::unordered_map<std::string, PreparedStatementCacheStatistics> result;
+  for (const auto& [hash, entry] : entries_) {
+    if (!entry->name) continue;
+    // The same query may be executed with different parameter types
+    auto& stats = result[*entry->name];
+    stats.hits += entry->hits.load(std::memory_order_relaxed);
+    stats.misses += entry->misses.load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
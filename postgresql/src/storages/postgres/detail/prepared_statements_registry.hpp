@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Pool-wide registry of the statements prepared by the pool connections.
+///
+/// Connections account every execution of a statement as a hit or a miss of
+/// their prepared statements cache. New connections take the most used
+/// statements from the registry and prepare them while connecting, so the
+/// first queries after a failover or pool growth do not wait for PREPARE.
+class PreparedStatementsRegistry final {
+ public:
+  /// Statement to prepare on a new connection. Also serves as a parameters
+  /// holder for QueryParameters, only the parameter types are set.
+  class Statement final {
+   public:
+    Statement(std::string statement, const QueryParameters& params);
+
+    const std::string& GetStatement() const { return statement_; }
+
+    std::size_t Size() const { return param_types_.size(); }
+    const Oid* ParamTypesBuffer() const { return param_types_.data(); }
+    const char* const* ParamBuffers() const { return nullptr; }
+    const int* ParamLengthsBuffer() const { return nullptr; }
+    const int* ParamFormatsBuffer() const { return nullptr; }
+
+   private:
+    std::string statement_;
+    std::vector<Oid> param_types_;
+  };
+
+  using StatementPtr = std::shared_ptr<const Statement>;
+
+  /// Usage counters of a registered statement. Connections count the
+  /// executions locally and add them here in batches.
+  struct Entry {
+    Entry(StatementPtr statement, const std::optional<Query::Name>& name);
+
+    void Account(std::uint64_t hits, std::uint64_t misses);
+
+    const StatementPtr statement;
+    const std::optional<std::string> name;
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint64_t> misses{0};
+  };
+
+  using EntryPtr = std::shared_ptr<Entry>;
+
+  explicit PreparedStatementsRegistry(std::size_t max_size);
+
+  /// @returns the entry of the statement, registering it if needed, or
+  /// nullptr if the registry is full
+  EntryPtr GetOrRegister(std::size_t query_hash, const std::string& statement,
+                         const QueryParameters& params,
+                         const std::optional<Query::Name>& name);
+
+  /// @returns up to `limit` statements ordered by the number of executions
+  std::vector<StatementPtr> GetHotStatements(std::size_t limit) const;
+
+  /// @returns cache hits and misses of the named statements
+  std::unordered_map<std::string, PreparedStatementCacheStatistics>
+  GetStatistics() const;
+
+ private:
+  const std::size_t max_size_;
+  rcu::RcuMap<std::size_t, Entry> entries_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -16,6 +16,8 @@ const std::string kGetConnectData = "pg_get_conn_data";
 const std::string kQuery = "pg_query";
 /// Prepare query, driver level
 const std::string kPrepare = "pg_prepare";
+/// Prepare most used statements on a new connection
+const std::string kPrepareWarmup = "pg_prepare_warmup";
 /// Bind portal, driver level
 const std::string kBind = "pg_bind";
 /// Execute query, driver level
@@ -58,6 +58,10 @@ ConnectionSettings ParseConnectionSettings(const ConfigType& config) {
       config["max-prepared-cache-size"].template As<size_t>(
           config["max_prepared_cache_size"].template As<size_t>(
               kDefaultMaxPreparedCacheSize));
+  settings.prepared_statements_warmup =
+      config["prepared-statements-warmup"].template As<size_t>(
+          config["prepared_statements_warmup"].template As<size_t>(
+              settings.prepared_statements_warmup));
   settings.ignore_unused_query_params =
       config["ignore-unused-query-params"].template As<bool>(
           config["ignore_unused_query_params"].template As<bool>(false))
@@ -116,6 +120,8 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
       config["max_queue_size"].template As<size_t>(result.max_queue_size);
   result.connecting_limit =
       config["connecting_limit"].template As<size_t>(result.connecting_limit);
+  result.adaptive_sizing =
+      config["adaptive_sizing"].template As<bool>(result.adaptive_sizing);
 
   if (result.max_size == 0)
     throw InvalidConfig{"max_pool_size must be greater than 0"};
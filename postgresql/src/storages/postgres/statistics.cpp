@@ -4,6 +4,12 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const PreparedStatementCacheStatistics& value) {
+  writer["hits"] = value.hits;
+  writer["misses"] = value.misses;
+}
+
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                 const InstanceStatisticsNonatomic& stats) {
   if (auto conn = writer["connections"]) {
@@ -63,6 +69,12 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
       timings.ValueWithLabels(percentile, {"postgresql_query", name});
     }
   }
+  if (!stats.prepared_statements_cache.empty()) {
+    auto cache = writer["prepared-statements-cache"];
+    for (const auto& [name, cache_stats] : stats.prepared_statements_cache) {
+      cache.ValueWithLabels(cache_stats, {"postgresql_query", name});
+    }
+  }
 }
 
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
@@ -0,0 +1,95 @@
+#include <userver/utest/utest.hpp>
+
+#include <storages/postgres/detail/pool_size_controller.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::postgres::detail::PoolSizeController;
+using Sample = PoolSizeController::Sample;
+
+constexpr std::size_t kMinSize = 4;
+constexpr std::size_t kMaxSize = 100;
+
+Sample MakeSample(std::size_t used, std::size_t waiting,
+                  std::chrono::milliseconds acquire_time,
+                  std::chrono::milliseconds query_time) {
+  Sample sample;
+  sample.used = used;
+  sample.waiting = waiting;
+  sample.acquire_time = acquire_time;
+  sample.query_time = query_time;
+  return sample;
+}
+
+}  // namespace
+
+TEST(PoolSizeController, StartsAtMinSize) {
+  PoolSizeController controller;
+  EXPECT_EQ(controller.Update({}, kMinSize, kMaxSize), kMinSize);
+}
+
+TEST(PoolSizeController, GrowsOnWaiters) {
+  PoolSizeController controller;
+  controller.Update({}, kMinSize, kMaxSize);
+
+  const auto busy = MakeSample(kMinSize, 20, std::chrono::milliseconds{50},
+                               std::chrono::milliseconds{2});
+  EXPECT_EQ(controller.Update(busy, kMinSize, kMaxSize), kMinSize + 20);
+
+  // Keeps growing while the requests still wait
+  EXPECT_GT(controller.Update(busy, kMinSize, kMaxSize), kMinSize + 20);
+}
+
+TEST(PoolSizeController, RespectsMaxSize) {
+  PoolSizeController controller;
+  const auto busy = MakeSample(10, 1000, std::chrono::milliseconds{50},
+                               std::chrono::milliseconds{2});
+  for (int i = 0; i < 10; ++i) controller.Update(busy, kMinSize, kMaxSize);
+  EXPECT_EQ(controller.GetTarget(), kMaxSize);
+
+  // max_size may be lowered by the server max_connections
+  EXPECT_EQ(controller.Update(busy, kMinSize, 30), 30);
+}
+
+TEST(PoolSizeController, NoGrowthWhenServerSaturated) {
+  PoolSizeController controller;
+  const auto fast = MakeSample(2, 0, std::chrono::milliseconds{0},
+                               std::chrono::milliseconds{5});
+  controller.Update(fast, kMinSize, kMaxSize);
+
+  const auto slow = MakeSample(kMinSize, 10, std::chrono::milliseconds{100},
+                               std::chrono::milliseconds{100});
+  EXPECT_EQ(controller.Update(slow, kMinSize, kMaxSize), kMinSize);
+}
+
+TEST(PoolSizeController, ShrinksWithHysteresis) {
+  PoolSizeController controller;
+  const auto busy = MakeSample(40, 20, std::chrono::milliseconds{50},
+                               std::chrono::milliseconds{2});
+  const auto grown = controller.Update(busy, kMinSize, kMaxSize);
+  ASSERT_EQ(grown, 60);
+
+  const auto idle = MakeSample(1, 0, std::chrono::milliseconds{0},
+                               std::chrono::milliseconds{2});
+  for (int i = 0; i < 9; ++i) {
+    EXPECT_EQ(controller.Update(idle, kMinSize, kMaxSize), grown);
+  }
+  const auto shrunk = controller.Update(idle, kMinSize, kMaxSize);
+  EXPECT_LT(shrunk, grown);
+  EXPECT_GT(shrunk, kMinSize);
+
+  // A busy sample resets the streak
+  controller.Update(MakeSample(shrunk, 0, std::chrono::milliseconds{0},
+                               std::chrono::milliseconds{2}),
+                    kMinSize, kMaxSize);
+  for (int i = 0; i < 9; ++i) {
+    EXPECT_EQ(controller.Update(idle, kMinSize, kMaxSize), shrunk);
+  }
+
+  for (int i = 0; i < 1000; ++i) controller.Update(idle, kMinSize, kMaxSize);
+  EXPECT_EQ(controller.GetTarget(), kMinSize);
+}
+
+USERVER_NAMESPACE_END
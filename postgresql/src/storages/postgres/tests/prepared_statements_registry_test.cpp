@@ -0,0 +1,86 @@
+#include <userver/utest/utest.hpp>
+
+#include <storages/postgres/detail/prepared_statements_registry.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using pg::detail::PreparedStatementsRegistry;
+
+const pg::detail::QueryParameters kNoParams;
+const pg::UserTypes kTypes;
+
+void Execute(PreparedStatementsRegistry& registry, std::size_t hash,
+             const std::string& statement, std::size_t times,
+             std::optional<pg::Query::Name> name = {}) {
+  const auto entry = registry.GetOrRegister(hash, statement, kNoParams, name);
+  if (entry) entry->Account(times - 1, 1);
+}
+
+}  // namespace
+
+UTEST(PreparedStatementsRegistry, HotStatements) {
+  PreparedStatementsRegistry registry{10};
+  Execute(registry, 1, "select 1", 5);
+  Execute(registry, 2, "select 2", 20);
+  Execute(registry, 3, "select 3", 10);
+
+  const auto hot = registry.GetHotStatements(2);
+  ASSERT_EQ(hot.size(), 2);
+  EXPECT_EQ(hot[0]->GetStatement(), "select 2");
+  EXPECT_EQ(hot[1]->GetStatement(), "select 3");
+
+  EXPECT_EQ(registry.GetHotStatements(100).size(), 3);
+}
+
+UTEST(PreparedStatementsRegistry, ParamTypes) {
+  PreparedStatementsRegistry registry{10};
+  pg::detail::DynamicQueryParameters params;
+  params.Write(kTypes, 42, std::string{"str"});
+  registry.GetOrRegister(1, "select $1, $2",
+                         pg::detail::QueryParameters{params}, {});
+
+  const auto hot = registry.GetHotStatements(1);
+  ASSERT_EQ(hot.size(), 1);
+  const pg::detail::QueryParameters restored{*hot[0]};
+  ASSERT_EQ(restored.Size(), 2);
+  EXPECT_EQ(restored.TypeHash(),
+            pg::detail::QueryParameters{params}.TypeHash());
+}
+
+UTEST(PreparedStatementsRegistry, Limit) {
+  PreparedStatementsRegistry registry{2};
+  Execute(registry, 1, "select 1", 1);
+  Execute(registry, 2, "select 2", 1);
+  Execute(registry, 3, "select 3", 100);
+
+  const auto hot = registry.GetHotStatements(10);
+  ASSERT_EQ(hot.size(), 2);
+  for (const auto& statement : hot) {
+    EXPECT_NE(statement->GetStatement(), "select 3");
+  }
+
+  EXPECT_FALSE(registry.GetOrRegister(3, "select 3", kNoParams, {}));
+  EXPECT_EQ(registry.GetOrRegister(1, "select 1", kNoParams, {}),
+            registry.GetOrRegister(1, "select 1", kNoParams, {}));
+}
+
+UTEST(PreparedStatementsRegistry, Statistics) {
+  PreparedStatementsRegistry registry{10};
+  const pg::Query::Name name{"query_name"};
+  Execute(registry, 1, "select 1", 5, name);
+  // Same name, different parameter types
+  Execute(registry, 2, "select 1", 3, name);
+  Execute(registry, 3, "select 3", 10);
+
+  const auto stats = registry.GetStatistics();
+  ASSERT_EQ(stats.size(), 1);
+  const auto& query_stats = stats.at("query_name");
+  EXPECT_EQ(query_stats.hits, 6);
+  EXPECT_EQ(query_stats.misses, 2);
+}
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 /// @brief A bunch of interface classes
 
 #include <string>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/flags.hpp>
@@ -14,6 +15,16 @@ USERVER_NAMESPACE_BEGIN
 
 namespace urabbitmq {
 
+/// @brief Message to publish with IReliableChannelInterface::PublishBatch
+struct OutgoingMessage final {
+  /// the routing key
+  std::string routing_key;
+  /// the message to send
+  std::string message;
+  /// message storage type
+  MessageType type{MessageType::kTransient};
+};
+
 /// @brief Administrative interface for the broker.
 /// This class is merely an interface for convenience and you are not expected
 /// to use it directly (use `Client`/`AdminChannel` instead).
@@ -154,6 +165,23 @@ class IReliableChannelInterface {
                                const std::string& message,
                                engine::Deadline deadline) = 0;
 
+  /// @brief Publish messages to an exchange and
+  /// await confirmation of all of them from the broker
+  ///
+  /// Messages are sent one after another without waiting for the
+  /// confirmations of the previous ones, so the whole batch takes about one
+  /// round trip to the broker.
+  ///
+  /// @param exchange the exchange to publish to
+  /// @param messages the messages to send
+  /// @param deadline execution deadline
+  ///
+  /// @throws std::runtime_error if any of the messages was not confirmed;
+  /// some of the messages may have been delivered in that case
+  virtual void PublishBatch(const Exchange& exchange,
+                            const std::vector<OutgoingMessage>& messages,
+                            engine::Deadline deadline) = 0;
+
  protected:
   ~IReliableChannelInterface();
 };
@@ -15,6 +15,40 @@ namespace urabbitmq {
 
 class ConnectionPtr;
 
+namespace impl {
+class ResponseAwaiter;
+}  // namespace impl
+
+/// @brief Confirmation of a message published with
+/// ReliableChannel::PublishReliableAsync.
+///
+/// Each confirmation is accounted as an in-flight request of the connection,
+/// see `max_in_flight_requests` in the client settings.
+class PublishConfirmation final {
+ public:
+  PublishConfirmation(PublishConfirmation&& other) noexcept;
+  PublishConfirmation& operator=(PublishConfirmation&& other) noexcept;
+  ~PublishConfirmation();
+
+  /// @brief Await the confirmation from the broker.
+  /// Either Wait or Abandon must be called exactly once.
+  ///
+  /// @param deadline execution deadline
+  ///
+  /// @throws std::runtime_error if the message was not confirmed
+  void Wait(engine::Deadline deadline);
+
+  /// @brief Drop the confirmation without awaiting it, e.g. on an error path.
+  /// The message may or may not be delivered.
+  void Abandon() noexcept;
+
+ private:
+  friend class ReliableChannel;
+  explicit PublishConfirmation(impl::ResponseAwaiter&& awaiter);
+
+  std::unique_ptr<impl::ResponseAwaiter> awaiter_;
+};
+
 /// @brief Publisher interface for the broker.
 /// You may use this class to publish your messages.
 ///
@@ -77,6 +111,26 @@ class ReliableChannel final : IReliableChannelInterface {
                     deadline);
   }
 
+  /// @brief Publish a message to an exchange without awaiting the
+  /// confirmation from the broker.
+  ///
+  /// Messages published through the same channel are sent in order, so
+  /// many messages may be kept in flight and their confirmations awaited
+  /// later.
+  ///
+  /// @param exchange the exchange to publish to
+  /// @param routing_key the routing key
+  /// @param message the message to send
+  /// @param type message storage type
+  /// @param deadline execution deadline
+  [[nodiscard]] PublishConfirmation PublishReliableAsync(
+      const Exchange& exchange, const std::string& routing_key,
+      const std::string& message, MessageType type, engine::Deadline deadline);
+
+  void PublishBatch(const Exchange& exchange,
+                    const std::vector<OutgoingMessage>& messages,
+                    engine::Deadline deadline) override;
+
  private:
   utils::FastPimpl<ConnectionPtr, 32, 8> impl_;
 };
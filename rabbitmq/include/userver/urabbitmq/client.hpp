@@ -101,6 +101,10 @@ class Client : public std::enable_shared_from_this<Client>,
                     deadline);
   }
 
+  void PublishBatch(const Exchange& exchange,
+                    const std::vector<OutgoingMessage>& messages,
+                    engine::Deadline deadline) override;
+
   /// @brief Get a reliable publisher interface for the broker
   /// (publisher-confirms)
   ///
@@ -1,5 +1,6 @@
 #include "utils_rmqtest.hpp"
 
+#include <algorithm>
 #include <optional>
 
 #include <userver/engine/sleep.hpp>
@@ -150,6 +151,77 @@ UTEST(Consumer, ExhaustesQueue) {
   consumer.Wait();
 }
 
+UTEST(Consumer, PublishBatchWorks) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+
+  const size_t messages_count = 1000;
+  std::vector<urabbitmq::OutgoingMessage> messages;
+  for (size_t i = 0; i < messages_count; ++i) {
+    messages.push_back({client.GetRoutingKey(), std::to_string(i),
+                        urabbitmq::MessageType::kTransient});
+  }
+  client->PublishBatch(client.GetExchange(), messages, client.GetDeadline());
+  client->PublishBatch(client.GetExchange(), {}, client.GetDeadline());
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages_count);
+  consumer.Start();
+
+  EXPECT_EQ(consumer.Wait().size(), messages_count);
+}
+
+UTEST(Consumer, PublishReliableAsyncWorks) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+
+  const size_t messages_count = 5;
+  {
+    auto channel = client->GetReliableChannel(client.GetDeadline());
+    std::vector<urabbitmq::PublishConfirmation> confirmations;
+    for (size_t i = 0; i < messages_count; ++i) {
+      confirmations.push_back(channel.PublishReliableAsync(
+          client.GetExchange(), client.GetRoutingKey(), std::to_string(i),
+          urabbitmq::MessageType::kTransient, client.GetDeadline()));
+    }
+    for (auto& confirmation : confirmations) {
+      confirmation.Wait(client.GetDeadline());
+    }
+  }
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages_count);
+  consumer.Start();
+
+  auto consumed = consumer.Wait();
+  ASSERT_EQ(consumed.size(), messages_count);
+  std::sort(consumed.begin(), consumed.end());
+  for (size_t i = 0; i < messages_count; ++i) {
+    EXPECT_EQ(consumed[i], std::to_string(i));
+  }
+}
+
+UTEST(Consumer, PublishReliableAsyncAbandon) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+
+  auto channel = client->GetReliableChannel(client.GetDeadline());
+  auto confirmation = channel.PublishReliableAsync(
+      client.GetExchange(), client.GetRoutingKey(), "abandoned",
+      urabbitmq::MessageType::kTransient, client.GetDeadline());
+  // Moved-from confirmations need neither Wait nor Abandon
+  auto moved = std::move(confirmation);
+  moved.Abandon();
+
+  channel
+      .PublishReliableAsync(client.GetExchange(), client.GetRoutingKey(),
+                            "awaited", urabbitmq::MessageType::kTransient,
+                            client.GetDeadline())
+      .Wait(client.GetDeadline());
+}
+
 UTEST(Consumer, ThrowsReturnsToQueue) {
   ClientWrapper client{};
   client.SetupRmqEntities();
@@ -1,5 +1,7 @@
 #include <userver/urabbitmq/channel.hpp>
 
+#include <userver/utils/assert.hpp>
+
 #include <urabbitmq/connection_helper.hpp>
 #include <urabbitmq/connection_ptr.hpp>
 
@@ -7,6 +9,27 @@ USERVER_NAMESPACE_BEGIN
 
 namespace urabbitmq {
 
+PublishConfirmation::PublishConfirmation(impl::ResponseAwaiter&& awaiter)
+    : awaiter_{std::make_unique<impl::ResponseAwaiter>(std::move(awaiter))} {}
+
+PublishConfirmation::PublishConfirmation(PublishConfirmation&& other) noexcept =
+    default;
+
+PublishConfirmation& PublishConfirmation::operator=(
+    PublishConfirmation&& other) noexcept = default;
+
+PublishConfirmation::~PublishConfirmation() = default;
+
+void PublishConfirmation::Wait(engine::Deadline deadline) {
+  UASSERT(awaiter_);
+  awaiter_->Wait(deadline);
+}
+
+void PublishConfirmation::Abandon() noexcept {
+  UASSERT(awaiter_);
+  awaiter_->Abandon();
+}
+
 Channel::Channel(ConnectionPtr&& channel) : impl_{std::move(channel)} {}
 
 Channel::~Channel() = default;
@@ -44,6 +67,20 @@ void ReliableChannel::PublishReliable(const Exchange& exchange,
       .Wait(deadline);
 }
 
+PublishConfirmation ReliableChannel::PublishReliableAsync(
+    const Exchange& exchange, const std::string& routing_key,
+    const std::string& message, MessageType type, engine::Deadline deadline) {
+  return PublishConfirmation{ConnectionHelper::PublishReliable(
+      *impl_, exchange, routing_key, message, type, deadline)};
+}
+
+void ReliableChannel::PublishBatch(const Exchange& exchange,
+                                   const std::vector<OutgoingMessage>& messages,
+                                   engine::Deadline deadline) {
+  ConnectionHelper::PublishBatch(*impl_, exchange, messages, deadline)
+      .Wait(deadline);
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
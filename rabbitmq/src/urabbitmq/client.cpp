@@ -87,6 +87,14 @@ void Client::PublishReliable(const Exchange& exchange,
   awaiter.Wait(deadline);
 }
 
+void Client::PublishBatch(const Exchange& exchange,
+                          const std::vector<OutgoingMessage>& messages,
+                          engine::Deadline deadline) {
+  auto awaiter = ConnectionHelper::PublishBatch(impl_->GetConnection(deadline),
+                                                exchange, messages, deadline);
+  awaiter.Wait(deadline);
+}
+
 AdminChannel Client::GetAdminChannel(engine::Deadline deadline) {
   return {impl_->GetConnection(deadline)};
 }
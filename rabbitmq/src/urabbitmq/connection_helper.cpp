@@ -81,6 +81,15 @@ impl::ResponseAwaiter ConnectionHelper::PublishReliable(
   });
 }
 
+impl::ResponseAwaiter ConnectionHelper::PublishBatch(
+    const ConnectionPtr& connection, const Exchange& exchange,
+    const std::vector<OutgoingMessage>& messages, engine::Deadline deadline) {
+  return WithSpan("reliable_publish_batch", [&] {
+    return connection->GetReliableChannel().PublishBatch(exchange, messages,
+                                                         deadline);
+  });
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
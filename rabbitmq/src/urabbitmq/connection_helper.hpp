@@ -1,6 +1,9 @@
 #pragma once
 
+#include <vector>
+
 #include <userver/engine/deadline.hpp>
+#include <userver/urabbitmq/broker_interface.hpp>
 #include <userver/urabbitmq/typedefs.hpp>
 #include <userver/utils/flags.hpp>
 
@@ -57,6 +60,10 @@ class ConnectionHelper final {
       const std::string& routing_key, const std::string& message,
       MessageType type, engine::Deadline deadline);
 
+  [[nodiscard]] static impl::ResponseAwaiter PublishBatch(
+      const ConnectionPtr& connection, const Exchange& exchange,
+      const std::vector<OutgoingMessage>& messages, engine::Deadline deadline);
+
  private:
   template <typename Func>
   static impl::ResponseAwaiter WithSpan(const char* name, Func&& fn) {
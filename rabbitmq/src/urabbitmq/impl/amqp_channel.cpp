@@ -1,5 +1,6 @@
 #include "amqp_channel.hpp"
 
+#include <atomic>
 #include <optional>
 
 #include <userver/engine/task/task.hpp>
@@ -260,6 +261,44 @@ ResponseAwaiter AmqpReliableChannel::Publish(const Exchange& exchange,
   return awaiter;
 }
 
+ResponseAwaiter AmqpReliableChannel::PublishBatch(
+    const Exchange& exchange, const std::vector<OutgoingMessage>& messages,
+    engine::Deadline deadline) {
+  const auto headers = CreateHeaders();
+
+  auto awaiter = conn_.GetAwaiter(deadline);
+  if (messages.empty()) {
+    awaiter.GetWrapper()->Ok();
+    return awaiter;
+  }
+
+  // Acks of the batch may come in a single frame, AMQP::Reliable splits them
+  // into per-message callbacks
+  auto unconfirmed =
+      std::make_shared<std::atomic<std::size_t>>(messages.size());
+
+  {
+    auto reliable = conn_.GetReliableChannel(deadline);
+
+    for (const auto& message : messages) {
+      AMQP::Envelope envelope{message.message.data(), message.message.size()};
+      envelope.setPersistent(message.type == MessageType::kPersistent);
+      envelope.setHeaders(headers);
+
+      reliable->publish(exchange.GetUnderlying(), message.routing_key, envelope)
+          .onAck([this, unconfirmed, deferred = awaiter.GetWrapper()] {
+            AccountMessagePublished();
+            if (--*unconfirmed == 0) deferred->Ok();
+          })
+          .onError([deferred = awaiter.GetWrapper()](const char* error) {
+            deferred->Fail(error);
+          });
+    }
+  }
+
+  return awaiter;
+}
+
 void AmqpReliableChannel::AccountMessagePublished() {
   conn_.GetStatistics().AccountMessagePublished();
 }
@@ -2,10 +2,12 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <userver/urabbitmq/broker_interface.hpp>
 #include <userver/urabbitmq/typedefs.hpp>
 #include <userver/utils/flags.hpp>
 
@@ -90,6 +92,10 @@ class AmqpReliableChannel final {
                           const std::string& message, MessageType type,
                           engine::Deadline deadline);
 
+  ResponseAwaiter PublishBatch(const Exchange& exchange,
+                               const std::vector<OutgoingMessage>& messages,
+                               engine::Deadline deadline);
+
  private:
   void AccountMessagePublished();
 
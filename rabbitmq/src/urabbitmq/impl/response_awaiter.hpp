@@ -23,6 +23,10 @@ class ResponseAwaiter final {
   void SetSpan(tracing::Span&& span);
   void Wait(engine::Deadline deadline) const;
 
+  // Drops the response without waiting for it. The response is still
+  // processed by the deferred, but nobody observes it.
+  void Abandon() noexcept;
+
   const std::shared_ptr<DeferredWrapper>& GetWrapper() const;
 
  private:
@@ -124,6 +124,15 @@ struct CommandControl {
   /// ignored.
   std::optional<ServerId> force_server_id;
 
+  /// If set, overrides the commands buffering interval of the connection: the
+  /// command may wait up to this long to be written to the socket together
+  /// with the other commands. Zero sends the command without a delay.
+  std::optional<std::chrono::microseconds> commands_buffering_interval;
+
+  /// If set, overrides the commands buffering threshold of the connection:
+  /// the buffered commands are sent as soon as that many of them are pending.
+  std::optional<std::size_t> commands_buffering_threshold;
+
   /// If set, command retries are directed to the master instance
   bool force_retries_to_master_on_nil_reply{false};
 
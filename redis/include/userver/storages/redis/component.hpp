@@ -64,6 +64,7 @@ namespace components {
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].client_side_cache_max_size | max count of keys in the local client side cache for GET/HGET replies, invalidated by the server via RESP3 `CLIENT TRACKING` (Redis >= 6.0, libhiredis >= 1.1.0); 0 disables the cache | 0
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
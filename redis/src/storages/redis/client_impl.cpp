@@ -2,6 +2,7 @@
 
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 
 #include "impl/command_control_impl.hpp"
@@ -40,7 +41,9 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
 ClientImpl::ClientImpl(
     std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
     std::optional<size_t> force_shard_idx)
-    : redis_client_(std::move(sentinel)), force_shard_idx_(force_shard_idx) {}
+    : redis_client_(std::move(sentinel)),
+      client_side_cache_(redis_client_->GetClientSideCache()),
+      force_shard_idx_(force_shard_idx) {}
 
 void ClientImpl::WaitConnectedOnce(
     USERVER_NAMESPACE::redis::RedisWaitConnected wait_connected) {
@@ -278,6 +281,12 @@ RequestGeosearch ClientImpl::Geosearch(
 RequestGet ClientImpl::Get(std::string key,
                            const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  if (UseClientSideCache(command_control)) {
+    if (auto data = client_side_cache_->Get(key)) {
+      return CreateDummyRequest<RequestGet>(
+          std::make_shared<Reply>("get", std::move(*data)));
+    }
+  }
   return CreateRequest<RequestGet>(
       MakeRequest(CmdArgs{"get", std::move(key)}, shard, false,
                   GetCommandControl(command_control)));
@@ -320,6 +329,12 @@ RequestHexists ClientImpl::Hexists(std::string key, std::string field,
 RequestHget ClientImpl::Hget(std::string key, std::string field,
                              const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  if (UseClientSideCache(command_control)) {
+    if (auto data = client_side_cache_->Hget(key, field)) {
+      return CreateDummyRequest<RequestHget>(
+          std::make_shared<Reply>("hget", std::move(*data)));
+    }
+  }
   return CreateRequest<RequestHget>(
       MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard,
                   false, GetCommandControl(command_control)));
@@ -1133,6 +1148,12 @@ size_t ClientImpl::ShardByKey(const std::string& key,
   return cc.force_shard_idx.value_or(ShardByKey(key));
 }
 
+bool ClientImpl::UseClientSideCache(const CommandControl& cc) const {
+  // Explicitly routed requests always go to the server
+  return client_side_cache_ && !cc.force_request_to_master.value_or(false) &&
+         !cc.force_server_id;
+}
+
 void ClientImpl::CheckShard(size_t shard, const CommandControl& cc) const {
   DoCheckShard(shard, force_shard_idx_);
   DoCheckShard(shard, cc.force_shard_idx);
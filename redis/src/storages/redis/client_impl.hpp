@@ -18,6 +18,7 @@
 USERVER_NAMESPACE_BEGIN
 
 namespace redis {
+class ClientSideCache;
 class Sentinel;
 }  // namespace redis
 
@@ -473,7 +474,11 @@ class ClientImpl final : public Client,
 
   void CheckShard(size_t shard, const CommandControl& cc) const;
 
+  bool UseClientSideCache(const CommandControl& cc) const;
+
   std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> redis_client_;
+  std::shared_ptr<USERVER_NAMESPACE::redis::ClientSideCache>
+      client_side_cache_;
   std::atomic<int> publish_shard_{0};
   const std::optional<size_t> force_shard_idx_;
 };
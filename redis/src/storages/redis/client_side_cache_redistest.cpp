@@ -0,0 +1,95 @@
+#include <storages/redis/client_redistest.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <userver/storages/redis/parse_reply.hpp>
+
+#include <storages/redis/impl/client_side_cache.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using storages::redis::MemberScore;
+
+constexpr std::size_t kCacheSize = 100;
+
+// Connections with client side caching are switched to RESP3, which changes
+// the shape of replies to all the commands
+class RedisClientSideCacheTest : public ::testing::Test {
+ public:
+  static void SetUpTestSuite() {
+    thread_pools_ = std::make_shared<redis::ThreadPools>(
+        redis::kDefaultSentinelThreadPoolSize,
+        redis::kDefaultRedisThreadPoolSize);
+    sentinel_ = redis::Sentinel::CreateSentinel(
+        thread_pools_, GetTestsuiteRedisSettings(), "none",
+        dynamic_config::GetDefaultSource(), "pub", redis::KeyShardFactory{""});
+    sentinel_->SetClientSideCache(
+        std::make_shared<redis::ClientSideCache>(kCacheSize));
+    sentinel_->WaitConnectedDebug();
+  }
+
+  static void TearDownTestSuite() {
+    sentinel_.reset();
+    thread_pools_.reset();
+  }
+
+  void SetUp() override {
+    sentinel_->MakeRequest({"flushdb"}, "none", true).Get();
+    client_ = std::make_shared<storages::redis::ClientImpl>(sentinel_);
+
+    // Client tracking is enabled by the first command of a connection
+    EXPECT_EQ(client_->Get("key", {}).Get(), std::nullopt);
+  }
+
+  static std::shared_ptr<redis::Sentinel> GetSentinel() { return sentinel_; }
+
+  storages::redis::ClientPtr GetClient() { return client_; }
+
+ private:
+  static inline std::shared_ptr<redis::ThreadPools> thread_pools_;
+  static inline std::shared_ptr<redis::Sentinel> sentinel_;
+  storages::redis::ClientPtr client_;
+};
+
+const std::vector<MemberScore> kMemberScores{{"one", 1.}, {"two", 2.5}};
+
+}  // namespace
+
+UTEST_F(RedisClientSideCacheTest, WithScores) {
+  auto client = GetClient();
+  client->Zadd("zset", {{2.5, "two"}, {1., "one"}}, {}).Get();
+
+  EXPECT_EQ(client->ZrangeWithScores("zset", 0, -1, {}).Get(), kMemberScores);
+  EXPECT_EQ(client->ZrangebyscoreWithScores("zset", 0., 10., {}).Get(),
+            kMemberScores);
+  EXPECT_EQ(client->Zscore("zset", "two", {}).Get(), 2.5);
+}
+
+UTEST_F(RedisClientSideCacheTest, TransactionWithScores) {
+  auto client = GetClient();
+  auto transaction = client->Multi();
+  auto zadd = transaction->Zadd("zset", {{2.5, "two"}, {1., "one"}});
+  auto zrange = transaction->ZrangeWithScores("zset", 0, -1);
+  transaction->Exec({}).Get();
+
+  EXPECT_EQ(zadd.Get(), 2);
+  EXPECT_EQ(zrange.Get(), kMemberScores);
+}
+
+UTEST_F(RedisClientSideCacheTest, Zpopmin) {
+  auto client = GetClient();
+  client->Zadd("zset", {{2.5, "two"}, {1., "one"}}, {}).Get();
+
+  auto reply =
+      GetSentinel()->MakeRequest({"zpopmin", "zset", "2"}, "zset", true).Get();
+  ASSERT_TRUE(reply->IsOk());
+  EXPECT_EQ(storages::redis::ParseReplyDataArray(
+                std::move(reply->data), "zpopmin",
+                storages::redis::To<std::vector<MemberScore>>{}),
+            kMemberScores);
+}
+
+USERVER_NAMESPACE_END
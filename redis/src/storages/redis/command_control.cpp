@@ -141,6 +141,12 @@ CommandControl CommandControl::MergeWith(const CommandControl& b) const {
   if (b.force_server_id.has_value()) {
     res.force_server_id = b.force_server_id;
   }
+  if (b.commands_buffering_interval.has_value()) {
+    res.commands_buffering_interval = b.commands_buffering_interval;
+  }
+  if (b.commands_buffering_threshold.has_value()) {
+    res.commands_buffering_threshold = b.commands_buffering_threshold;
+  }
   if (b.retry_counter && b.retry_counter > res.retry_counter) {
     res.retry_counter = b.retry_counter;
   }
@@ -181,7 +187,11 @@ std::string CommandControl::ToString() const {
   ss << " retries: " << utils::ToString(max_retries) << ',';
   ss << " force_server_id: " << utils::ToString(ToIntOpt(force_server_id))
      << ',';
-  ss << " max ping: " << utils::ToString(max_ping_latency);
+  ss << " max ping: " << utils::ToString(max_ping_latency) << ',';
+  ss << " buffering interval: "
+     << utils::ToString(commands_buffering_interval) << ',';
+  ss << " buffering threshold: "
+     << utils::ToString(commands_buffering_threshold);
   return ss.str();
 }
 
@@ -24,6 +24,7 @@
 #include <userver/storages/redis/redis_config.hpp>
 #include <userver/storages/redis/subscribe_client.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/keyshard_impl.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 #include <storages/redis/impl/subscribe_sentinel.hpp>
@@ -73,6 +74,7 @@ struct RedisGroup {
   std::string config_name;
   std::string sharding_strategy;
   bool allow_reads_from_master{false};
+  size_t client_side_cache_max_size{0};
 };
 
 RedisGroup Parse(const yaml_config::YamlConfig& value,
@@ -83,6 +85,8 @@ RedisGroup Parse(const yaml_config::YamlConfig& value,
   config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
   config.allow_reads_from_master =
       value["allow_reads_from_master"].As<bool>(false);
+  config.client_side_cache_max_size =
+      value["client_side_cache_max_size"].As<size_t>(0);
   return config;
 }
 
@@ -223,6 +227,10 @@ void Redis::Connect(const ComponentConfig& config,
         redis_group.db, redis::KeyShardFactory{redis_group.sharding_strategy},
         cc, testsuite_redis_control);
     if (sentinel) {
+      if (redis_group.client_side_cache_max_size) {
+        sentinel->SetClientSideCache(std::make_shared<redis::ClientSideCache>(
+            redis_group.client_side_cache_max_size));
+      }
       sentinels_.emplace(redis_group.db, sentinel);
       const auto& client =
           std::make_shared<storages::redis::ClientImpl>(sentinel);
@@ -381,6 +389,11 @@ properties:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                client_side_cache_max_size:
+                    type: integer
+                    description: max count of keys in the local RESP3 client side cache for GET/HGET replies, each with up to 64 HGET fields, 0 to disable the cache
+                    defaultDescription: 0
+                    minimum: 0
     metrics_level:
         type: string
         description: set metrics detail level
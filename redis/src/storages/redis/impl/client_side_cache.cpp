@@ -0,0 +1,126 @@
+#include <storages/redis/impl/client_side_cache.hpp>
+
+#include <strings.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+namespace {
+
+bool IsCommand(const CmdArgs::CmdArgsArray& args, const char* name,
+               std::size_t argc) {
+  return args.size() == argc && !strcasecmp(args[0].c_str(), name);
+}
+
+bool IsGet(const CmdArgs::CmdArgsArray& args) {
+  return IsCommand(args, "GET", 2);
+}
+
+bool IsHget(const CmdArgs::CmdArgsArray& args) {
+  return IsCommand(args, "HGET", 3);
+}
+
+bool IsCacheableReply(const ReplyData& data) {
+  return data.IsString() || data.IsNil();
+}
+
+}  // namespace
+
+ClientSideCache::ClientSideCache(std::size_t max_size,
+                                 std::size_t max_fields_per_key)
+    : max_fields_per_key_(max_fields_per_key), entries_(max_size) {
+  UINVARIANT(max_fields_per_key_ > 0,
+             "Client side cache must hold at least one field per key");
+}
+
+bool ClientSideCache::IsCacheableCommand(const CmdArgs::CmdArgsArray& args) {
+  return IsGet(args) || IsHget(args);
+}
+
+std::optional<ReplyData> ClientSideCache::Get(const std::string& key) {
+  return Find(key, nullptr);
+}
+
+std::optional<ReplyData> ClientSideCache::Hget(const std::string& key,
+                                               const std::string& field) {
+  return Find(key, &field);
+}
+
+std::optional<ReplyData> ClientSideCache::Find(const std::string& key,
+                                               const std::string* field) {
+  std::optional<ReplyData> result;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto* entry = entries_.Get(key);
+    if (entry) {
+      if (!field) {
+        result = entry->value;
+      } else if (auto it = entry->fields.find(*field);
+                 it != entry->fields.end()) {
+        result = it->second;
+      }
+    }
+  }
+
+  if (result) {
+    hits_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+  }
+  return result;
+}
+
+void ClientSideCache::Put(const CmdArgs::CmdArgsArray& args,
+                          const ReplyData& data) {
+  if (!IsCacheableReply(data)) return;
+
+  const bool is_get = IsGet(args);
+  if (!is_get && !IsHget(args)) return;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto* entry = entries_.Emplace(args[1]);
+  if (is_get) {
+    entry->value = data;
+  } else {
+    auto& fields = entry->fields;
+    if (fields.size() >= max_fields_per_key_ && !fields.count(args[2])) {
+      fields.erase(fields.begin());
+    }
+    fields.insert_or_assign(args[2], data);
+  }
+}
+
+void ClientSideCache::Invalidate(const std::vector<std::string>& keys) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& key : keys) entries_.Erase(key);
+  }
+  invalidations_.fetch_add(keys.size(), std::memory_order_relaxed);
+}
+
+void ClientSideCache::Clear() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.Clear();
+  }
+  flushes_.fetch_add(1, std::memory_order_relaxed);
+}
+
+ClientSideCacheStatistics ClientSideCache::GetStatistics() const {
+  ClientSideCacheStatistics stats;
+  stats.hits = hits_.load(std::memory_order_relaxed);
+  stats.misses = misses_.load(std::memory_order_relaxed);
+  stats.invalidations = invalidations_.load(std::memory_order_relaxed);
+  stats.flushes = flushes_.load(std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.size = entries_.GetSize();
+  }
+  return stats;
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
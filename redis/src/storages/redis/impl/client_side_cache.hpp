@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+
+#include <userver/storages/redis/impl/base.hpp>
+#include <userver/storages/redis/impl/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+struct ClientSideCacheStatistics {
+  std::size_t hits{0};
+  std::size_t misses{0};
+  std::size_t invalidations{0};
+  std::size_t flushes{0};
+  std::size_t size{0};
+};
+
+/// Size-bounded local cache of GET/HGET replies, kept coherent with the
+/// server via RESP3 `CLIENT TRACKING` invalidation messages.
+///
+/// Values are put into the cache only by the connections that have the client
+/// tracking enabled (see Redis::SetClientSideCache()). Every such connection
+/// forwards invalidation messages to the cache and flushes the whole cache on
+/// disconnect, because invalidations may be lost while the connection is down.
+///
+/// The cache holds up to `max_size` keys, each with up to
+/// `max_fields_per_key` HGET fields. An arbitrary field of the key is evicted
+/// to make room for a new one.
+///
+/// Thread safe, may be used from ev threads and coroutines.
+class ClientSideCache final {
+ public:
+  static constexpr std::size_t kDefaultMaxFieldsPerKey = 64;
+
+  explicit ClientSideCache(
+      std::size_t max_size,
+      std::size_t max_fields_per_key = kDefaultMaxFieldsPerKey);
+
+  ClientSideCache(const ClientSideCache&) = delete;
+  ClientSideCache& operator=(const ClientSideCache&) = delete;
+
+  /// Returns true if the reply to `args` could be stored in the cache
+  static bool IsCacheableCommand(const CmdArgs::CmdArgsArray& args);
+
+  /// Returns cached reply to `GET key`, if any
+  std::optional<ReplyData> Get(const std::string& key);
+
+  /// Returns cached reply to `HGET key field`, if any
+  std::optional<ReplyData> Hget(const std::string& key,
+                                const std::string& field);
+
+  /// Stores the reply to a cacheable command, ignores non-cacheable ones
+  void Put(const CmdArgs::CmdArgsArray& args, const ReplyData& data);
+
+  /// Drops all the values of `keys`
+  void Invalidate(const std::vector<std::string>& keys);
+
+  /// Drops everything
+  void Clear();
+
+  ClientSideCacheStatistics GetStatistics() const;
+
+ private:
+  struct KeyEntry {
+    std::optional<ReplyData> value;
+    std::unordered_map<std::string, ReplyData> fields;
+  };
+
+  std::optional<ReplyData> Find(const std::string& key,
+                                const std::string* field);
+
+  const std::size_t max_fields_per_key_;
+
+  mutable std::mutex mutex_;
+  cache::LruMap<std::string, KeyEntry> entries_;
+
+  std::atomic<std::size_t> hits_{0};
+  std::atomic<std::size_t> misses_{0};
+  std::atomic<std::size_t> invalidations_{0};
+  std::atomic<std::size_t> flushes_{0};
+};
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,97 @@
+#include <storages/redis/impl/client_side_cache.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(ClientSideCache, GetHget) {
+  redis::ClientSideCache cache(10);
+
+  EXPECT_FALSE(cache.Get("key"));
+  cache.Put({"GET", "key"}, redis::ReplyData("value"));
+  cache.Put({"hget", "hash", "field"}, redis::ReplyData::CreateNil());
+
+  auto value = cache.Get("key");
+  ASSERT_TRUE(value);
+  EXPECT_EQ(value->GetString(), "value");
+
+  auto field = cache.Hget("hash", "field");
+  ASSERT_TRUE(field);
+  EXPECT_TRUE(field->IsNil());
+
+  EXPECT_FALSE(cache.Hget("hash", "other_field"));
+  EXPECT_FALSE(cache.Get("hash"));
+
+  const auto stats = cache.GetStatistics();
+  EXPECT_EQ(stats.hits, 2);
+  EXPECT_EQ(stats.misses, 3);
+  EXPECT_EQ(stats.size, 2);
+}
+
+TEST(ClientSideCache, NotCacheable) {
+  redis::ClientSideCache cache(10);
+
+  EXPECT_TRUE(redis::ClientSideCache::IsCacheableCommand({"get", "key"}));
+  EXPECT_TRUE(
+      redis::ClientSideCache::IsCacheableCommand({"HGET", "key", "field"}));
+  EXPECT_FALSE(
+      redis::ClientSideCache::IsCacheableCommand({"mget", "key1", "key2"}));
+  EXPECT_FALSE(redis::ClientSideCache::IsCacheableCommand({"hgetall", "key"}));
+
+  cache.Put({"set", "key", "value"}, redis::ReplyData::CreateStatus("OK"));
+  cache.Put({"get", "key"}, redis::ReplyData::CreateStatus("QUEUED"));
+  cache.Put({"get", "key"}, redis::ReplyData::CreateError("ERR"));
+  EXPECT_FALSE(cache.Get("key"));
+  EXPECT_EQ(cache.GetStatistics().size, 0);
+}
+
+TEST(ClientSideCache, Invalidate) {
+  redis::ClientSideCache cache(10);
+
+  cache.Put({"get", "key1"}, redis::ReplyData("value1"));
+  cache.Put({"get", "key2"}, redis::ReplyData("value2"));
+  cache.Put({"hget", "key2", "field"}, redis::ReplyData("value3"));
+
+  cache.Invalidate({"key2", "unknown"});
+  EXPECT_TRUE(cache.Get("key1"));
+  EXPECT_FALSE(cache.Get("key2"));
+  EXPECT_FALSE(cache.Hget("key2", "field"));
+  EXPECT_EQ(cache.GetStatistics().invalidations, 2);
+
+  cache.Clear();
+  EXPECT_FALSE(cache.Get("key1"));
+  EXPECT_EQ(cache.GetStatistics().flushes, 1);
+  EXPECT_EQ(cache.GetStatistics().size, 0);
+}
+
+TEST(ClientSideCache, SizeLimit) {
+  redis::ClientSideCache cache(2);
+
+  cache.Put({"get", "key1"}, redis::ReplyData("value1"));
+  cache.Put({"get", "key2"}, redis::ReplyData("value2"));
+  EXPECT_TRUE(cache.Get("key1"));
+
+  cache.Put({"get", "key3"}, redis::ReplyData("value3"));
+  EXPECT_TRUE(cache.Get("key1"));
+  EXPECT_FALSE(cache.Get("key2"));
+  EXPECT_TRUE(cache.Get("key3"));
+}
+
+TEST(ClientSideCache, FieldsLimit) {
+  redis::ClientSideCache cache(10, 2);
+
+  cache.Put({"hget", "key", "field1"}, redis::ReplyData("value1"));
+  cache.Put({"hget", "key", "field2"}, redis::ReplyData("value2"));
+  // Updates of the cached fields do not evict anything
+  cache.Put({"hget", "key", "field2"}, redis::ReplyData("value3"));
+  EXPECT_TRUE(cache.Hget("key", "field1"));
+  EXPECT_EQ(cache.Hget("key", "field2")->GetString(), "value3");
+
+  cache.Put({"hget", "key", "field3"}, redis::ReplyData("value4"));
+  EXPECT_TRUE(cache.Hget("key", "field3"));
+  EXPECT_EQ(cache.Hget("key", "field1").has_value() +
+                cache.Hget("key", "field2").has_value(),
+            1);
+}
+
+USERVER_NAMESPACE_END
@@ -349,6 +349,16 @@ class ClusterTopologyHolder
     }
   }
 
+  void SetClientSideCache(const std::shared_ptr<ClientSideCache>& cache) {
+    {
+      auto cache_ptr = client_side_cache_.Lock();
+      *cache_ptr = cache;
+    }
+    for (const auto& node : nodes_) {
+      node.second->SetClientSideCache(cache);
+    }
+  }
+
   static size_t GetClusterSlotsCalledCounter() {
     return cluster_slots_call_counter_.load(std::memory_order_relaxed);
   }
@@ -427,6 +437,8 @@ class ClusterTopologyHolder
       monitoring_settings_;
   concurrent::Variable<utils::RetryBudgetSettings, std::mutex>
       retry_budget_settings_;
+  concurrent::Variable<std::shared_ptr<ClientSideCache>, std::mutex>
+      client_side_cache_;
   concurrent::Variable<std::unordered_set<HostPort>, std::mutex>
       nodes_to_create_;
   concurrent::Variable<std::unordered_set<HostPort>, std::mutex> actual_nodes_;
@@ -672,11 +684,16 @@ ClusterTopologyHolder::CreateRedisInstance(const std::string& host_port) {
   const auto buffering_settings_ptr = commands_buffering_settings_.Lock();
   const auto replication_monitoring_settings_ptr = monitoring_settings_.Lock();
   const auto retry_budget_settings_ptr = retry_budget_settings_.Lock();
+  const auto client_side_cache_ptr = client_side_cache_.Lock();
   LOG_DEBUG() << "Create new redis instance " << host_port;
-  return std::make_shared<RedisConnectionHolder>(
+  auto instance = std::make_shared<RedisConnectionHolder>(
       ev_thread_, redis_thread_pool_, host, port, password_,
       buffering_settings_ptr->value_or(CommandsBufferingSettings{}),
       *replication_monitoring_settings_ptr, *retry_budget_settings_ptr);
+  if (*client_side_cache_ptr) {
+    instance->SetClientSideCache(*client_side_cache_ptr);
+  }
+  return instance;
 }
 
 namespace {
@@ -1051,6 +1068,13 @@ void ClusterSentinelImpl::SetRetryBudgetSettings(
   }
 }
 
+void ClusterSentinelImpl::SetClientSideCache(
+    std::shared_ptr<ClientSideCache> cache) {
+  if (topology_holder_) {
+    topology_holder_->SetClientSideCache(cache);
+  }
+}
+
 SentinelStatistics ClusterSentinelImpl::GetStatistics(
     const MetricsSettings& settings) const {
   if (!topology_holder_) {
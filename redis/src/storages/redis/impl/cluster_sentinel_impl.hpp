@@ -72,6 +72,7 @@ class ClusterSentinelImpl : public SentinelImplBase {
       override;
   void SetRetryBudgetSettings(
       const utils::RetryBudgetSettings& settings) override;
+  void SetClientSideCache(std::shared_ptr<ClientSideCache> cache) override;
   PublishSettings GetPublishSettings() override;
 
   static size_t GetClusterSlotsCalledCounter();
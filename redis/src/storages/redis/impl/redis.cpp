@@ -22,10 +22,12 @@
 #include <userver/utils/retry_budget.hpp>
 #include <userver/utils/swappingsmart.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/command.hpp>
 #include <storages/redis/impl/ev_wrapper.hpp>
 #include <storages/redis/impl/redis_info.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/resp3.hpp>
 #include <storages/redis/impl/tcp_socket.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 
@@ -50,6 +52,13 @@ const std::string kSubscriberPingChannelName = "_ping_dummy_ch";
 #define REDIS_ERR_TIMEOUT 6
 #endif
 
+// RESP3 push messages are delivered to a separate callback since
+// libhiredis 1.1.0, older versions can not be used for client tracking
+#if defined(HIREDIS_MAJOR) && \
+    (HIREDIS_MAJOR > 1 || (HIREDIS_MAJOR == 1 && HIREDIS_MINOR >= 1))
+#define USERVER_REDIS_PUSH_CALLBACK 1
+#endif
+
 ReplyStatus NativeToReplyStatus(int status) {
   constexpr utils::TrivialBiMap error_map = [](auto selector) {
     return selector()
@@ -99,6 +108,19 @@ inline bool IsSubscribesCommand(const CmdArgs::CmdArgsArray& args) {
   return IsSubscribeCommand(args) || IsUnsubscribeCommand(args);
 }
 
+// HELLO replies with a map of the connection properties, flattened into
+// an array of keys and values
+bool IsResp3HelloReply(const ReplyData& data) {
+  if (!data.IsArray()) return false;
+  const auto& array = data.GetArray();
+  for (std::size_t i = 0; i + 1 < array.size(); i += 2) {
+    if (array[i].IsString() && array[i].GetString() == "proto") {
+      return array[i + 1].IsInt() && array[i + 1].GetInt() == 3;
+    }
+  }
+  return false;
+}
+
 inline bool IsMultiCommand(const CmdArgs::CmdArgsArray& args) {
   static const std::string multi_command{"MULTI"};
 
@@ -174,6 +196,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   void SetReplicationMonitoringSettings(
       const ReplicationMonitoringSettings& replication_monitoring_settings);
   void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
+  void SetClientSideCache(std::shared_ptr<ClientSideCache> cache);
 
   void ResetRedisObj() { redis_obj_ = nullptr; }
 
@@ -181,11 +204,20 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   struct SingleCommand {
     std::string cmd;
     CommandPtr meta;
+    // position in meta->args
+    std::size_t args_index{0};
     ev_timer timer{};
     std::shared_ptr<RedisImpl> redis_impl;
     bool invoke_disabled = false;
   };
 
+  enum class ClientTrackingState {
+    kOff,
+    kRequested,
+    kOn,
+    kUnsupported,
+  };
+
   void DoDisconnect();
   void Attach();
   void Detach();
@@ -198,6 +230,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
                            void* privdata) noexcept;
   static void OnConnect(const redisAsyncContext* c, int status) noexcept;
   static void OnDisconnect(const redisAsyncContext* c, int status) noexcept;
+  static void OnPushReply(redisAsyncContext* c, void* r) noexcept;
   static void OnTimerPing(struct ev_loop* loop, ev_timer* w,
                           int revents) noexcept;
   static void OnTimerInfo(struct ev_loop* loop, ev_timer* w,
@@ -219,6 +252,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   void CommandLoopImpl();
   void OnRedisReplyImpl(redisReply* redis_reply, void* privdata, int status,
                         const char* errstr);
+  void OnPushReplyImpl(redisReply* redis_reply);
   void AccountPingLatency(std::chrono::milliseconds latency);
   void AccountRtt();
   void OnTimerPingImpl();
@@ -236,6 +270,11 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   void SendReadOnly();
   void FreeCommands();
 
+  void EnableClientTracking(std::shared_ptr<ClientSideCache> cache);
+  void EnableClientTrackingResp3(const CommandControl& cc);
+  void DropClientTracking();
+  void CacheReply(const Command& command, const ReplyData& data);
+
   static void LogSocketErrorReply(const CommandPtr& command,
                                   const ReplyPtr& reply);
   static void LogInstanceErrorReply(const CommandPtr& command,
@@ -250,6 +289,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   static bool WatchCommandTimerEnabled(
       const CommandsBufferingSettings& commands_buffering_settings);
+  void ResetCommandsBufferingLimits();
 
   bool Connect(const std::string& host, int port, const Password& password);
 
@@ -261,6 +301,11 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   std::mutex command_mutex_;
   std::deque<CommandPtr> commands_;
+  // The strictest buffering limits among the commands_, protected by
+  // command_mutex_
+  std::chrono::microseconds commands_buffering_interval_{
+      std::chrono::microseconds::max()};
+  size_t commands_buffering_threshold_ = 0;
   std::atomic<bool> destroying_{false};
 
   redisAsyncContext* context_ = nullptr;
@@ -288,6 +333,12 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   ev_timer watch_command_timer_{};
   ev_async watch_command_{};
   utils::SwappingSmart<CommandsBufferingSettings> commands_buffering_settings_;
+  utils::SwappingSmart<ClientSideCache> client_side_cache_;
+  // cache the server tracks keys for, accessed only from the ev thread
+  std::shared_ptr<ClientSideCache> tracking_cache_;
+  ClientTrackingState client_tracking_state_{ClientTrackingState::kOff};
+  // HELLO 3 was sent, replies may come in RESP3
+  bool is_resp3_{false};
   std::atomic_bool enable_replication_monitoring_ = false;
   std::atomic_bool forbid_requests_to_syncing_replicas_ = false;
   const bool send_readonly_;
@@ -298,6 +349,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::atomic<double> ping_latency_ms_{kInitialPingLatencyMs};
   logging::LogExtra log_extra_;
   bool watch_command_timer_started_ = false;
+  std::chrono::steady_clock::time_point watch_command_timer_deadline_;
   Statistics statistics_;
   ServerId server_id_;
   bool attached_ = false;
@@ -379,6 +431,10 @@ void Redis::SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings) {
   impl_->SetRetryBudgetSettings(settings);
 }
 
+void Redis::SetClientSideCache(std::shared_ptr<ClientSideCache> cache) {
+  impl_->SetClientSideCache(std::move(cache));
+}
+
 void Redis::SetReplicationMonitoringSettings(
     const ReplicationMonitoringSettings& replication_monitoring_settings) {
   impl_->SetReplicationMonitoringSettings(replication_monitoring_settings);
@@ -499,6 +555,9 @@ bool Redis::RedisImpl::Connect(const std::string& host, int port,
     if (!err)
       CheckError(redisAsyncSetDisconnectCallback(context_, OnDisconnect),
                  "redisAsyncSetDisconnectCallback");
+#ifdef USERVER_REDIS_PUSH_CALLBACK
+    if (!err) redisAsyncSetPushCallback(context_, OnPushReply);
+#endif
     SetState(err ? State::kInitError : State::kInit);
   });
   return true;
@@ -517,6 +576,7 @@ void Redis::RedisImpl::DoDisconnect() {
     redisAsyncDisconnect(context_);
 
   FreeCommands();
+  DropClientTracking();
 
   if (state_ == State::kInit) {
     /*
@@ -600,15 +660,42 @@ bool Redis::RedisImpl::WatchCommandTimerEnabled(
              std::chrono::microseconds::zero();
 }
 
+void Redis::RedisImpl::ResetCommandsBufferingLimits() {
+  commands_buffering_interval_ = std::chrono::microseconds::max();
+  commands_buffering_threshold_ = 0;
+}
+
 bool Redis::RedisImpl::AsyncCommand(const CommandPtr& command) {
   LOG_DEBUG() << "AsyncCommand for server_id=" << GetServerId().GetId()
               << " server=" << GetServerId().GetDescription()
               << " cmd=" << command->args;
+  const auto buffering_settings = commands_buffering_settings_.Get();
+  auto buffering_interval =
+      WatchCommandTimerEnabled(*buffering_settings)
+          ? buffering_settings->watch_command_timer_interval
+          : std::chrono::microseconds::zero();
+  auto buffering_threshold = buffering_settings->commands_buffering_threshold;
+
+  // Per-command overrides of the connection settings
+  const auto& control = command->control;
+  if (control.commands_buffering_interval) {
+    buffering_interval = *control.commands_buffering_interval;
+  }
+  if (control.commands_buffering_threshold) {
+    buffering_threshold = *control.commands_buffering_threshold;
+  }
   {
     std::lock_guard<std::mutex> lock(command_mutex_);
     if (destroying_) return false;
     ++commands_size_;
     commands_.push_back(command);
+    commands_buffering_interval_ =
+        std::min(commands_buffering_interval_, buffering_interval);
+    if (buffering_threshold && (!commands_buffering_threshold_ ||
+                                buffering_threshold <
+                                    commands_buffering_threshold_)) {
+      commands_buffering_threshold_ = buffering_threshold;
+    }
   }
   ev_thread_control_.Send(watch_command_);
   return true;
@@ -896,23 +983,35 @@ void Redis::RedisImpl::OnNewCommand(struct ev_loop*, ev_async* w,
 }
 
 void Redis::RedisImpl::OnNewCommandImpl() {
-  auto commands_buffering_settings = commands_buffering_settings_.Get();
-  if (WatchCommandTimerEnabled(*commands_buffering_settings) &&
-      (!commands_buffering_settings->commands_buffering_threshold ||
-       commands_size_.load() <
-           commands_buffering_settings->commands_buffering_threshold)) {
-    if (!std::exchange(watch_command_timer_started_, true)) {
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
-      ev_timer_set(
-          &watch_command_timer_,
-          ToEvDuration(
-              commands_buffering_settings->watch_command_timer_interval),
-          0.0);
-      ev_thread_control_.Start(watch_command_timer_);
-    }
-  } else {
+  std::chrono::microseconds buffering_interval{};
+  size_t buffering_threshold = 0;
+  size_t commands_size = 0;
+  {
+    std::lock_guard<std::mutex> lock(command_mutex_);
+    buffering_interval = commands_buffering_interval_;
+    buffering_threshold = commands_buffering_threshold_;
+    commands_size = commands_.size();
+  }
+  // Commands were already sent by a previous wakeup
+  if (!commands_size) return;
+
+  if (buffering_interval == std::chrono::microseconds::zero() ||
+      (buffering_threshold && commands_size >= buffering_threshold)) {
     CommandLoopImpl();
+    return;
+  }
+
+  // A command with a shorter interval may move the deadline closer
+  const auto deadline = std::chrono::steady_clock::now() + buffering_interval;
+  if (watch_command_timer_started_) {
+    if (deadline >= watch_command_timer_deadline_) return;
+    ev_thread_control_.Stop(watch_command_timer_);
   }
+  watch_command_timer_started_ = true;
+  watch_command_timer_deadline_ = deadline;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  ev_timer_set(&watch_command_timer_, ToEvDuration(buffering_interval), 0.0);
+  ev_thread_control_.Start(watch_command_timer_);
 }
 
 void Redis::RedisImpl::CommandLoopOnTimer(struct ev_loop*, ev_timer* w,
@@ -927,18 +1026,20 @@ void Redis::RedisImpl::CommandLoopOnTimer(struct ev_loop*, ev_timer* w,
 }
 
 void Redis::RedisImpl::CommandLoopImpl() {
-  if (WatchCommandTimerEnabled(*commands_buffering_settings_.Get())) {
-    if (std::exchange(watch_command_timer_started_, false)) {
-      ev_thread_control_.Stop(watch_command_timer_);
-    }
+  if (std::exchange(watch_command_timer_started_, false)) {
+    ev_thread_control_.Stop(watch_command_timer_);
   }
   std::deque<CommandPtr> commands;
   {
     std::lock_guard<std::mutex> lock(command_mutex_);
     commands_size_ -= commands_.size();
     std::swap(commands_, commands);
+    ResetCommandsBufferingLimits();
   }
   LOG_TRACE() << "commands size=" << commands.size();
+  // All the commands of the loop go to the hiredis output buffer and are
+  // written to the socket at once
+  if (!commands.empty()) statistics_.AccountBatchSent(commands.size());
   for (auto& command : commands) {
     ProcessCommand(command);
   }
@@ -1006,6 +1107,7 @@ void Redis::RedisImpl::OnDisconnectImpl(int status) {
            "https://wiki.yandex-team.ru/taxi/backend/userver/redis/"
            "#logiservera).";
   }
+  DropClientTracking();
   SetState(status == REDIS_OK ? State::kDisconnected : State::kDisconnectError);
   context_ = nullptr;
   self_.reset();
@@ -1119,6 +1221,42 @@ void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r,
   }
 }
 
+void Redis::RedisImpl::OnPushReply(redisAsyncContext* c, void* r) noexcept {
+  auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+  UASSERT(impl != nullptr);
+  try {
+    impl->OnPushReplyImpl(static_cast<redisReply*>(r));
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "OnPushReplyImpl() failed: " << ex;
+  }
+}
+
+void Redis::RedisImpl::OnPushReplyImpl(redisReply* redis_reply) {
+  if (!redis_reply || !tracking_cache_) return;
+
+  ReplyData data(redis_reply);
+  if (!data.IsArray()) return;
+  auto& message = data.GetArray();
+  if (message.size() != 2 || !message[0].IsString() ||
+      strcasecmp(message[0].GetString().c_str(), "invalidate")) {
+    return;
+  }
+
+  if (message[1].IsNil()) {
+    // FLUSHALL/FLUSHDB on the server
+    tracking_cache_->Clear();
+    return;
+  }
+  if (!message[1].IsArray()) return;
+
+  std::vector<std::string> keys;
+  keys.reserve(message[1].GetArray().size());
+  for (auto& key : message[1].GetArray()) {
+    if (key.IsString()) keys.push_back(std::move(key.GetString()));
+  }
+  tracking_cache_->Invalidate(keys);
+}
+
 void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
                                         int status, const char* errstr) {
   auto data = reply_privdata_.find(reinterpret_cast<size_t>(privdata));
@@ -1133,6 +1271,10 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
   auto reply = std::make_shared<Reply>(pcommand->cmd, redis_reply,
                                        NativeToReplyStatus(status),
                                        errstr ? errstr : "");
+  if (is_resp3_ && reply->data) {
+    ConvertResp3ReplyToResp2(pcommand->meta->args, pcommand->args_index,
+                             reply->data);
+  }
 
   // After 'subscribe x' + 'unsubscribe x' + 'subscribe x' requests
   // 'unsubscribe' reply can be received as a reply to the second subscribe
@@ -1165,11 +1307,20 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
     if (subscriber_ &&
         (!reply->IsOk() || !reply->data || !reply->data.IsArray()))
       pcommand->invoke_disabled = true;
+    if (client_tracking_state_ == ClientTrackingState::kOn && reply->IsOk())
+      CacheReply(*pcommand->meta, reply->data);
     InvokeCommand(pcommand->meta, std::move(reply));
   }
 }
 
 void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
+  if (client_tracking_state_ == ClientTrackingState::kOff &&
+      state_ == State::kConnected && !subscriber_ && !IsDestroying()) {
+    if (auto cache = client_side_cache_.Get()) {
+      EnableClientTracking(std::move(cache));
+    }
+  }
+
   command->ResetStartHandlingTime();
   statistics_.AccountCommandSent(command);
 
@@ -1238,6 +1389,7 @@ void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
       auto entry = std::make_unique<SingleCommand>();
       entry->cmd = args[0];
       entry->meta = command;
+      entry->args_index = i;
       entry->timer.data = this;
       entry->redis_impl = shared_from_this();
       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
@@ -1259,6 +1411,87 @@ void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
   }
 }
 
+void Redis::RedisImpl::EnableClientTracking(
+    std::shared_ptr<ClientSideCache> cache) {
+#ifdef USERVER_REDIS_PUSH_CALLBACK
+  client_tracking_state_ = ClientTrackingState::kRequested;
+  // Invalidations are applied even if CLIENT TRACKING reply is lost, the cache
+  // is filled only after the tracking is confirmed.
+  tracking_cache_ = std::move(cache);
+
+  CommandControl cc{ping_timeout_, ping_timeout_, 1};
+  cc.account_in_statistics = false;
+
+  // HELLO 3 changes the replies to all the commands of the connection. It is
+  // kept set even if HELLO fails, as converting RESP2 replies is a no-op.
+  is_resp3_ = true;
+
+  // CLIENT TRACKING without REDIRECT delivers invalidations only as RESP3
+  // pushes, so it is sent only after the protocol switch is confirmed. Replies
+  // are read in order, so every reply after the CLIENT TRACKING one is read
+  // with tracking enabled.
+  ProcessCommand(PrepareCommand(
+      CmdArgs{"HELLO", "3"},
+      [this, cc](const CommandPtr&, ReplyPtr reply) {
+        if (client_tracking_state_ != ClientTrackingState::kRequested) return;
+        if (!reply->IsOk() || !IsResp3HelloReply(reply->data)) {
+          LOG_WARNING() << log_extra_
+                        << "HELLO 3 failed, client side caching is disabled "
+                           "for the connection. Status="
+                        << reply->status
+                        << " msg=" << reply->data.ToDebugString();
+          client_tracking_state_ = ClientTrackingState::kUnsupported;
+          return;
+        }
+        EnableClientTrackingResp3(cc);
+      },
+      cc));
+#else
+  static_cast<void>(cache);
+  client_tracking_state_ = ClientTrackingState::kUnsupported;
+  LOG_WARNING() << log_extra_
+                << "Client side caching requires libhiredis >= 1.1.0";
+#endif
+}
+
+void Redis::RedisImpl::EnableClientTrackingResp3(const CommandControl& cc) {
+  ProcessCommand(PrepareCommand(
+      CmdArgs{"CLIENT", "TRACKING", "ON"},
+      [this](const CommandPtr&, ReplyPtr reply) {
+        if (client_tracking_state_ != ClientTrackingState::kRequested) return;
+        if (*reply && reply->data.IsStatus()) {
+          LOG_DEBUG() << log_extra_ << "Client tracking is enabled";
+          client_tracking_state_ = ClientTrackingState::kOn;
+          return;
+        }
+        LOG_WARNING() << log_extra_
+                      << "CLIENT TRACKING failed, client side caching is "
+                         "disabled for the connection. Status="
+                      << reply->status << " msg="
+                      << reply->data.ToDebugString();
+        client_tracking_state_ = ClientTrackingState::kUnsupported;
+      },
+      cc));
+}
+
+void Redis::RedisImpl::DropClientTracking() {
+  if (!tracking_cache_) return;
+
+  // Invalidation messages are lost while there is no connection
+  tracking_cache_->Clear();
+  tracking_cache_.reset();
+  client_tracking_state_ = ClientTrackingState::kOff;
+  is_resp3_ = false;
+}
+
+void Redis::RedisImpl::CacheReply(const Command& command,
+                                  const ReplyData& data) {
+  UASSERT(tracking_cache_);
+  // Skip MULTI/EXEC and other command chains
+  if (command.args.args.size() != 1) return;
+  tracking_cache_->Put(command.args.args.front(), data);
+}
+
 bool Redis::RedisImpl::CanRetry() const { return retry_budget_.CanRetry(); }
 
 void Redis::RedisImpl::SetCommandsBufferingSettings(
@@ -1279,6 +1512,11 @@ void Redis::RedisImpl::SetRetryBudgetSettings(
   retry_budget_.SetSettings(settings);
 }
 
+void Redis::RedisImpl::SetClientSideCache(
+    std::shared_ptr<ClientSideCache> cache) {
+  client_side_cache_.Set(std::move(cache));
+}
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
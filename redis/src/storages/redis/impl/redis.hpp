@@ -20,6 +20,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+class ClientSideCache;
 class Statistics;
 
 class Redis {
@@ -55,6 +56,14 @@ class Redis {
       const ReplicationMonitoringSettings& replication_monitoring_settings);
   void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
 
+  /// Enables RESP3 client tracking on this connection, replies to cacheable
+  /// commands are stored into the `cache` and invalidated by the server push
+  /// messages. The cache is flushed on disconnect.
+  ///
+  /// All the commands of the connection are then replied in RESP3, the
+  /// replies are converted to the RESP2 shape by ConvertResp3ReplyToResp2().
+  void SetClientSideCache(std::shared_ptr<ClientSideCache> cache);
+
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   boost::signals2::signal<void(State)> signal_state_change;
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
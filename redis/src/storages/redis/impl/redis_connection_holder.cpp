@@ -76,6 +76,10 @@ void RedisConnectionHolder::CreateConnection() {
     auto settings_ptr = retry_budget_settings_.Lock();
     instance->SetRetryBudgetSettings(*settings_ptr);
   }
+  {
+    auto cache_ptr = client_side_cache_.Lock();
+    if (*cache_ptr) instance->SetClientSideCache(*cache_ptr);
+  }
 
   instance->Connect({host_}, port_, password_);
   redis_.Assign(std::move(instance));
@@ -102,6 +106,13 @@ void RedisConnectionHolder::SetRetryBudgetSettings(
   redis_.ReadCopy()->SetRetryBudgetSettings(std::move(settings));
 }
 
+void RedisConnectionHolder::SetClientSideCache(
+    std::shared_ptr<ClientSideCache> cache) {
+  auto ptr = client_side_cache_.Lock();
+  *ptr = cache;
+  redis_.ReadCopy()->SetClientSideCache(std::move(cache));
+}
+
 Redis::State RedisConnectionHolder::GetState() const {
   auto ptr = redis_.Read();
   return ptr->get()->GetState();
@@ -33,6 +33,7 @@ class RedisConnectionHolder
   void SetReplicationMonitoringSettings(ReplicationMonitoringSettings settings);
   void SetCommandsBufferingSettings(CommandsBufferingSettings settings);
   void SetRetryBudgetSettings(utils::RetryBudgetSettings settings);
+  void SetClientSideCache(std::shared_ptr<ClientSideCache> cache);
 
   Redis::State GetState() const;
 
@@ -50,6 +51,8 @@ class RedisConnectionHolder
       replication_monitoring_settings_;
   concurrent::Variable<utils::RetryBudgetSettings, std::mutex>
       retry_budget_settings_;
+  concurrent::Variable<std::shared_ptr<ClientSideCache>, std::mutex>
+      client_side_cache_;
   engine::ev::ThreadControl ev_thread_;
   std::shared_ptr<engine::ev::ThreadPool> redis_thread_pool_;
   const std::string host_;
@@ -164,6 +164,10 @@ void Statistics::AccountCommandSent(const CommandPtr& cmd) {
   }
 }
 
+void Statistics::AccountBatchSent(size_t commands_count) {
+  batch_size_percentile.GetCurrentCounter().Account(commands_count);
+}
+
 void Statistics::AccountReplyReceived(const ReplyPtr& reply,
                                       const CommandPtr& cmd) {
   reply_size_percentile.GetCurrentCounter().Account(reply->data.GetSize());
@@ -208,6 +212,7 @@ void DumpMetric(utils::statistics::Writer& writer,
 
   if (stats.settings.IsRequestSizesEnabled()) {
     writer["request_sizes"] = stats.request_size_percentile;
+    writer["batch_sizes"] = stats.batch_size_percentile;
   }
   if (stats.settings.IsReplySizesEnabled()) {
     writer["reply_sizes"] = stats.reply_size_percentile;
@@ -322,6 +327,15 @@ void DumpMetric(utils::statistics::Writer& writer,
     conn_stat.Add(stats.sentinel.value());
     writer.ValueWithLabels(conn_stat, {{"redis_instance_type", "sentinels"}});
   }
+
+  if (stats.client_side_cache) {
+    auto cache_writer = writer["client_side_cache"];
+    cache_writer["hits"] = stats.client_side_cache->hits;
+    cache_writer["misses"] = stats.client_side_cache->misses;
+    cache_writer["invalidations"] = stats.client_side_cache->invalidations;
+    cache_writer["flushes"] = stats.client_side_cache->flushes;
+    cache_writer["size"] = stats.client_side_cache->size;
+  }
 }
 
 }  // namespace redis
@@ -13,6 +13,7 @@
 #include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/reply_status_strings.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -31,6 +32,7 @@ class Statistics {
 
   void AccountStateChanged(RedisState new_state);
   void AccountCommandSent(const CommandPtr& cmd);
+  void AccountBatchSent(size_t commands_count);
   void AccountReplyReceived(const ReplyPtr& reply, const CommandPtr& cmd);
   void AccountPing(std::chrono::milliseconds ping);
   void AccountError(ReplyStatus code);
@@ -45,6 +47,7 @@ class Statistics {
   std::atomic<std::chrono::milliseconds> session_start_time{};
   RecentPeriod request_size_percentile;
   RecentPeriod reply_size_percentile;
+  RecentPeriod batch_size_percentile;
   RecentPeriod timings_percentile;
   std::unordered_map<std::string_view, RecentPeriod> command_timings_percentile;
   std::atomic_llong last_ping_ms{};
@@ -65,6 +68,7 @@ struct InstanceStatistics {
         other.session_start_time.load(std::memory_order_relaxed);
     request_size_percentile = other.request_size_percentile.GetStatsForPeriod();
     reply_size_percentile = other.reply_size_percentile.GetStatsForPeriod();
+    batch_size_percentile = other.batch_size_percentile.GetStatsForPeriod();
     timings_percentile = other.timings_percentile.GetStatsForPeriod();
     last_ping_ms = other.last_ping_ms.load(std::memory_order_relaxed);
     is_syncing = other.is_syncing.load(std::memory_order_relaxed);
@@ -83,6 +87,7 @@ struct InstanceStatistics {
     reconnects += other.reconnects;
     request_size_percentile.Add(other.request_size_percentile);
     reply_size_percentile.Add(other.reply_size_percentile);
+    batch_size_percentile.Add(other.batch_size_percentile);
     timings_percentile.Add(other.timings_percentile);
 
     for (size_t i = 0; i < error_count.size(); i++)
@@ -98,6 +103,7 @@ struct InstanceStatistics {
   std::chrono::milliseconds session_start_time{};
   Statistics::Percentile request_size_percentile;
   Statistics::Percentile reply_size_percentile;
+  Statistics::Percentile batch_size_percentile;
   Statistics::Percentile timings_percentile;
   std::unordered_map<std::string, Statistics::Percentile>
       command_timings_percentile;
@@ -143,6 +149,7 @@ struct SentinelStatistics {
   std::unordered_map<std::string, ShardStatistics> slaves;
   InstanceStatistics shard_group_total;
   SentinelStatisticsInternal internal;
+  std::optional<ClientSideCacheStatistics> client_side_cache;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -43,6 +43,29 @@ ReplyData::ReplyData(const redisReply* reply) {
       type_ = Type::kError;
       string_ = std::string(reply->str, reply->len);
       break;
+#ifdef REDIS_REPLY_MAP
+    // RESP3 types are mapped onto the closest RESP2 types. Some commands also
+    // return replies of another structure over RESP3, those are converted by
+    // ConvertResp3ReplyToResp2() on the connections with client tracking.
+    case REDIS_REPLY_MAP:
+    case REDIS_REPLY_SET:
+    case REDIS_REPLY_PUSH:
+      type_ = Type::kArray;
+      array_.reserve(reply->elements);
+      for (size_t i = 0; i < reply->elements; i++)
+        array_.emplace_back(reply->element[i]);
+      break;
+    case REDIS_REPLY_DOUBLE:
+    case REDIS_REPLY_BIGNUM:
+    case REDIS_REPLY_VERB:
+      type_ = Type::kString;
+      string_ = std::string(reply->str, reply->len);
+      break;
+    case REDIS_REPLY_BOOL:
+      type_ = Type::kInteger;
+      integer_ = reply->integer;
+      break;
+#endif
     default:
       type_ = Type::kNoReply;
       break;
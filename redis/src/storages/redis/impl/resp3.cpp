@@ -0,0 +1,106 @@
+#include <storages/redis/impl/resp3.hpp>
+
+#include <strings.h>
+
+#include <algorithm>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+namespace {
+
+bool IsCommand(const CmdArgs::CmdArgsArray& args, const char* name) {
+  return !strcasecmp(args[0].c_str(), name);
+}
+
+bool IsMulti(const CmdArgs::CmdArgsArray& args) {
+  return !args.empty() && IsCommand(args, "MULTI");
+}
+
+bool HasOption(const CmdArgs::CmdArgsArray& args, const char* option) {
+  return std::any_of(args.begin() + 1, args.end(), [option](const auto& arg) {
+    return !strcasecmp(arg.c_str(), option);
+  });
+}
+
+// RESP3 returns `[[member, score], ...]`, RESP2 - `[member, score, ...]`
+bool HasNestedPairs(const CmdArgs::CmdArgsArray& args) {
+  for (const auto* name :
+       {"ZRANGE", "ZRANGEBYSCORE", "ZREVRANGE", "ZREVRANGEBYSCORE",
+        "ZRANDMEMBER", "ZINTER", "ZUNION", "ZDIFF"}) {
+    if (IsCommand(args, name)) return HasOption(args, "WITHSCORES");
+  }
+  if (IsCommand(args, "HRANDFIELD")) return HasOption(args, "WITHVALUES");
+  // Without COUNT the reply is `[member, score]` in both protocols
+  return IsCommand(args, "ZPOPMIN") || IsCommand(args, "ZPOPMAX");
+}
+
+// RESP3 returns a map of the streams, RESP2 - `[[stream, entries], ...]`
+bool HasStreamsMap(const CmdArgs::CmdArgsArray& args) {
+  return IsCommand(args, "XREAD") || IsCommand(args, "XREADGROUP");
+}
+
+void FlattenPairs(ReplyData& data) {
+  if (!data.IsArray()) return;
+  auto& array = data.GetArray();
+  if (!std::all_of(array.begin(), array.end(),
+                   [](const auto& elem) { return elem.IsArray(); })) {
+    return;
+  }
+
+  ReplyData::Array result;
+  result.reserve(array.size() * 2);
+  for (auto& pair : array) {
+    for (auto& elem : pair.GetArray()) result.push_back(std::move(elem));
+  }
+  data = ReplyData(std::move(result));
+}
+
+void GroupPairs(ReplyData& data) {
+  if (!data.IsArray()) return;
+  auto& array = data.GetArray();
+  if (array.empty() || array.size() % 2 || array.front().IsArray()) return;
+
+  ReplyData::Array result;
+  result.reserve(array.size() / 2);
+  for (std::size_t i = 0; i < array.size(); i += 2) {
+    result.emplace_back(
+        ReplyData::Array{std::move(array[i]), std::move(array[i + 1])});
+  }
+  data = ReplyData(std::move(result));
+}
+
+void ConvertSingle(const CmdArgs::CmdArgsArray& args, ReplyData& data) {
+  if (HasNestedPairs(args)) {
+    FlattenPairs(data);
+  } else if (HasStreamsMap(args)) {
+    GroupPairs(data);
+  }
+}
+
+}  // namespace
+
+void ConvertResp3ReplyToResp2(const CmdArgs& args, std::size_t index,
+                              ReplyData& data) {
+  const auto& chain = args.args;
+  if (index >= chain.size() || chain[index].empty()) return;
+  if (!IsCommand(chain[index], "EXEC")) {
+    ConvertSingle(chain[index], data);
+    return;
+  }
+
+  if (!data.IsArray()) return;
+  auto multi = index;
+  while (multi > 0 && !IsMulti(chain[multi])) --multi;
+  if (!IsMulti(chain[multi])) return;
+
+  auto& replies = data.GetArray();
+  for (std::size_t i = 0; i < replies.size() && multi + 1 + i < index; ++i) {
+    ConvertSingle(chain[multi + 1 + i], replies[i]);
+  }
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
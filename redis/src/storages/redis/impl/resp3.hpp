@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+
+#include <userver/storages/redis/impl/base.hpp>
+#include <userver/storages/redis/impl/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// HELLO 3 changes the replies of all the commands of a connection, not only
+/// the tracked ones. RESP3 types are converted to RESP2 types by ReplyData,
+/// and this function restores the RESP2 shape of the replies that differ in
+/// structure, e.g. ZRANGE WITHSCORES returns `[[member, score], ...]` instead
+/// of `[member, score, ...]`. RESP2 replies are left unchanged.
+///
+/// `index` is the position of the command in `args`. The reply of EXEC is
+/// converted element by element, according to the commands after MULTI.
+void ConvertResp3ReplyToResp2(const CmdArgs& args, std::size_t index,
+                              ReplyData& data);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,105 @@
+#include <storages/redis/impl/resp3.hpp>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/storages/redis/parse_reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using redis::ReplyData;
+
+// `[[member, score], ...]`, as returned over RESP3
+ReplyData MakeResp3Pairs() {
+  return ReplyData{ReplyData::Array{
+      ReplyData{ReplyData::Array{ReplyData{"a"}, ReplyData{"1.5"}}},
+      ReplyData{ReplyData::Array{ReplyData{"b"}, ReplyData{"2"}}},
+  }};
+}
+
+std::vector<storages::redis::MemberScore> ParseMemberScores(ReplyData data) {
+  return storages::redis::ParseReplyDataArray(
+      std::move(data), "test",
+      storages::redis::To<std::vector<storages::redis::MemberScore>>{});
+}
+
+const std::vector<storages::redis::MemberScore> kMemberScores{{"a", 1.5},
+                                                               {"b", 2}};
+
+}  // namespace
+
+TEST(Resp3, ZrangeWithScores) {
+  auto data = MakeResp3Pairs();
+  redis::ConvertResp3ReplyToResp2(
+      redis::CmdArgs{"ZRANGE", "key", "0", "-1", "withscores"}, 0, data);
+  EXPECT_EQ(ParseMemberScores(std::move(data)), kMemberScores);
+
+  data = MakeResp3Pairs();
+  redis::ConvertResp3ReplyToResp2(
+      redis::CmdArgs{"ZRANGEBYSCORE", "key", "-inf", "+inf", "WITHSCORES"}, 0,
+      data);
+  EXPECT_EQ(ParseMemberScores(std::move(data)), kMemberScores);
+}
+
+TEST(Resp3, ZpopminHrandfield) {
+  for (const auto* command : {"ZPOPMIN", "ZPOPMAX"}) {
+    auto data = MakeResp3Pairs();
+    redis::ConvertResp3ReplyToResp2(redis::CmdArgs{command, "key", "2"}, 0,
+                                    data);
+    EXPECT_EQ(ParseMemberScores(std::move(data)), kMemberScores) << command;
+  }
+
+  auto data = MakeResp3Pairs();
+  redis::ConvertResp3ReplyToResp2(
+      redis::CmdArgs{"HRANDFIELD", "key", "2", "WITHVALUES"}, 0, data);
+  ASSERT_TRUE(data.IsArray());
+  EXPECT_EQ(data.GetArray().size(), 4);
+}
+
+TEST(Resp3, Resp2RepliesUnchanged) {
+  const ReplyData::Array resp2{ReplyData{"a"}, ReplyData{"1.5"},
+                               ReplyData{"b"}, ReplyData{"2"}};
+  auto data = ReplyData{ReplyData::Array(resp2)};
+  redis::ConvertResp3ReplyToResp2(
+      redis::CmdArgs{"ZRANGE", "key", "0", "-1", "WITHSCORES"}, 0, data);
+  EXPECT_EQ(ParseMemberScores(std::move(data)), kMemberScores);
+
+  // The reply of GEOPOS is nested in both protocols
+  data = MakeResp3Pairs();
+  redis::ConvertResp3ReplyToResp2(redis::CmdArgs{"GEOPOS", "key", "a", "b"}, 0,
+                                  data);
+  ASSERT_TRUE(data.IsArray());
+  EXPECT_EQ(data.GetArray().size(), 2);
+}
+
+TEST(Resp3, Xread) {
+  auto data = ReplyData{ReplyData::Array{
+      ReplyData{"stream"},
+      ReplyData{ReplyData::Array{}},
+  }};
+  redis::ConvertResp3ReplyToResp2(
+      redis::CmdArgs{"XREAD", "STREAMS", "stream", "0"}, 0, data);
+  ASSERT_TRUE(data.IsArray());
+  ASSERT_EQ(data.GetArray().size(), 1);
+  ASSERT_TRUE(data.GetArray()[0].IsArray());
+  EXPECT_EQ(data.GetArray()[0].GetArray()[0].GetString(), "stream");
+}
+
+TEST(Resp3, Transaction) {
+  redis::CmdArgs args{"MULTI"};
+  args.Then("SET", "key", "value");
+  args.Then("ZRANGE", "key", "0", "-1", "WITHSCORES");
+  args.Then("EXEC");
+
+  auto data = ReplyData{
+      ReplyData::Array{ReplyData::CreateStatus("OK"), MakeResp3Pairs()}};
+  redis::ConvertResp3ReplyToResp2(args, 3, data);
+  ASSERT_TRUE(data.IsArray());
+  EXPECT_EQ(ParseMemberScores(std::move(data.GetArray()[1])), kMemberScores);
+}
+
+USERVER_NAMESPACE_END
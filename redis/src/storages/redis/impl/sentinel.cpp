@@ -16,6 +16,7 @@
 #include <userver/utils/impl/userver_experiments.hpp>
 
 #include <storages/redis/dynamic_config.hpp>
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/cluster_sentinel_impl.hpp>
 #include <storages/redis/impl/command.hpp>
 #include <storages/redis/impl/redis.hpp>
@@ -307,7 +308,11 @@ const std::string& Sentinel::GetAnyKeyForShard(size_t shard_idx) const {
 
 SentinelStatistics Sentinel::GetStatistics(
     const MetricsSettings& settings) const {
-  return impl_->GetStatistics(settings);
+  auto stats = impl_->GetStatistics(settings);
+  if (client_side_cache_) {
+    stats.client_side_cache = client_side_cache_->GetStatistics();
+  }
+  return stats;
 }
 
 void Sentinel::SetCommandsBufferingSettings(
@@ -325,6 +330,15 @@ void Sentinel::SetRetryBudgetSettings(
   impl_->SetRetryBudgetSettings(settings);
 }
 
+void Sentinel::SetClientSideCache(std::shared_ptr<ClientSideCache> cache) {
+  client_side_cache_ = cache;
+  impl_->SetClientSideCache(std::move(cache));
+}
+
+std::shared_ptr<ClientSideCache> Sentinel::GetClientSideCache() const {
+  return client_side_cache_;
+}
+
 std::vector<Request> Sentinel::MakeRequests(
     CmdArgs&& args, bool master, const CommandControl& command_control,
     size_t replies_to_skip) {
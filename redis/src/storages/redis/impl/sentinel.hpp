@@ -40,6 +40,7 @@ const auto kProcessWaitingCommandsInterval = std::chrono::seconds(3);
 const auto kCheckRedisConnectedInterval = std::chrono::seconds(3);
 
 // Forward declarations
+class ClientSideCache;
 class SentinelImplBase;
 class SentinelImpl;
 class Shard;
@@ -141,6 +142,11 @@ class Sentinel {
       const ReplicationMonitoringSettings& replication_monitoring_settings);
   void SetRetryBudgetSettings(const utils::RetryBudgetSettings& settings);
 
+  // Enables RESP3 client tracking for all the connections and stores replies
+  // to GET/HGET into the `cache`. Must be called before the first request.
+  void SetClientSideCache(std::shared_ptr<ClientSideCache> cache);
+  std::shared_ptr<ClientSideCache> GetClientSideCache() const;
+
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   boost::signals2::signal<void(size_t shard)> signal_instances_changed;
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
@@ -229,6 +235,7 @@ class Sentinel {
   utils::SwappingSmart<CommandControl> config_default_command_control_;
   std::atomic_int publish_shard_{0};
   testsuite::RedisControl testsuite_redis_control_;
+  std::shared_ptr<ClientSideCache> client_side_cache_;
 };
 
 }  // namespace redis
@@ -556,6 +556,10 @@ void SentinelImpl::SetRetryBudgetSettings(
     shard->SetRetryBudgetSettings(retry_budget_settings);
 }
 
+void SentinelImpl::SetClientSideCache(std::shared_ptr<ClientSideCache> cache) {
+  for (auto& shard : master_shards_) shard->SetClientSideCache(cache);
+}
+
 PublishSettings SentinelImpl::GetPublishSettings() {
   /// Why do we always publish to master? We can actually publish to any host in
   /// shard to distribute load evenly
@@ -91,6 +91,7 @@ class SentinelImplBase {
       const ReplicationMonitoringSettings& replication_monitoring_settings) = 0;
   virtual void SetRetryBudgetSettings(
       const utils::RetryBudgetSettings& retry_budget_settings) = 0;
+  virtual void SetClientSideCache(std::shared_ptr<ClientSideCache> cache) = 0;
 
   virtual PublishSettings GetPublishSettings() = 0;
 };
@@ -148,6 +149,7 @@ class SentinelImpl : public SentinelImplBase {
       override;
   void SetRetryBudgetSettings(
       const utils::RetryBudgetSettings& retry_budget_settings) override;
+  void SetClientSideCache(std::shared_ptr<ClientSideCache> cache) override;
   PublishSettings GetPublishSettings() override;
 
  private:
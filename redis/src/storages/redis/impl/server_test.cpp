@@ -1,5 +1,6 @@
 #include "mock_server_test.hpp"
 
+#include <atomic>
 #include <thread>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -152,6 +153,45 @@ TEST(Redis, PingFail) {
   PeriodicWait([&] { return !IsConnected(*redis); });
 }
 
+TEST(Redis, CommandsBuffering) {
+  MockRedisServer server;
+  auto ping_handler = server.RegisterPingHandler();
+  auto get_handler = server.RegisterNilReplyHandler("GET");
+
+  auto pool = std::make_shared<redis::ThreadPools>(1, 1);
+  redis::RedisCreationSettings redis_settings;
+  auto redis = std::make_shared<redis::Redis>(pool->GetRedisThreadPool(),
+                                              redis_settings);
+  redis::CommandsBufferingSettings buffering_settings;
+  buffering_settings.buffering_enabled = true;
+  buffering_settings.watch_command_timer_interval = std::chrono::seconds{60};
+  redis->SetCommandsBufferingSettings(buffering_settings);
+  redis->Connect({kLocalhost}, server.GetPort(), redis::Password(""));
+  PeriodicWait([&] { return IsConnected(*redis); });
+
+  std::atomic<int> replies{0};
+  const auto send_get = [&](const redis::CommandControl& cc) {
+    redis->AsyncCommand(redis::PrepareCommand(
+        {"GET", "123"},
+        [&replies](const redis::CommandPtr&, redis::ReplyPtr) { ++replies; },
+        cc));
+  };
+
+  redis::CommandControl threshold_cc;
+  threshold_cc.commands_buffering_threshold = 3;
+  send_get(threshold_cc);
+  send_get(threshold_cc);
+  PeriodicCheck([&] { return replies == 0; });
+
+  send_get(threshold_cc);
+  PeriodicWait([&] { return replies == 3; });
+
+  redis::CommandControl unbuffered_cc;
+  unbuffered_cc.commands_buffering_interval = std::chrono::microseconds::zero();
+  send_get(unbuffered_cc);
+  PeriodicWait([&] { return replies == 4; });
+}
+
 class RedisDisconnectingReplies : public ::testing::TestWithParam<const char*> {
 };
 
@@ -305,6 +305,8 @@ bool Shard::ProcessCreation(
           *commands_buffering_settings);
     if (auto retry_budet_settings = retry_budet_settings_.Get())
       entry.instance->SetRetryBudgetSettings(*retry_budet_settings);
+    if (auto client_side_cache = client_side_cache_.Get())
+      entry.instance->SetClientSideCache(std::move(client_side_cache));
     auto server_id = entry.instance->GetServerId();
     entry.instance->signal_state_change.connect(
         [this, server_id](Redis::State state) {
@@ -450,6 +452,19 @@ void Shard::SetCommandsBufferingSettings(
       std::make_shared<CommandsBufferingSettings>(commands_buffering_settings));
 }
 
+void Shard::SetClientSideCache(std::shared_ptr<ClientSideCache> cache) {
+  std::shared_lock lock(mutex_);
+
+  for (const auto& instance : instances_) {
+    instance.instance->SetClientSideCache(cache);
+  }
+  for (const auto& instance : clean_wait_) {
+    instance.instance->SetClientSideCache(cache);
+  }
+
+  client_side_cache_.Set(std::move(cache));
+}
+
 void Shard::SetReplicationMonitoringSettings(
     const ReplicationMonitoringSettings& replication_monitoring_settings) {
   std::shared_lock lock(mutex_);
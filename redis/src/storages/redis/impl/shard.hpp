@@ -101,6 +101,7 @@ class Shard {
       const ReplicationMonitoringSettings& replication_monitoring_settings);
   void SetRetryBudgetSettings(
       const utils::RetryBudgetSettings& replication_monitoring_settings);
+  void SetClientSideCache(std::shared_ptr<ClientSideCache> cache);
 
  private:
   std::vector<unsigned char> GetAvailableServers(
@@ -135,6 +136,7 @@ class Shard {
 
   utils::SwappingSmart<CommandsBufferingSettings> commands_buffering_settings_;
   utils::SwappingSmart<utils::RetryBudgetSettings> retry_budet_settings_;
+  utils::SwappingSmart<ClientSideCache> client_side_cache_;
 
   bool prev_connected_ = false;
   const bool cluster_mode_ = false;
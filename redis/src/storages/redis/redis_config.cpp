@@ -55,6 +55,11 @@ USERVER_NAMESPACE::redis::CommandControl Parse(
       }
     } else if (name == "allow_reads_from_master") {
       result.allow_reads_from_master = option.As<bool>();
+    } else if (name == "commands_buffering_interval_us") {
+      result.commands_buffering_interval =
+          std::chrono::microseconds{option.As<size_t>()};
+    } else if (name == "commands_buffering_threshold") {
+      result.commands_buffering_threshold = option.As<size_t>();
     } else {
       LOG_WARNING() << "unknown key for CommandControl map: " << name;
     }
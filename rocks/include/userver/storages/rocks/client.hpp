@@ -3,21 +3,102 @@
 /// @file userver/storages/rocks/client.hpp
 /// @brief @copybrief storages::rocks::Client
 
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <rocksdb/db.h>
+#include <rocksdb/write_batch.h>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+/// @brief Settings of the RocksDB database opened by the Client.
+struct ClientSettings final {
+  /// Create the database if it does not exist
+  bool create_if_missing{true};
+
+  /// Capacity of the LRU block cache in bytes, 0 for the RocksDB default
+  std::size_t block_cache_size{0};
+
+  /// Bits per key of the bloom filter of the tables, 0 disables the filter
+  double bloom_filter_bits_per_key{0};
+
+  /// Column families to open or create in addition to the default one
+  std::vector<std::string> column_families;
+};
+
+/**
+ * @brief Handle of a column family of the database.
+ *
+ * Handles are obtained by Client::GetColumnFamily and are valid while the
+ * client is alive. A default-constructed handle refers to the default column
+ * family.
+ */
+class ColumnFamily final {
+ public:
+  ColumnFamily() = default;
+
+ private:
+  friend class Client;
+  friend class WriteBatch;
+
+  explicit ColumnFamily(rocksdb::ColumnFamilyHandle* handle)
+      : handle_(handle) {}
+
+  rocksdb::ColumnFamilyHandle* handle_ = nullptr;
+};
+
+/**
+ * @brief Set of updates applied atomically by Client::Write.
+ */
+class WriteBatch final {
+ public:
+  /**
+   * @brief Adds a record to put into the database.
+   *
+   * @param key The key of the record.
+   * @param value The value of the record.
+   * @param column_family The column family of the record.
+   */
+  void Put(std::string_view key, std::string_view value,
+           ColumnFamily column_family = {});
+
+  /**
+   * @brief Adds a record to delete from the database.
+   *
+   * @param key The key of the record to be deleted.
+   * @param column_family The column family of the record.
+   */
+  void Delete(std::string_view key, ColumnFamily column_family = {});
+
+  /// @brief Returns the number of updates in the batch.
+  std::size_t Size() const;
+
+ private:
+  friend class Client;
+
+  rocksdb::WriteBatch batch_;
+};
+
 /**
  * @brief Client for working with RocksDB storage.
  *
  * This class provides an interface for interacting with the RocksDB database.
  * To use the class, you need to specify the database path when creating an
  * object.
+ *
+ * All the calls to RocksDB are done in the blocking task processor, so disk
+ * stalls do not block the threads of the caller's task processor.
  */
 class Client final {
  public:
@@ -25,23 +106,69 @@ class Client final {
    * @brief Constructor of the Client class.
    *
    * @param db_path The path to the RocksDB database.
+   * @param blocking_task_processor The task processor for RocksDB calls.
+   * @param settings The database settings.
    */
-  explicit Client(const std::string& db_path);
+  Client(const std::string& db_path,
+         engine::TaskProcessor& blocking_task_processor,
+         const ClientSettings& settings = {});
+
+  Client(const Client&) = delete;
+  Client& operator=(const Client&) = delete;
+
+  ~Client();
+
+  /**
+   * @brief Returns the column family opened by the client.
+   *
+   * @param name The name of the column family from ClientSettings.
+   * @throws impl::Exception if the column family is not opened.
+   */
+  ColumnFamily GetColumnFamily(std::string_view name) const;
 
   /**
    * @brief Puts a record into the database.
    *
    * @param key The key of the record.
    * @param value The value of the record.
+   * @param column_family The column family of the record.
    */
-  void Put(std::string_view key, std::string_view value);
+  void Put(std::string_view key, std::string_view value,
+           ColumnFamily column_family = {});
 
   /**
    * @brief Retrieves the value of a record from the database by key.
    *
    * @param key The key of the record.
+   * @param column_family The column family of the record.
+   * @returns The value or an empty string if there is no such record.
    */
-  std::string Get(std::string_view key);
+  std::string Get(std::string_view key, ColumnFamily column_family = {});
+
+  /**
+   * @brief Retrieves the values of several records in a single call.
+   *
+   * @param keys The keys of the records.
+   * @param column_family The column family of the records.
+   * @returns The values in the order of keys, std::nullopt for missing
+   * records.
+   */
+  std::vector<std::optional<std::string>> MultiGet(
+      const std::vector<std::string_view>& keys,
+      ColumnFamily column_family = {});
+
+  /**
+   * @brief Retrieves the records whose keys start with the prefix, in the
+   * order of keys.
+   *
+   * @param prefix The prefix of the keys.
+   * @param limit The maximum number of records to retrieve.
+   * @param column_family The column family of the records.
+   */
+  std::vector<std::pair<std::string, std::string>> GetByPrefix(
+      std::string_view prefix,
+      std::size_t limit = std::numeric_limits<std::size_t>::max(),
+      ColumnFamily column_family = {});
 
   /**
    * Checks the status of an operation and handles any errors based on the given
@@ -56,13 +183,25 @@ class Client final {
    * @brief Deletes a record from the database by key.
    *
    * @param key The key of the record to be deleted.
+   * @param column_family The column family of the record.
    */
-  void Delete(std::string_view key);
+  void Delete(std::string_view key, ColumnFamily column_family = {});
 
-  virtual ~Client() { delete db_; }
+  /**
+   * @brief Atomically applies all the updates of the batch.
+   *
+   * @param batch The batch of updates.
+   */
+  void Write(WriteBatch& batch);
 
  private:
-  rocksdb::DB* db_ = nullptr;
+  rocksdb::ColumnFamilyHandle* GetHandle(ColumnFamily column_family) const;
+
+  engine::TaskProcessor& blocking_task_processor_;
+  std::unique_ptr<rocksdb::DB> db_;
+  std::vector<rocksdb::ColumnFamilyHandle*> handles_;
+  std::unordered_map<std::string, rocksdb::ColumnFamilyHandle*>
+      column_families_;
 };
 }  // namespace storages::rocks
 
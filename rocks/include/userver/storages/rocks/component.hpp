@@ -0,0 +1,57 @@
+#pragma once
+
+/// @file userver/storages/rocks/component.hpp
+/// @brief @copybrief components::Rocks
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/storages/rocks/client_fwd.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that opens a RocksDB database and provides
+/// storages::rocks::Client to work with it
+///
+/// ## Static options:
+///
+/// Name                      | Description                                                | Default value
+/// ------------------------- | ---------------------------------------------------------- | -------------
+/// db-path                   | path to the database directory                             | --
+/// task-processor            | task processor to do the blocking RocksDB calls            | fs-task-processor
+/// create-if-missing         | create the database if it does not exist                   | true
+/// block-cache-size          | capacity of the LRU block cache in bytes, 0 for the default | 0
+/// bloom-filter-bits-per-key | bits per key of the table bloom filters, 0 to disable      | 0
+/// column-families           | column families to open besides the default one            | []
+
+// clang-format on
+
+class Rocks final : public LoggableComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of components::Rocks
+  static constexpr std::string_view kName = "rocks";
+
+  Rocks(const ComponentConfig& config, const ComponentContext& context);
+
+  ~Rocks() override;
+
+  storages::rocks::ClientPtr GetClient() const;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  storages::rocks::ClientPtr client_;
+};
+
+template <>
+inline constexpr bool kHasValidate<Rocks> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
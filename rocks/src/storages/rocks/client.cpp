@@ -1,51 +1,196 @@
 #include <userver/storages/rocks/client.hpp>
 
 #include <fmt/format.h>
+#include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/table.h>
 
+#include <userver/engine/async.hpp>
 #include <userver/storages/rocks/impl/exception.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
-Client::Client(const std::string& db_path) {
+namespace {
+
+rocksdb::Options MakeOptions(const ClientSettings& settings) {
   rocksdb::Options options;
-  options.create_if_missing = true;
-  // TODO: Do in another task processor, in the current implementation blocking
-  // wait in the current coroutine
-  rocksdb::Status status = rocksdb::DB::Open(options, db_path, &db_);
+  options.create_if_missing = settings.create_if_missing;
+  options.create_missing_column_families = true;
+
+  rocksdb::BlockBasedTableOptions table_options;
+  if (settings.block_cache_size != 0) {
+    table_options.block_cache = rocksdb::NewLRUCache(settings.block_cache_size);
+  }
+  if (settings.bloom_filter_bits_per_key > 0) {
+    table_options.filter_policy.reset(
+        rocksdb::NewBloomFilterPolicy(settings.bloom_filter_bits_per_key));
+  }
+  options.table_factory.reset(
+      rocksdb::NewBlockBasedTableFactory(table_options));
+  return options;
+}
+
+}  // namespace
+
+void WriteBatch::Put(std::string_view key, std::string_view value,
+                     ColumnFamily column_family) {
+  rocksdb::Status status;
+  if (column_family.handle_) {
+    status = batch_.Put(column_family.handle_, key, value);
+  } else {
+    status = batch_.Put(key, value);
+  }
+  if (!status.ok()) {
+    throw impl::RequestFailedException("WriteBatch::Put", status.ToString());
+  }
+}
+
+void WriteBatch::Delete(std::string_view key, ColumnFamily column_family) {
+  rocksdb::Status status;
+  if (column_family.handle_) {
+    status = batch_.Delete(column_family.handle_, key);
+  } else {
+    status = batch_.Delete(key);
+  }
+  if (!status.ok()) {
+    throw impl::RequestFailedException("WriteBatch::Delete", status.ToString());
+  }
+}
+
+std::size_t WriteBatch::Size() const { return batch_.Count(); }
+
+Client::Client(const std::string& db_path,
+               engine::TaskProcessor& blocking_task_processor,
+               const ClientSettings& settings)
+    : blocking_task_processor_(blocking_task_processor) {
+  const auto options = MakeOptions(settings);
+
+  std::vector<rocksdb::ColumnFamilyDescriptor> descriptors;
+  descriptors.emplace_back(rocksdb::kDefaultColumnFamilyName, options);
+  for (const auto& name : settings.column_families) {
+    descriptors.emplace_back(name, options);
+  }
+
+  rocksdb::DB* db = nullptr;
+  rocksdb::Status status =
+      engine::AsyncNoSpan(blocking_task_processor_, [&] {
+        return rocksdb::DB::Open(options, db_path, descriptors, &handles_,
+                                 &db);
+      }).Get();
+  db_.reset(db);
   CheckStatus(status, "Create client");
+
+  for (auto* handle : handles_) {
+    column_families_.emplace(handle->GetName(), handle);
+  }
+}
+
+Client::~Client() {
+  if (!db_) return;
+  for (auto* handle : handles_) {
+    db_->DestroyColumnFamilyHandle(handle);
+  }
 }
 
-void Client::Put(std::string_view key, std::string_view value) {
-  // TODO: Do in another task processor, in the current implementation blocking
-  // wait in the current coroutine
-  rocksdb::Status status = db_->Put(rocksdb::WriteOptions(), key, value);
+ColumnFamily Client::GetColumnFamily(std::string_view name) const {
+  const auto it = column_families_.find(std::string{name});
+  if (it == column_families_.end()) {
+    throw impl::Exception(
+        fmt::format("Column family '{}' is not opened", name));
+  }
+  return ColumnFamily{it->second};
+}
+
+void Client::Put(std::string_view key, std::string_view value,
+                 ColumnFamily column_family) {
+  rocksdb::Status status =
+      engine::AsyncNoSpan(blocking_task_processor_, [&] {
+        return db_->Put(rocksdb::WriteOptions(), GetHandle(column_family), key,
+                        value);
+      }).Get();
   CheckStatus(status, "Put");
 }
 
-std::string Client::Get(std::string_view key) {
+std::string Client::Get(std::string_view key, ColumnFamily column_family) {
   std::string res;
-  // TODO: Do in another task processor, in the current implementation blocking
-  // wait in the current coroutine
-  rocksdb::Status status = db_->Get(rocksdb::ReadOptions(), key, &res);
+  rocksdb::Status status =
+      engine::AsyncNoSpan(blocking_task_processor_, [&] {
+        return db_->Get(rocksdb::ReadOptions(), GetHandle(column_family), key,
+                        &res);
+      }).Get();
   CheckStatus(status, "Get");
   return res;
 }
 
-void Client::Delete(std::string_view key) {
-  // TODO: Do in another task processor, in the current implementation blocking
-  // wait in the current coroutine
-  rocksdb::Status status = db_->Delete(rocksdb::WriteOptions(), key);
+std::vector<std::optional<std::string>> Client::MultiGet(
+    const std::vector<std::string_view>& keys, ColumnFamily column_family) {
+  const std::vector<rocksdb::ColumnFamilyHandle*> handles(
+      keys.size(), GetHandle(column_family));
+  const std::vector<rocksdb::Slice> slices(keys.begin(), keys.end());
+  std::vector<std::string> values;
+  const auto statuses =
+      engine::AsyncNoSpan(blocking_task_processor_, [&] {
+        return db_->MultiGet(rocksdb::ReadOptions(), handles, slices, &values);
+      }).Get();
+
+  std::vector<std::optional<std::string>> result(keys.size());
+  for (std::size_t i = 0; i < statuses.size(); ++i) {
+    CheckStatus(statuses[i], "MultiGet");
+    if (statuses[i].ok()) result[i] = std::move(values[i]);
+  }
+  return result;
+}
+
+std::vector<std::pair<std::string, std::string>> Client::GetByPrefix(
+    std::string_view prefix, std::size_t limit, ColumnFamily column_family) {
+  std::vector<std::pair<std::string, std::string>> result;
+  rocksdb::Status status =
+      engine::AsyncNoSpan(blocking_task_processor_, [&] {
+        const std::unique_ptr<rocksdb::Iterator> it{db_->NewIterator(
+            rocksdb::ReadOptions(), GetHandle(column_family))};
+        for (it->Seek(prefix);
+             it->Valid() && result.size() < limit &&
+             it->key().starts_with(rocksdb::Slice(prefix));
+             it->Next()) {
+          result.emplace_back(it->key().ToString(), it->value().ToString());
+        }
+        return it->status();
+      }).Get();
+  CheckStatus(status, "GetByPrefix");
+  return result;
+}
+
+void Client::Delete(std::string_view key, ColumnFamily column_family) {
+  rocksdb::Status status =
+      engine::AsyncNoSpan(blocking_task_processor_, [&] {
+        return db_->Delete(rocksdb::WriteOptions(), GetHandle(column_family),
+                           key);
+      }).Get();
   CheckStatus(status, "Delete");
 }
 
+void Client::Write(WriteBatch& batch) {
+  rocksdb::Status status =
+      engine::AsyncNoSpan(blocking_task_processor_, [&] {
+        return db_->Write(rocksdb::WriteOptions(), &batch.batch_);
+      }).Get();
+  CheckStatus(status, "Write");
+}
+
 void Client::CheckStatus(rocksdb::Status status, std::string_view method_name) {
   if (!status.ok() && !status.IsNotFound()) {
     throw USERVER_NAMESPACE::storages::rocks::impl::RequestFailedException(
         method_name, status.ToString());
   }
 }
+
+rocksdb::ColumnFamilyHandle* Client::GetHandle(
+    ColumnFamily column_family) const {
+  return column_family.handle_ ? column_family.handle_
+                               : db_->DefaultColumnFamily();
+}
 }  // namespace storages::rocks
 
 USERVER_NAMESPACE_END
@@ -1,3 +1,5 @@
+#include <userver/engine/task/task.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
 #include <userver/storages/rocks/client.hpp>
 #include <userver/storages/rocks/impl/exception.hpp>
 #include <userver/utest/utest.hpp>
@@ -7,8 +9,8 @@ USERVER_NAMESPACE_BEGIN
 namespace {
 
 UTEST(Rocks, CheckCRUD) {
-  storages::rocks::Client client =
-      storages::rocks::Client("/tmp/rocksdb_simple_example");
+  storages::rocks::Client client{"/tmp/rocksdb_simple_example",
+                                 engine::current_task::GetTaskProcessor()};
 
   std::string key = "key";
   std::string res = client.Get(key);
@@ -24,6 +26,58 @@ UTEST(Rocks, CheckCRUD) {
   EXPECT_EQ("", res);
 }
 
+UTEST(Rocks, BatchesAndPrefixes) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  storages::rocks::Client client{dir.GetPath(),
+                                 engine::current_task::GetTaskProcessor()};
+
+  storages::rocks::WriteBatch batch;
+  batch.Put("user:1", "a");
+  batch.Put("user:2", "b");
+  batch.Put("user:3", "c");
+  batch.Put("vendor:1", "d");
+  batch.Delete("user:3");
+  EXPECT_EQ(batch.Size(), 5);
+  client.Write(batch);
+
+  const auto values = client.MultiGet({"user:1", "user:3", "vendor:1"});
+  ASSERT_EQ(values.size(), 3);
+  EXPECT_EQ(values[0], "a");
+  EXPECT_EQ(values[1], std::nullopt);
+  EXPECT_EQ(values[2], "d");
+
+  using Records = std::vector<std::pair<std::string, std::string>>;
+  EXPECT_EQ(client.GetByPrefix("user:"),
+            (Records{{"user:1", "a"}, {"user:2", "b"}}));
+  EXPECT_EQ(client.GetByPrefix("user:", 1), (Records{{"user:1", "a"}}));
+  EXPECT_EQ(client.GetByPrefix("unknown:"), Records{});
+}
+
+UTEST(Rocks, ColumnFamilies) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  storages::rocks::ClientSettings settings;
+  settings.block_cache_size = 1 << 20;
+  settings.bloom_filter_bits_per_key = 10;
+  settings.column_families = {"sessions"};
+  storages::rocks::Client client{
+      dir.GetPath(), engine::current_task::GetTaskProcessor(), settings};
+
+  const auto sessions = client.GetColumnFamily("sessions");
+  UEXPECT_THROW(client.GetColumnFamily("unknown"),
+                storages::rocks::impl::Exception);
+
+  client.Put("key", "default");
+  client.Put("key", "session", sessions);
+  EXPECT_EQ(client.Get("key"), "default");
+  EXPECT_EQ(client.Get("key", sessions), "session");
+
+  storages::rocks::WriteBatch batch;
+  batch.Delete("key", sessions);
+  client.Write(batch);
+  EXPECT_EQ(client.Get("key"), "default");
+  EXPECT_EQ(client.Get("key", sessions), "");
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,80 @@
+#include <userver/storages/rocks/component.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/storages/rocks/client.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace {
+
+storages::rocks::ClientSettings ParseSettings(const ComponentConfig& config) {
+  storages::rocks::ClientSettings settings;
+  settings.create_if_missing = config["create-if-missing"].As<bool>(true);
+  settings.block_cache_size =
+      config["block-cache-size"].As<std::size_t>(settings.block_cache_size);
+  settings.bloom_filter_bits_per_key =
+      config["bloom-filter-bits-per-key"].As<double>(
+          settings.bloom_filter_bits_per_key);
+  settings.column_families =
+      config["column-families"].As<std::vector<std::string>>({});
+  return settings;
+}
+
+}  // namespace
+
+Rocks::Rocks(const ComponentConfig& config, const ComponentContext& context)
+    : LoggableComponentBase(config, context),
+      client_(std::make_shared<storages::rocks::Client>(
+          config["db-path"].As<std::string>(),
+          context.GetTaskProcessor(
+              config["task-processor"].As<std::string>("fs-task-processor")),
+          ParseSettings(config))) {}
+
+Rocks::~Rocks() = default;
+
+storages::rocks::ClientPtr Rocks::GetClient() const { return client_; }
+
+yaml_config::Schema Rocks::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<LoggableComponentBase>(R"(
+type: object
+description: RocksDB component
+additionalProperties: false
+properties:
+    db-path:
+        type: string
+        description: path to the database directory
+    task-processor:
+        type: string
+        description: task processor to do the blocking RocksDB calls
+        defaultDescription: fs-task-processor
+    create-if-missing:
+        type: boolean
+        description: create the database if it does not exist
+        defaultDescription: true
+    block-cache-size:
+        type: integer
+        description: capacity of the LRU block cache in bytes, 0 for the default
+        defaultDescription: 0
+        minimum: 0
+    bloom-filter-bits-per-key:
+        type: number
+        description: bits per key of the table bloom filters, 0 to disable
+        defaultDescription: 0
+        minimum: 0
+    column-families:
+        type: array
+        description: column families to open besides the default one
+        defaultDescription: '[]'
+        items:
+            type: string
+            description: column family name
+)");
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
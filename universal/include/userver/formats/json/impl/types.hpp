@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <type_traits>
 
@@ -25,11 +26,33 @@ using formats::common::Type;
 class Value;
 
 namespace impl {
+
+class Arena;
+
+/// rapidjson allocator of all the values. Allocates from the heap, or from
+/// the arena of the document that is being parsed or built on the current
+/// thread. Stateless, so values of different documents may be mixed freely.
+///
+/// @see LargeJson* and BuildLargeJson* in serialize_benchmark.cpp for the
+/// cost compared to rapidjson::CrtAllocator
+class Allocator final {
+ public:
+  static constexpr bool kNeedFree = true;
+
+  void* Malloc(std::size_t size);
+  void* Realloc(void* original_ptr, std::size_t original_size,
+                std::size_t new_size);
+  static void Free(void* ptr) noexcept;
+
+  bool operator==(const Allocator&) const noexcept { return true; }
+  bool operator!=(const Allocator&) const noexcept { return false; }
+};
+
 // rapidjson integration
 using UTF8 = ::rapidjson::UTF8<char>;
-using Value = ::rapidjson::GenericValue<UTF8, ::rapidjson::CrtAllocator>;
-using Document = ::rapidjson::GenericDocument<UTF8, ::rapidjson::CrtAllocator,
-                                              ::rapidjson::CrtAllocator>;
+using Value = ::rapidjson::GenericValue<UTF8, Allocator>;
+using Document =
+    ::rapidjson::GenericDocument<UTF8, Allocator, ::rapidjson::CrtAllocator>;
 
 class VersionedValuePtr final {
  public:
@@ -50,6 +73,11 @@ class VersionedValuePtr final {
   explicit operator bool() const;
   bool IsUnique() const;
 
+  /// Whether the tree is allocated from an arena. Such trees are modified only
+  /// by ValueBuilder with the arena scope active.
+  bool IsArenaAllocated() const;
+  Arena* GetArena() const;
+
   const impl::Value* Get() const;
   impl::Value* Get();
 
@@ -5,6 +5,7 @@
 
 #include <iosfwd>
 #include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -27,6 +28,29 @@ constexpr inline std::size_t kDepthParseLimit = 128;
 /// Parse JSON from string
 formats::json::Value FromString(std::string_view doc);
 
+/// @brief Parse JSON from string, allocating all the nodes of the document
+/// from an arena.
+///
+/// The document is freed in one shot when the last Value referencing it is
+/// destroyed, and the arena chunks are reused by the next parses on the same
+/// thread. Prefer it for large documents: the arena holds at least 64KiB
+/// while the document is alive.
+formats::json::Value FromStringWithArena(std::string_view doc);
+
+/// @brief Parse JSON from string, keeping only the listed members of the
+/// root object.
+///
+/// The whole document is validated, but the values of the other members are
+/// skipped without building a DOM for them. Use it when a handler reads a few
+/// fields of a large body:
+/// @code
+/// const auto json = formats::json::FromStringPartial(body, {"id", "name"});
+/// const auto id = json["id"].As<std::string>();
+/// @endcode
+/// Documents with a non-object root are returned as is.
+formats::json::Value FromStringPartial(
+    std::string_view doc, const std::vector<std::string_view>& members);
+
 /// Parse JSON from stream
 formats::json::Value FromStream(std::istream& is);
 
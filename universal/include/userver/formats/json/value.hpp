@@ -6,6 +6,7 @@
 #include <chrono>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include <userver/formats/common/items.hpp>
 #include <userver/formats/common/meta.hpp>
@@ -323,6 +324,9 @@ class Value final {
   friend std::string Parse(const Value& value, parse::To<std::string>);
 
   friend formats::json::Value FromString(std::string_view);
+  friend formats::json::Value FromStringWithArena(std::string_view);
+  friend formats::json::Value FromStringPartial(
+      std::string_view, const std::vector<std::string_view>&);
   friend formats::json::Value FromStream(std::istream&);
   friend void Serialize(const formats::json::Value&, std::ostream&);
   friend std::string ToString(const formats::json::Value&);
@@ -17,6 +17,9 @@ USERVER_NAMESPACE_BEGIN
 
 namespace formats::json {
 
+/// Tag for the ValueBuilder trees that are allocated from an arena
+struct ArenaTag final {};
+
 // clang-format off
 
 /// @ingroup userver_universal userver_containers userver_formats
@@ -55,6 +58,19 @@ class ValueBuilder final {
   /// Constructs a valueBuilder that holds default value for provided `type`.
   ValueBuilder(formats::common::Type type);
 
+  /// @brief Constructs a ValueBuilder that holds default value for provided
+  /// `type` and allocates all the nodes of its tree from an arena.
+  ///
+  /// The whole tree is freed in one shot when the last ValueBuilder or Value
+  /// referencing it is destroyed, so removed and overwritten members hold
+  /// their memory until then. Prefer it for building large responses.
+  ///
+  /// Values moved into the tree from other trees are copied into the arena.
+  /// Moving the root ValueBuilder keeps the arena, while copying it or moving
+  /// the extracted Value into another ValueBuilder copies the tree to the
+  /// heap.
+  ValueBuilder(ArenaTag, formats::common::Type type);
+
   /// @brief Transfers the `ValueBuilder` object
   /// @see formats::common::TransferTag for the transfer semantics
   ValueBuilder(common::TransferTag, ValueBuilder&&) noexcept;
@@ -186,7 +202,8 @@ class ValueBuilder final {
   explicit ValueBuilder(impl::MutableValueWrapper) noexcept;
 
   static void Copy(impl::Value& to, const ValueBuilder& from);
-  static void Move(impl::Value& to, ValueBuilder&& from);
+  // `to` must belong to the tree of `*this`
+  void Move(impl::Value& to, ValueBuilder&& from) const;
 
   impl::Value& AddMember(std::string_view key, CheckMemberExists);
 
@@ -0,0 +1,156 @@
+#include <formats/json/impl/arena.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/formats/json/impl/types.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+constexpr std::size_t kChunkSize = 64 * 1024;
+// Bigger allocations get a chunk of their own to avoid wasting the tail
+constexpr std::size_t kMaxSmallAllocation = kChunkSize / 4;
+// Per-thread cache limit, 4MiB
+constexpr std::size_t kMaxFreeChunks = 64;
+constexpr std::size_t kAlignment = alignof(std::max_align_t);
+
+constexpr std::size_t AlignUp(std::size_t size) noexcept {
+  return (size + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+void* AllocateOrThrow(std::size_t size) {
+  void* ptr = std::malloc(size);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+struct FreeChunks final {
+  FreeChunks() { chunks.reserve(kMaxFreeChunks); }
+
+  ~FreeChunks() {
+    for (void* chunk : chunks) std::free(chunk);
+  }
+
+  std::vector<void*> chunks;
+};
+
+compiler::ThreadLocal local_free_chunks = [] { return FreeChunks{}; };
+
+compiler::ThreadLocal local_current_arena = [] {
+  return static_cast<Arena*>(nullptr);
+};
+
+Arena* GetCurrentArena() noexcept {
+  auto current_arena = local_current_arena.Use();
+  return *current_arena;
+}
+
+}  // namespace
+
+// The header keeps the following allocations aligned
+struct alignas(kAlignment) Arena::Chunk final {
+  Chunk* next;
+  bool is_large;
+};
+
+Arena::~Arena() {
+  auto free_chunks = local_free_chunks.Use();
+  while (chunks_) {
+    Chunk* chunk = chunks_;
+    chunks_ = chunk->next;
+    if (!chunk->is_large && free_chunks->chunks.size() < kMaxFreeChunks) {
+      free_chunks->chunks.push_back(chunk);
+    } else {
+      std::free(chunk);
+    }
+  }
+}
+
+void* Arena::Allocate(std::size_t size) {
+  size = AlignUp(size);
+  if (size > kMaxSmallAllocation) return AllocateLarge(size);
+
+  if (static_cast<std::size_t>(end_ - current_) < size) {
+    void* memory = nullptr;
+    {
+      auto free_chunks = local_free_chunks.Use();
+      if (!free_chunks->chunks.empty()) {
+        memory = free_chunks->chunks.back();
+        free_chunks->chunks.pop_back();
+      }
+    }
+    if (!memory) memory = AllocateOrThrow(kChunkSize);
+
+    chunks_ = new (memory) Chunk{chunks_, false};
+    current_ = static_cast<char*>(memory) + sizeof(Chunk);
+    end_ = static_cast<char*>(memory) + kChunkSize;
+  }
+
+  void* result = current_;
+  current_ += size;
+  return result;
+}
+
+void* Arena::AllocateLarge(std::size_t size) {
+  void* memory = AllocateOrThrow(sizeof(Chunk) + size);
+  chunks_ = new (memory) Chunk{chunks_, true};
+  return static_cast<char*>(memory) + sizeof(Chunk);
+}
+
+ArenaScope::ArenaScope(Arena* arena) noexcept : arena_(arena) {
+  if (!arena_) return;
+  auto current_arena = local_current_arena.Use();
+  previous_ = std::exchange(*current_arena, arena_);
+}
+
+ArenaScope::~ArenaScope() {
+  if (!arena_) return;
+  auto current_arena = local_current_arena.Use();
+  *current_arena = previous_;
+}
+
+void* Allocator::Malloc(std::size_t size) {
+  // behavior of malloc(0) is implementation defined
+  if (size == 0) return nullptr;
+  if (Arena* arena = GetCurrentArena()) return arena->Allocate(size);
+  return std::malloc(size);
+}
+
+void* Allocator::Realloc(void* original_ptr, std::size_t original_size,
+                         std::size_t new_size) {
+  Arena* arena = GetCurrentArena();
+  if (!arena) {
+    if (new_size == 0) {
+      std::free(original_ptr);
+      return nullptr;
+    }
+    return std::realloc(original_ptr, new_size);
+  }
+
+  if (new_size == 0) return nullptr;
+  void* result = arena->Allocate(new_size);
+  if (original_ptr) {
+    std::memcpy(result, original_ptr, std::min(original_size, new_size));
+  }
+  return result;
+}
+
+void Allocator::Free(void* ptr) noexcept {
+  // Arena memory is released with the arena
+  if (GetCurrentArena()) return;
+  std::free(ptr);
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// Bump allocator for the nodes of a parsed document or ValueBuilder tree. The
+/// memory is freed in one shot on destruction, and the chunks are kept in a
+/// per-thread free list for the following documents.
+class Arena final {
+ public:
+  Arena() = default;
+  Arena(Arena&&) = delete;
+  Arena& operator=(Arena&&) = delete;
+  ~Arena();
+
+  void* Allocate(std::size_t size);
+
+ private:
+  struct Chunk;
+
+  void* AllocateLarge(std::size_t size);
+
+  Chunk* chunks_{nullptr};
+  char* current_{nullptr};
+  char* end_{nullptr};
+};
+
+/// While alive, impl::Allocator on the current thread allocates from the
+/// arena and ignores frees. Does nothing for a null arena. Must not outlive a
+/// synchronous parse or ValueBuilder operation.
+class ArenaScope final {
+ public:
+  explicit ArenaScope(Arena* arena) noexcept;
+  ArenaScope(ArenaScope&&) = delete;
+  ArenaScope& operator=(ArenaScope&&) = delete;
+  ~ArenaScope();
+
+ private:
+  Arena* const arena_;
+  Arena* previous_{nullptr};
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
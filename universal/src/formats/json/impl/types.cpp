@@ -1,5 +1,7 @@
 #include <formats/json/impl/types_impl.hpp>
 
+#include <new>
+
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -10,9 +12,27 @@ VersionedValuePtr::Data::Data(Document&& doc)
     : Data(static_cast<Value&&>(doc)) {
   static_assert(
       // NOLINTNEXTLINE(misc-redundant-expression)
-      std::is_same_v<::rapidjson::CrtAllocator, Value::AllocatorType> &&
-          std::is_same_v<::rapidjson::CrtAllocator, Document::AllocatorType>,
-      "Both Document and Value must use CrtAllocator for the fast move");
+      std::is_same_v<Allocator, Value::AllocatorType> &&
+          std::is_same_v<Allocator, Document::AllocatorType>,
+      "Both Document and Value must use impl::Allocator for the fast move");
+}
+
+VersionedValuePtr::Data::Data(Document&& doc, std::unique_ptr<Arena>&& arena)
+    : Data(std::move(doc)) {
+  this->arena = std::move(arena);
+}
+
+VersionedValuePtr::Data::Data(::rapidjson::Type type,
+                              std::unique_ptr<Arena>&& arena)
+    : Data(type) {
+  this->arena = std::move(arena);
+}
+
+VersionedValuePtr::Data::~Data() {
+  if (arena) {
+    // The whole tree goes away with the arena, skip the per-node walk
+    new (&native) Value{};
+  }
 }
 
 VersionedValuePtr::VersionedValuePtr() noexcept = default;
@@ -26,6 +46,14 @@ VersionedValuePtr::operator bool() const { return !!data_; }
 
 bool VersionedValuePtr::IsUnique() const { return data_.use_count() == 1; }
 
+bool VersionedValuePtr::IsArenaAllocated() const {
+  return data_ && data_->arena;
+}
+
+Arena* VersionedValuePtr::GetArena() const {
+  return data_ ? data_->arena.get() : nullptr;
+}
+
 const Value* VersionedValuePtr::Get() const {
   return data_ ? &data_->native : nullptr;
 }
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 
 #include <rapidjson/document.h>
 
+#include <formats/json/impl/arena.hpp>
 #include <userver/formats/json/impl/types.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,11 +20,20 @@ struct VersionedValuePtr::Data {
   // https://github.com/Tencent/rapidjson/issues/387
   explicit Data(Document&&);
 
-  ~Data() = default;
+  // The nodes of the tree are allocated from the arena
+  Data(Document&&, std::unique_ptr<Arena>&& arena);
+  Data(::rapidjson::Type, std::unique_ptr<Arena>&& arena);
+
+  ~Data();
 
   // native rapidjson value
   Value native;
 
+  // set for the trees allocated from an arena: parsed documents, which are
+  // never modified in place, and ValueBuilder trees, which are modified only
+  // with the arena scope active
+  std::unique_ptr<Arena> arena;
+
   // version of internal rapidjson structures (member arrays)
   // used in ValueBuilder to avoid UAF, ignored in read-only Value
   std::atomic<size_t> version{0};
@@ -102,6 +102,27 @@ void json_path_long_and_deeply_nested(benchmark::State& state) {
 }
 BENCHMARK(json_path_long_and_deeply_nested);
 
+void json_parse_and_access_full(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    const auto json = formats::json::FromString(bench_json_data);
+    const auto res = (json["short"].As<std::string>() == "1");
+    benchmark::DoNotOptimize(res);
+    if (!res) throw std::runtime_error("unexpected");
+  }
+}
+BENCHMARK(json_parse_and_access_full);
+
+void json_parse_and_access_partial(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    const auto json =
+        formats::json::FromStringPartial(bench_json_data, {"short"});
+    const auto res = (json["short"].As<std::string>() == "1");
+    benchmark::DoNotOptimize(res);
+    if (!res) throw std::runtime_error("unexpected");
+  }
+}
+BENCHMARK(json_parse_and_access_partial);
+
 formats::json::ValueBuilder Build(size_t count) {
   formats::json::ValueBuilder builder;
   for (size_t i = 0; i < count; i++) builder[std::to_string(i)] = i;
@@ -102,6 +102,48 @@ BENCHMARK(JsonParseValueSax)->RangeMultiplier(2)->Range(1, 16);
 
 namespace {
 
+// A large request body of which a handler needs only a couple of fields
+std::string BuildRequestBody(std::size_t items) {
+  formats::json::ValueBuilder builder{formats::json::Type::kObject};
+  builder["id"] = "request-id";
+  for (std::size_t i = 0; i < items; ++i) {
+    formats::json::ValueBuilder item;
+    item["name"] = fmt::format("item {}", i);
+    item["price"] = i * 1.5;
+    item["tags"].PushBack("some tag");
+    builder["items"].PushBack(std::move(item));
+  }
+  builder["limit"] = 10;
+  return formats::json::ToString(builder.ExtractValue());
+}
+
+}  // namespace
+
+void JsonParseFewMembersDom(benchmark::State& state) {
+  const auto input = BuildRequestBody(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto json = formats::json::FromString(input);
+    benchmark::DoNotOptimize(json["id"].As<std::string>());
+    benchmark::DoNotOptimize(json["limit"].As<int>());
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(JsonParseFewMembersDom)->RangeMultiplier(8)->Range(1, 4096);
+
+void JsonParseFewMembersPartial(benchmark::State& state) {
+  const auto input = BuildRequestBody(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto json =
+        formats::json::FromStringPartial(input, {"id", "limit"});
+    benchmark::DoNotOptimize(json["id"].As<std::string>());
+    benchmark::DoNotOptimize(json["limit"].As<int>());
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(JsonParseFewMembersPartial)->RangeMultiplier(8)->Range(1, 4096);
+
+namespace {
+
 struct SomeValue final {
   std::size_t value;
 
@@ -14,7 +14,7 @@
 USERVER_NAMESPACE_BEGIN
 
 namespace {
-::rapidjson::CrtAllocator g_allocator;
+formats::json::impl::Allocator g_allocator;
 }  // namespace
 
 // Ensure contiguous allocation in rapidjson arrays
@@ -11,11 +11,14 @@
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
 #include <rapidjson/istreamwrapper.h>
+#include <rapidjson/memorystream.h>
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/prettywriter.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/writer.h>
 
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/arena.hpp>
 #include <formats/json/impl/json_tree.hpp>
 #include <formats/json/impl/types_impl.hpp>
 #include <userver/formats/json/exception.hpp>
@@ -29,7 +32,11 @@ namespace formats::json {
 
 namespace {
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
+
+constexpr unsigned kParseFlags = rapidjson::kParseDefaultFlags |
+                                 rapidjson::kParseIterativeFlag |
+                                 rapidjson::kParseFullPrecisionFlag;
 
 std::string_view AsStringView(const impl::Value& jval) {
   return {jval.GetString(), jval.GetStringLength()};
@@ -101,6 +108,107 @@ impl::VersionedValuePtr EnsureValid(impl::Document&& json) {
   return impl::VersionedValuePtr::Create(std::move(json));
 }
 
+impl::VersionedValuePtr EnsureValid(impl::Document&& json,
+                                    std::unique_ptr<impl::Arena>&& arena) {
+  // The arena has to own the tree before anything throws
+  auto value =
+      impl::VersionedValuePtr::Create(std::move(json), std::move(arena));
+  CheckKeyUniqueness(value.Get());
+
+  return value;
+}
+
+[[noreturn]] void ThrowParseError(std::string_view doc,
+                                  const rapidjson::ParseResult& result) {
+  const auto offset = result.Offset();
+  const auto line = 1 + std::count(doc.begin(), doc.begin() + offset, '\n');
+  // Some versions of libstdc++ have runtime issues in
+  // string_view::find_last_of("\n", 0, offset) implementation.
+  const auto from_pos = doc.substr(0, offset).find_last_of('\n');
+  const auto column = offset > from_pos ? offset - from_pos : offset + 1;
+
+  throw ParseException(
+      fmt::format("JSON parse error at line {} column {}: {}", line, column,
+                  rapidjson::GetParseError_En(result.Code())));
+}
+
+// SAX handler that forwards the events to the document, except for the
+// values of the root object members that were not requested
+class MembersFilter final {
+ public:
+  MembersFilter(impl::Document& document,
+                const std::vector<std::string_view>& members)
+      : document_(document), members_(members) {}
+
+  bool Null() { return IsSkipped() || document_.Null(); }
+  bool Bool(bool b) { return IsSkipped() || document_.Bool(b); }
+  bool Int(int i) { return IsSkipped() || document_.Int(i); }
+  bool Uint(unsigned u) { return IsSkipped() || document_.Uint(u); }
+  bool Int64(int64_t i) { return IsSkipped() || document_.Int64(i); }
+  bool Uint64(uint64_t u) { return IsSkipped() || document_.Uint64(u); }
+  bool Double(double d) { return IsSkipped() || document_.Double(d); }
+
+  bool RawNumber(const char* str, rapidjson::SizeType length, bool copy) {
+    return IsSkipped() || document_.RawNumber(str, length, copy);
+  }
+
+  bool String(const char* str, rapidjson::SizeType length, bool copy) {
+    return IsSkipped() || document_.String(str, length, copy);
+  }
+
+  bool StartObject() {
+    if (depth_++ == 0) is_object_root_ = true;
+    return skipping_ || document_.StartObject();
+  }
+
+  bool Key(const char* str, rapidjson::SizeType length, bool copy) {
+    if (skipping_) return true;
+    if (depth_ == 1 && is_object_root_) {
+      const std::string_view key{str, length};
+      if (std::find(members_.begin(), members_.end(), key) == members_.end()) {
+        skipping_ = true;
+        return true;
+      }
+      ++kept_members_;
+    }
+    return document_.Key(str, length, copy);
+  }
+
+  bool EndObject(rapidjson::SizeType member_count) {
+    --depth_;
+    if (depth_ == 0 && is_object_root_) {
+      return document_.EndObject(kept_members_);
+    }
+    return IsSkipped() || document_.EndObject(member_count);
+  }
+
+  bool StartArray() {
+    ++depth_;
+    return skipping_ || document_.StartArray();
+  }
+
+  bool EndArray(rapidjson::SizeType element_count) {
+    --depth_;
+    return IsSkipped() || document_.EndArray(element_count);
+  }
+
+ private:
+  // Must be called once per skipped value and per end of a skipped container
+  bool IsSkipped() {
+    if (!skipping_) return false;
+    // A skipped member value is over once we are back in the root object
+    if (depth_ == 1) skipping_ = false;
+    return true;
+  }
+
+  impl::Document& document_;
+  const std::vector<std::string_view>& members_;
+  std::size_t depth_{0};
+  rapidjson::SizeType kept_members_{0};
+  bool is_object_root_{false};
+  bool skipping_{false};
+};
+
 }  // namespace
 
 Value FromString(std::string_view doc) {
@@ -110,22 +218,50 @@ Value FromString(std::string_view doc) {
 
   impl::Document json{&g_allocator};
   rapidjson::ParseResult ok =
-      json.Parse<rapidjson::kParseDefaultFlags |
-                 rapidjson::kParseIterativeFlag |
-                 rapidjson::kParseFullPrecisionFlag>(doc.data(), doc.size());
-  if (!ok) {
-    const auto offset = ok.Offset();
-    const auto line = 1 + std::count(doc.begin(), doc.begin() + offset, '\n');
-    // Some versions of libstdc++ have runtime issues in
-    // string_view::find_last_of("\n", 0, offset) implementation.
-    const auto from_pos = doc.substr(0, offset).find_last_of('\n');
-    const auto column = offset > from_pos ? offset - from_pos : offset + 1;
+      json.Parse<kParseFlags>(doc.data(), doc.size());
+  if (!ok) ThrowParseError(doc, ok);
 
-    throw ParseException(
-        fmt::format("JSON parse error at line {} column {}: {}", line, column,
-                    rapidjson::GetParseError_En(ok.Code())));
+  return Value{EnsureValid(std::move(json))};
+}
+
+Value FromStringWithArena(std::string_view doc) {
+  if (doc.empty()) {
+    throw ParseException("JSON document is empty");
   }
 
+  auto arena = std::make_unique<impl::Arena>();
+  // Outlives the document, so a partially built tree is not freed node by
+  // node on errors
+  const impl::ArenaScope arena_scope{arena.get()};
+  impl::Document json{&g_allocator};
+  rapidjson::ParseResult ok =
+      json.Parse<kParseFlags>(doc.data(), doc.size());
+  if (!ok) ThrowParseError(doc, ok);
+
+  return Value{EnsureValid(std::move(json), std::move(arena))};
+}
+
+Value FromStringPartial(std::string_view doc,
+                        const std::vector<std::string_view>& members) {
+  if (doc.empty()) {
+    throw ParseException("JSON document is empty");
+  }
+
+  impl::Document json{&g_allocator};
+  rapidjson::ParseResult ok;
+  auto generator = [&](impl::Document& handler) {
+    // Same stream as in Document::Parse, so whitespace skipping uses SIMD
+    rapidjson::MemoryStream memory_stream{doc.data(), doc.size()};
+    rapidjson::EncodedInputStream<impl::UTF8, rapidjson::MemoryStream> stream{
+        memory_stream};
+    MembersFilter filter{handler, members};
+    rapidjson::Reader reader;
+    ok = reader.Parse<kParseFlags>(stream, filter);
+    return !ok.IsError();
+  };
+  json.Populate(generator);
+  if (!ok) ThrowParseError(doc, ok);
+
   return Value{EnsureValid(std::move(json))};
 }
 
@@ -1185,6 +1185,103 @@ BENCHMARK(DeepJson);
 
 BENCHMARK(DeepWidthJson);
 
+std::string MakeLargeResponse(std::size_t items) {
+  formats::json::ValueBuilder builder;
+  for (std::size_t i = 0; i < items; ++i) {
+    formats::json::ValueBuilder item;
+    item["id"] = i;
+    item["name"] = "item name that does not fit into a short string";
+    item["tags"].PushBack("tag");
+    item["tags"].PushBack("another tag");
+    builder["items"].PushBack(std::move(item));
+  }
+  return formats::json::ToString(builder.ExtractValue());
+}
+
+// parses and destroys a large json, the nodes are allocated one by one
+void LargeJsonHeap(benchmark::State& state) {
+  const auto str = MakeLargeResponse(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    auto json = formats::json::FromString(str);
+    benchmark::DoNotOptimize(json);
+  }
+  state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+// parses and destroys a large json, the nodes are allocated from an arena
+void LargeJsonArena(benchmark::State& state) {
+  const auto str = MakeLargeResponse(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    auto json = formats::json::FromStringWithArena(str);
+    benchmark::DoNotOptimize(json);
+  }
+  state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+BENCHMARK(LargeJsonHeap)->RangeMultiplier(8)->Range(8, 8 << 12);
+
+BENCHMARK(LargeJsonArena)->RangeMultiplier(8)->Range(8, 8 << 12);
+
+// parses and destroys a large json with the given rapidjson allocator, shows
+// the heap path cost of impl::Allocator compared to rapidjson::CrtAllocator
+template <typename Allocator>
+void LargeJsonRapidjson(benchmark::State& state) {
+  using Document =
+      rapidjson::GenericDocument<formats::json::impl::UTF8, Allocator,
+                                 rapidjson::CrtAllocator>;
+  const auto str = MakeLargeResponse(state.range(0));
+  Allocator allocator;
+  for ([[maybe_unused]] auto _ : state) {
+    Document json{&allocator};
+    json.Parse(str.data(), str.size());
+    benchmark::DoNotOptimize(json);
+  }
+  state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+BENCHMARK_TEMPLATE(LargeJsonRapidjson, rapidjson::CrtAllocator)
+    ->RangeMultiplier(8)
+    ->Range(8, 8 << 12);
+
+BENCHMARK_TEMPLATE(LargeJsonRapidjson, formats::json::impl::Allocator)
+    ->RangeMultiplier(8)
+    ->Range(8, 8 << 12);
+
+template <typename... Args>
+formats::json::Value BuildLargeResponse(std::size_t items, Args... args) {
+  formats::json::ValueBuilder builder{args..., formats::common::Type::kObject};
+  auto items_builder = builder["items"];
+  items_builder.Resize(items);
+  for (std::size_t i = 0; i < items; ++i) {
+    auto item = items_builder[i];
+    item["id"] = i;
+    item["name"] = "item name that does not fit into a short string";
+    item["tags"].PushBack("tag");
+    item["tags"].PushBack("another tag");
+  }
+  return builder.ExtractValue();
+}
+
+// builds and destroys a large json, the nodes are allocated one by one
+void BuildLargeJsonHeap(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    auto json = BuildLargeResponse(state.range(0));
+    benchmark::DoNotOptimize(json);
+  }
+}
+
+// builds and destroys a large json, the nodes are allocated from an arena
+void BuildLargeJsonArena(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    auto json = BuildLargeResponse(state.range(0), formats::json::ArenaTag{});
+    benchmark::DoNotOptimize(json);
+  }
+}
+
+BENCHMARK(BuildLargeJsonHeap)->RangeMultiplier(8)->Range(8, 8 << 9);
+
+BENCHMARK(BuildLargeJsonArena)->RangeMultiplier(8)->Range(8, 8 << 9);
+
 namespace {
 
 struct InnerObject final {
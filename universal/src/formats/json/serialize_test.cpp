@@ -6,6 +6,7 @@
 
 #include <formats/common/serialize_test.hpp>
 #include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/inline.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/formats/parse/common_containers.hpp>
@@ -68,6 +69,75 @@ TEST(FormatsJson, ParseErrorLineColumnValidation) {
                        "line 2 column 12");
 }
 
+TEST(FormatsJson, FromStringWithArena) {
+  const std::string long_string(100 * 1024, 'x');
+  const auto doc = fmt::format(
+      R"~({{"a": [1, 2.5, "str", null, true], "b": {{"c": "{}"}}}})~",
+      long_string);
+
+  for (int i = 0; i < 3; ++i) {
+    auto json = formats::json::FromStringWithArena(doc);
+    EXPECT_EQ(json, formats::json::FromString(doc));
+    EXPECT_EQ(json["b"]["c"].As<std::string>(), long_string);
+
+    // Subvalues keep the whole arena alive
+    const auto array = json["a"];
+    json = formats::json::Value{};
+    EXPECT_EQ(array[2].As<std::string>(), "str");
+
+    formats::json::ValueBuilder builder{formats::json::Value{array}};
+    builder.PushBack(42);
+    EXPECT_EQ(builder.ExtractValue()[5].As<int>(), 42);
+    EXPECT_EQ(array.GetSize(), 5);
+  }
+}
+
+TEST(FormatsJson, FromStringWithArenaErrors) {
+  using ParseException = formats::json::Value::ParseException;
+
+  EXPECT_THROW(formats::json::FromStringWithArena(R"({"a": ["b", {"c": )"),
+               ParseException);
+  EXPECT_THROW(formats::json::FromStringWithArena(R"({"a": "b", "a": 1})"),
+               ParseException);
+  EXPECT_THROW(formats::json::FromStringWithArena(""), ParseException);
+
+  // The thread is not left in the arena mode
+  formats::json::ValueBuilder builder;
+  builder["key"] = "value";
+  EXPECT_EQ(builder.ExtractValue()["key"].As<std::string>(), "value");
+}
+
+TEST(FormatsJson, FromStringPartial) {
+  const auto json = formats::json::FromStringPartial(
+      R"~({"skipped": {"nested": [1, {"a": "b"}, []]}, "id": 42,
+          "other": "x", "obj": {"k": [1, 2]}, "last": null})~",
+      {"obj", "id", "missing"});
+
+  EXPECT_EQ(formats::json::FromString(R"~({"id": 42, "obj": {"k": [1, 2]}})~"),
+            json);
+  EXPECT_EQ(json["id"].As<int>(), 42);
+  EXPECT_FALSE(json.HasMember("skipped"));
+  EXPECT_FALSE(json.HasMember("last"));
+
+  EXPECT_EQ(formats::json::FromStringPartial("[1, 2]", {"id"}),
+            formats::json::FromString("[1, 2]"));
+  EXPECT_EQ(formats::json::FromStringPartial("{}", {"id"}),
+            formats::json::MakeObject());
+}
+
+TEST(FormatsJson, FromStringPartialErrors) {
+  using ParseException = formats::json::Value::ParseException;
+
+  // Skipped values are still validated
+  EXPECT_THROW(formats::json::FromStringPartial(R"({"a": [1,}, "id": 1})",
+                                                {"id"}),
+               ParseException);
+  EXPECT_THROW(formats::json::FromStringPartial(R"({"id": 1, "id": 2})",
+                                                {"id"}),
+               ParseException);
+  EXPECT_THROW(formats::json::FromStringPartial("", {"id"}), ParseException);
+}
+
 TEST(FormatsJson, ParseFromBadFile) {
   using formats::json::blocking::FromFile;
   using ParseException = formats::json::Value::ParseException;
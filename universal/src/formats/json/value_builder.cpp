@@ -1,5 +1,8 @@
 #include <userver/formats/json/value_builder.hpp>
 
+#include <memory>
+#include <utility>
+
 #include <rapidjson/allocators.h>
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
@@ -11,6 +14,7 @@
 #include <userver/utils/datetime.hpp>
 
 #include <formats/common/validations.hpp>
+#include <formats/json/impl/arena.hpp>
 #include <formats/json/impl/types_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,19 +38,35 @@ rapidjson::Type ToNativeType(Type type) {
   }
 }
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
+
+// Nodes may be moved between the heap allocated trees only. Arena trees are
+// copied into and out of.
+bool IsMovable(const impl::VersionedValuePtr& from,
+               const impl::VersionedValuePtr& to) {
+  return !from.IsArenaAllocated() && !to.IsArenaAllocated();
+}
 
 }  // namespace
 
 ValueBuilder::ValueBuilder(Type type)
     : value_(impl::VersionedValuePtr::Create(ToNativeType(type))) {}
 
+ValueBuilder::ValueBuilder(ArenaTag, Type type)
+    : value_(impl::VersionedValuePtr::Create(
+          ToNativeType(type), std::make_unique<impl::Arena>())) {}
+
 ValueBuilder::ValueBuilder(const ValueBuilder& other) {
   Copy(value_->GetNative(), other);
 }
 
 // NOLINTNEXTLINE(performance-noexcept-move-constructor)
 ValueBuilder::ValueBuilder(ValueBuilder&& other) {
+  if (other.value_->IsRoot() && other.value_->holder_.IsArenaAllocated()) {
+    // The arena goes along with the tree
+    value_ = std::exchange(other.value_, impl::MutableValueWrapper{});
+    return;
+  }
   Move(value_->GetNative(), std::move(other));
 }
 
@@ -93,6 +113,7 @@ ValueBuilder::ValueBuilder(double t)
 ValueBuilder& ValueBuilder::operator=(const ValueBuilder& other) {
   if (this == &other) return *this;
 
+  const impl::ArenaScope arena_scope{value_->holder_.GetArena()};
   if ((value_->IsArray() || value_->IsObject()) && value_->GetSize() != 0) {
     value_.OnMembersChange();
   }
@@ -102,6 +123,7 @@ ValueBuilder& ValueBuilder::operator=(const ValueBuilder& other) {
 
 // NOLINTNEXTLINE(performance-noexcept-move-constructor)
 ValueBuilder& ValueBuilder::operator=(ValueBuilder&& other) {
+  const impl::ArenaScope arena_scope{value_->holder_.GetArena()};
   if ((value_->IsArray() || value_->IsObject()) && value_->GetSize() != 0) {
     value_.OnMembersChange();
   }
@@ -118,7 +140,8 @@ ValueBuilder::ValueBuilder(const formats::json::Value& other) {
 ValueBuilder::ValueBuilder(formats::json::Value&& other) {
   // As we have new native object created,
   // we fill it with the other's native object.
-  if (other.IsUniqueReference())
+  // Arena allocated trees are immutable, so they are copied
+  if (other.IsUniqueReference() && !other.holder_.IsArenaAllocated())
     value_->GetNative() = std::move(other.GetNative());
   else
     // rapidjson uses move semantics in assignment
@@ -136,6 +159,7 @@ ValueBuilder::ValueBuilder(common::TransferTag, ValueBuilder&& value) noexcept
     : value_(std::move(value.value_)) {}
 
 ValueBuilder ValueBuilder::operator[](std::string key) {
+  const impl::ArenaScope arena_scope{value_->holder_.GetArena()};
   auto& member = AddMember(key, CheckMemberExists::kYes);
   return ValueBuilder{value_.WrapMember(std::move(key), member)};
 }
@@ -146,11 +170,13 @@ ValueBuilder ValueBuilder::operator[](std::size_t index) {
 }
 
 void ValueBuilder::EmplaceNocheck(std::string_view key, ValueBuilder value) {
+  const impl::ArenaScope arena_scope{value_->holder_.GetArena()};
   Move(AddMember(key, CheckMemberExists::kNo), std::move(value));
 }
 
 void ValueBuilder::Remove(std::string_view key) {
   value_->CheckObject();
+  const impl::ArenaScope arena_scope{value_->holder_.GetArena()};
   if (value_->GetNative().RemoveMember(impl::MakeJsonStringViewValue(key))) {
     value_.OnMembersChange();
   }
@@ -196,6 +222,7 @@ std::string ValueBuilder::GetPath() const { return value_->GetPath(); }
 
 void ValueBuilder::Resize(std::size_t size) {
   value_->CheckArrayOrNull();
+  const impl::ArenaScope arena_scope{value_->holder_.GetArena()};
   auto& native = value_->GetNative();
 
   if (native.IsNull()) native.SetArray();
@@ -218,6 +245,7 @@ void ValueBuilder::Resize(std::size_t size) {
 
 void ValueBuilder::PushBack(ValueBuilder&& bld) {
   value_->CheckArrayOrNull();
+  const impl::ArenaScope arena_scope{value_->holder_.GetArena()};
   auto& native = value_->GetNative();
   if (native.IsNull()) {
     native.SetArray();
@@ -232,7 +260,8 @@ void ValueBuilder::PushBack(ValueBuilder&& bld) {
     }
   };
 
-  if (bld.value_->IsRoot()) {
+  if (bld.value_->IsRoot() &&
+      IsMovable(bld.value_->holder_, value_->holder_)) {
     // PushBack is moving value via RawAssign
     checked_push_back(bld.value_->GetNative());
   } else {
@@ -253,8 +282,9 @@ void ValueBuilder::Copy(impl::Value& to, const ValueBuilder& from) {
   to.CopyFrom(from.value_->GetNative(), g_allocator);
 }
 
-void ValueBuilder::Move(impl::Value& to, ValueBuilder&& from) {
-  if (from.value_->IsRoot()) {
+void ValueBuilder::Move(impl::Value& to, ValueBuilder&& from) const {
+  if (from.value_->IsRoot() &&
+      IsMovable(from.value_->holder_, value_->holder_)) {
     to = std::move(from.value_->GetNative());
   } else {
     Copy(to, from);
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/inline.hpp>
 #include <userver/formats/json/value_builder.hpp>
 
 // for testing std::optional/null
@@ -160,6 +163,49 @@ TEST(JsonValueBuilder, StringViewEmplaceNocheck) {
   EXPECT_EQ(1025, value[std::string(1024, 'a') + 'b'].As<int>());
 }
 
+TEST(JsonValueBuilder, Arena) {
+  const std::string long_string(1024, 'x');
+
+  formats::json::ValueBuilder builder{formats::json::ArenaTag{},
+                                      formats::common::Type::kObject};
+  for (int i = 0; i < 1000; ++i) {
+    formats::json::ValueBuilder item;
+    item["id"] = i;
+    item["name"] = long_string;
+    builder["items"].PushBack(std::move(item));
+  }
+  builder["removed"] = long_string;
+  builder["removed"] = "short";
+  builder.Remove("removed");
+  builder["array"].Resize(10);
+  builder["array"].Resize(1);
+
+  // Moving the root builder keeps the arena
+  formats::json::ValueBuilder moved = std::move(builder);
+  moved["array"][0] = 42;
+
+  // Subtrees are copied out of the arena
+  formats::json::ValueBuilder heap;
+  heap["item"] = moved["items"][3];
+  heap["copy"].PushBack(formats::json::ValueBuilder{moved});
+
+  const auto value = moved.ExtractValue();
+  EXPECT_FALSE(value.HasMember("removed"));
+  EXPECT_EQ(value["items"].GetSize(), 1000);
+  EXPECT_EQ(value["items"][999]["id"].As<int>(), 999);
+  EXPECT_EQ(value["items"][999]["name"].As<std::string>(), long_string);
+  EXPECT_EQ(value["array"], formats::json::MakeArray(42));
+
+  // The extracted value is immutable, it is copied into a new builder
+  formats::json::ValueBuilder modified{formats::json::Value{value}};
+  modified["items"] = 1;
+  EXPECT_EQ(value["items"].GetSize(), 1000);
+
+  const auto heap_value = heap.ExtractValue();
+  EXPECT_EQ(heap_value["item"]["id"].As<int>(), 3);
+  EXPECT_EQ(heap_value["copy"][0], value);
+}
+
 }  // namespace my_namespace
 
 /// [Sample Customization formats::json::ValueBuilder usage]